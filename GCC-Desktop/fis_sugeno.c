@@ -11,8 +11,187 @@
   */
 
 /* Private includes ----------------------------------------------------------*/
+#include <math.h>
 #include <stddef.h>
 #include "fis_sugeno.h"
+#include "fis_sugeno_simd.h"
+
+/* Private functions ---------------------------------------------------------*/
+/**
+ * @brief Weighted consequent of a rule with the given firing strength.
+ */
+static inline FIS_RuleOutput FIS_RuleConsequent(const FIS_Rule* rule, float weight, const float* inputs, int input_count)
+{
+    // Non-firing rule: consequent does not contribute to the output
+    if (weight == 0.0f)
+        return (FIS_RuleOutput){ .output = 0.0f, .weight = 0.0f };
+
+    float output = (rule->coefficients != NULL) ? FIS_LinearConsequent(rule->coefficients, inputs, input_count)
+                                                : rule->consequent(inputs);
+    FIS_RuleOutput rule_out = {.output = weight * output, .weight = weight };
+    return rule_out;
+}
+
+/**
+ * @brief FIS_EvaluateRule() over per-input rows of degrees (as kept in FIS_Workspace).
+ */
+static FIS_RuleOutput FIS_EvaluateRuleRows(const FIS_Rule* rule, float* const* input_degrees, const float* inputs, int input_count)
+{
+    float weight = FIS_InitialWeight(rule->logic_type);
+    int conjunction = FIS_IsConjunction(rule->logic_type);
+
+    for (int i = 0; i < input_count; ++i) 
+    {
+        int mf_index = rule->mf_indices[i];
+        if(mf_index < 0)
+            continue;
+
+        weight = FIS_CombineDegree(rule->logic_type, weight, input_degrees[i][mf_index]);
+
+        // AND of anything with zero stays zero
+        if (conjunction && weight == 0.0f)
+            break;
+    }
+
+    return FIS_RuleConsequent(rule, weight, inputs, input_count);
+}
+
+/**
+ * @brief FIS_EvaluateRule() without a degree table: every antecedent term evaluates
+ *        its membership function (stack-free path for systems of any size).
+ */
+static FIS_RuleOutput FIS_EvaluateRuleDirect(const FIS_System* fis, const FIS_Rule* rule, const float* inputs)
+{
+    float weight = FIS_InitialWeight(rule->logic_type);
+    int conjunction = FIS_IsConjunction(rule->logic_type);
+
+    for (int i = 0; i < fis->num_inputs; ++i)
+    {
+        int mf_index = rule->mf_indices[i];
+        if (mf_index < 0)
+            continue;
+
+        weight = FIS_CombineDegree(rule->logic_type, weight, FIS_EvaluateMemberFunction(inputs[i], fis->input_mfs[i][mf_index]));
+
+        // AND of anything with zero stays zero
+        if (conjunction && weight == 0.0f)
+            break;
+    }
+
+    return FIS_RuleConsequent(rule, weight, inputs, fis->num_inputs);
+}
+
+/**
+ * @brief Checks whether the degrees of a FIS fit the stack tables of FIS_Evaluate()
+ *        and FIS_EvaluateBatch() (FIS_MAX_INPUTS x FIS_MAX_MFS).
+ */
+static int FIS_FitsStackTables(const FIS_System* fis)
+{
+    if (fis->num_inputs > FIS_MAX_INPUTS)
+        return 0;
+
+    for (int i = 0; i < fis->num_inputs; ++i)
+        if (fis->num_mfs_per_input[i] > FIS_MAX_MFS)
+            return 0;
+
+    return 1;
+}
+
+/**
+ * @brief Batch evaluation in blocks of FIS_BATCH_BLOCK samples, each stage a tight loop
+ *        over the block. degrees[k * FIS_BATCH_BLOCK + s]: MF k (numbered input by
+ *        input) for sample s of the block; consequent functions receive each sample
+ *        gathered into `row` (num_inputs values).
+ */
+static void FIS_EvaluateBlocks(const FIS_System* fis, const float* const* inputs, float* outputs, int count,
+                               float* degrees, float* row)
+{
+    // Per-block buffers: rule weights, defuzzification sums
+    float weight[FIS_BATCH_BLOCK];
+    float numerator[FIS_BATCH_BLOCK];
+    float denominator[FIS_BATCH_BLOCK];
+
+    for (int start = 0; start < count; start += FIS_BATCH_BLOCK)
+    {
+        int n = count - start;
+        if (n > FIS_BATCH_BLOCK)
+            n = FIS_BATCH_BLOCK;
+
+        // Fuzzification step: one membership function over the whole block at a time
+        for (int i = 0, k = 0; i < fis->num_inputs; ++i)
+            for (int m = 0; m < fis->num_mfs_per_input[i]; ++m, ++k)
+                FIS_MF_EvalArray(fis->input_mfs[i][m], inputs[i] + start, &degrees[k * FIS_BATCH_BLOCK], n);
+
+        for (int s = 0; s < n; ++s)
+        {
+            numerator[s] = 0.0f;
+            denominator[s] = 0.0f;
+        }
+
+        // Rule evaluation: antecedents over the block, then weighted consequents
+        for (int r = 0; r < fis->num_rules; ++r)
+        {
+            const FIS_Rule* rule = &fis->rules[r];
+            float w0 = FIS_InitialWeight(rule->logic_type);
+            int conjunction = FIS_IsConjunction(rule->logic_type);
+            int firing = n;
+
+            for (int s = 0; s < n; ++s)
+                weight[s] = w0;
+
+            for (int i = 0, first_mf = 0; i < fis->num_inputs && firing > 0; first_mf += fis->num_mfs_per_input[i++])
+            {
+                int mf_index = rule->mf_indices[i];
+                if (mf_index < 0)
+                    continue;
+
+                const float* degree = &degrees[(first_mf + mf_index) * FIS_BATCH_BLOCK];
+                for (int s = 0; s < n; ++s)
+                    weight[s] = FIS_CombineDegree(rule->logic_type, weight[s], degree[s]);
+
+                // Stop once the rule fires for no sample of the block
+                if (conjunction)
+                {
+                    firing = 0;
+                    for (int s = 0; s < n; ++s)
+                        firing += (weight[s] != 0.0f);
+                }
+            }
+
+            if (firing == 0)
+                continue;
+
+            for (int s = 0; s < n; ++s)
+            {
+                if (weight[s] == 0.0f)
+                    continue;
+
+                float output;
+                if (rule->coefficients != NULL)
+                {
+                    // Same summation order as FIS_LinearConsequent(), read straight from the columns
+                    output = 0.0f;
+                    for (int i = 0; i < fis->num_inputs; ++i)
+                        output += rule->coefficients[i] * inputs[i][start + s];
+                    output += rule->coefficients[fis->num_inputs];
+                }
+                else
+                {
+                    for (int i = 0; i < fis->num_inputs; ++i)
+                        row[i] = inputs[i][start + s];
+                    output = rule->consequent(row);
+                }
+
+                numerator[s] += weight[s] * output;
+                denominator[s] += weight[s];
+            }
+        }
+
+        // Weighted average defuzzification
+        for (int s = 0; s < n; ++s)
+            outputs[start + s] = (denominator[s] == 0.0f) ? 0.0f : numerator[s] / denominator[s];
+    }
+}
 
 /* Public functions ----------------------------------------------------------*/
 float FIS_EvaluateMemberFunction(float input, const FIS_MembershipFunction* mf) 
@@ -32,47 +211,12 @@ void FIS_FuzzifyInput(float input, FIS_MembershipFunction** mf_array, int mf_cou
 
 FIS_RuleOutput FIS_EvaluateRule(FIS_Rule* rule, float input_degrees[FIS_MAX_INPUTS][FIS_MAX_MFS], const float* inputs, int input_count) 
 {
-    float weight;
-
-    if (rule->logic_type == FIS_AND_PRODUCT)
-        weight = 1.0f;
-    else if (rule->logic_type == FIS_AND_MIN)
-        weight = 1.0f;
-    else if (rule->logic_type == FIS_OR_MAX)
-        weight = 0.0f;
-    else if (rule->logic_type == FIS_OR_PROB_SUM)
-        weight = 0.0f;
-
-    for (int i = 0; i < input_count; ++i) 
-    {
-        int mf_index = rule->mf_indices[i];
-        if(mf_index < 0)
-            continue;
+    float* degree_rows[FIS_MAX_INPUTS];
 
-        float degree = input_degrees[i][mf_index];
-
-        switch (rule->logic_type) 
-        {
-            case FIS_AND_PRODUCT:
-                weight *= degree;
-                break;
-            case FIS_AND_MIN:
-                if (degree < weight)
-                    weight = degree;
-                break;
-            case FIS_OR_MAX:
-                if (degree > weight)
-                    weight = degree;
-                break;
-            case FIS_OR_PROB_SUM:
-                weight = weight + degree - (weight * degree);
-                break;
-        }
-    }
+    for (int i = 0; i < input_count; ++i)
+        degree_rows[i] = input_degrees[i];
 
-    float output = rule->consequent(inputs);
-    FIS_RuleOutput rule_out = {.output = weight * output, .weight = weight };
-    return rule_out;
+    return FIS_EvaluateRuleRows(rule, degree_rows, inputs, input_count);
 }
 
 float FIS_DefuzzifyOutput(FIS_RuleOutput* rule_output, int rule_count)
@@ -95,65 +239,190 @@ float FIS_DefuzzifyOutput(FIS_RuleOutput* rule_output, int rule_count)
 
 float FIS_Evaluate(FIS_System* fis, float* inputs) 
 {
-    // Arrays to accumulate degrees of membership
-    static float input_degrees[FIS_MAX_INPUTS][FIS_MAX_MFS];
+    float numerator = 0.0f;
+    float denominator = 0.0f;
+
+    if (FIS_FitsStackTables(fis))
+    {
+        // Stack-allocated degrees: keeps the function reentrant
+        float degrees[FIS_MAX_INPUTS * FIS_MAX_MFS];
+        float* degree_rows[FIS_MAX_INPUTS];
 
+        for (int i = 0, offset = 0; i < fis->num_inputs; offset += fis->num_mfs_per_input[i++])
+        {
+            degree_rows[i] = &degrees[offset];
+            FIS_FuzzifyInput(inputs[i], fis->input_mfs[i], fis->num_mfs_per_input[i], degree_rows[i]);
+        }
+
+        // Rule outputs are summed as they are produced (same order as FIS_DefuzzifyOutput())
+        for (int r = 0; r < fis->num_rules; ++r)
+        {
+            FIS_RuleOutput rule_out = FIS_EvaluateRuleRows(&fis->rules[r], degree_rows, inputs, fis->num_inputs);
+            numerator += rule_out.output;
+            denominator += rule_out.weight;
+        }
+    }
+    else
+    {
+        // Larger systems: no tables at all, memberships evaluated per antecedent term
+        for (int r = 0; r < fis->num_rules; ++r)
+        {
+            FIS_RuleOutput rule_out = FIS_EvaluateRuleDirect(fis, &fis->rules[r], inputs);
+            numerator += rule_out.output;
+            denominator += rule_out.weight;
+        }
+    }
+
+    if (denominator == 0.0f)
+        return 0.0f;
+
+    return numerator / denominator;
+}
+
+float FIS_EvaluateReentrant(const FIS_System* fis, const float* inputs, FIS_Workspace* ws)
+{
     // Fuzzification step for all inputs
     for (int i = 0; i < fis->num_inputs; ++i) 
-        FIS_FuzzifyInput(inputs[i], fis->input_mfs[i], fis->num_mfs_per_input[i], input_degrees[i]);
-
-    // Arrays to accumulate weighted outputs and weights
-    FIS_RuleOutput rule_output[FIS_MAX_RULES];
+        FIS_FuzzifyInput(inputs[i], fis->input_mfs[i], fis->num_mfs_per_input[i], ws->input_degrees[i]);
 
     // Evaluate each rule
     for (int r = 0; r < fis->num_rules; ++r)
-        rule_output[r] = FIS_EvaluateRule(&fis->rules[r], input_degrees, inputs, fis->num_inputs);
+        ws->rule_output[r] = FIS_EvaluateRuleRows(&fis->rules[r], ws->input_degrees, inputs, fis->num_inputs);
 
     // Defuzzify final result
-    return FIS_DefuzzifyOutput(rule_output, fis->num_rules);
+    return FIS_DefuzzifyOutput(ws->rule_output, fis->num_rules);
 }
 
-/* Public function  - membership functions evaluation ------------------------*/
-float FIS_MF_TriangularEval(float input, void* params)
+void FIS_EvaluateBatch(FIS_System* fis, const float* const* inputs, float* outputs, int count)
 {
-    FIS_MF_TriangularParams* p = (FIS_MF_TriangularParams*)params;
-    float output = 0.0;
+    // Stack tables: degrees of one block, one sample gathered for consequent functions
+    float degrees[FIS_MAX_INPUTS * FIS_MAX_MFS * FIS_BATCH_BLOCK];
+    float row[FIS_MAX_INPUTS];
 
-    if (input < p->a || input > p->c)
-        output = 0.0f;
-    else if (input == p->b)
-        output =1.0f;
-    else if (input < p->b)
-        output = (input - p->a) / (p->b - p->a);
-    else // input > p->b
-        output = (p->c - input) / (p->c - p->b);
+    // Larger systems: FIS_EvaluateBatchReentrant()
+    if (!FIS_FitsStackTables(fis))
+        return;
 
-    if (output > 1.0f)
-        output = 1.0f;
-    else if (output < 0.0f)
-        output = 0.0f;
+    FIS_EvaluateBlocks(fis, inputs, outputs, count, degrees, row);
+}
 
-    return output;
+void FIS_EvaluateBatchReentrant(const FIS_System* fis, const float* const* inputs, float* outputs, int count, FIS_BatchWorkspace* ws)
+{
+    FIS_EvaluateBlocks(fis, inputs, outputs, count, ws->degrees, ws->input_row);
+}
+
+/* Public functions - memory management --------------------------------------*/
+void FIS_Arena_Init(FIS_Arena* arena, void* buffer, size_t size)
+{
+    arena->base = (unsigned char*)buffer;
+    arena->size = size;
+    arena->used = 0;
+}
+
+void* FIS_Arena_Alloc(FIS_Arena* arena, size_t size, size_t align)
+{
+    size_t address = (size_t)(arena->base + arena->used);
+    size_t padding = (align - (address & (align - 1))) & (align - 1);
+
+    if (arena->base == NULL || padding + size > arena->size - arena->used)
+        return NULL;
+
+    void* block = arena->base + arena->used + padding;
+    arena->used += padding + size;
+    return block;
+}
+
+void FIS_Arena_Reset(FIS_Arena* arena)
+{
+    arena->used = 0;
+}
+
+size_t FIS_Workspace_Size(const FIS_System* fis)
+{
+    int num_degrees = 0;
+    for (int i = 0; i < fis->num_inputs; ++i)
+        num_degrees += fis->num_mfs_per_input[i];
+
+    // Every allocation may need up to (FIS_ARENA_ALIGN - 1) bytes of padding
+    return sizeof(FIS_Workspace)
+         + sizeof(float*) * fis->num_inputs
+         + sizeof(float) * num_degrees
+         + sizeof(FIS_RuleOutput) * fis->num_rules
+         + 4 * (FIS_ARENA_ALIGN - 1);
+}
+
+FIS_Workspace* FIS_Workspace_Create(const FIS_System* fis, FIS_Arena* arena)
+{
+    int num_degrees = 0;
+    for (int i = 0; i < fis->num_inputs; ++i)
+        num_degrees += fis->num_mfs_per_input[i];
+
+    FIS_Workspace* ws = FIS_Arena_Alloc(arena, sizeof(FIS_Workspace), FIS_ARENA_ALIGN);
+    float** degree_rows = FIS_Arena_Alloc(arena, sizeof(float*) * fis->num_inputs, FIS_ARENA_ALIGN);
+    float* degrees = FIS_Arena_Alloc(arena, sizeof(float) * num_degrees, FIS_ARENA_ALIGN);
+    FIS_RuleOutput* rule_output = FIS_Arena_Alloc(arena, sizeof(FIS_RuleOutput) * fis->num_rules, FIS_ARENA_ALIGN);
+
+    if (ws == NULL || degree_rows == NULL || degrees == NULL || rule_output == NULL)
+        return NULL;
+
+    ws->num_inputs = fis->num_inputs;
+    ws->num_rules = fis->num_rules;
+    ws->degrees = degrees;
+
+    for (int i = 0; i < fis->num_inputs; ++i)
+    {
+        degree_rows[i] = degrees;
+        degrees += fis->num_mfs_per_input[i];
+    }
+
+    ws->input_degrees = degree_rows;
+    ws->rule_output = rule_output;
+    return ws;
+}
+
+size_t FIS_BatchWorkspace_Size(const FIS_System* fis)
+{
+    int num_degrees = 0;
+    for (int i = 0; i < fis->num_inputs; ++i)
+        num_degrees += fis->num_mfs_per_input[i];
+
+    return sizeof(FIS_BatchWorkspace)
+         + sizeof(float) * num_degrees * FIS_BATCH_BLOCK
+         + sizeof(float) * fis->num_inputs
+         + 3 * (FIS_ARENA_ALIGN - 1);
+}
+
+FIS_BatchWorkspace* FIS_BatchWorkspace_Create(const FIS_System* fis, FIS_Arena* arena)
+{
+    int num_degrees = 0;
+    for (int i = 0; i < fis->num_inputs; ++i)
+        num_degrees += fis->num_mfs_per_input[i];
+
+    const size_t mark = arena->used;
+    FIS_BatchWorkspace* ws = FIS_Arena_Alloc(arena, sizeof(FIS_BatchWorkspace), FIS_ARENA_ALIGN);
+    float* degrees = FIS_Arena_Alloc(arena, sizeof(float) * num_degrees * FIS_BATCH_BLOCK, FIS_ARENA_ALIGN);
+    float* input_row = FIS_Arena_Alloc(arena, sizeof(float) * fis->num_inputs, FIS_ARENA_ALIGN);
+
+    if (ws == NULL || degrees == NULL || input_row == NULL)
+    {
+        arena->used = mark;
+        return NULL;
+    }
+
+    ws->num_inputs = fis->num_inputs;
+    ws->num_degrees = num_degrees;
+    ws->degrees = degrees;
+    ws->input_row = input_row;
+    return ws;
+}
+
+/* Public function  - membership functions evaluation ------------------------*/
+float FIS_MF_TriangularEval(float input, void* params)
+{
+    return FIS_MF_Triangular(input, (const FIS_MF_TriangularParams*)params);
 }
 
 float FIS_MF_TrapezoidalEval(float input, void* params)
 {
-    FIS_MF_TrapezoidalParams* p = (FIS_MF_TrapezoidalParams*)params;
-    float output = 0.0;
-
-    if (input < p->a || input > p->d)
-         output = 0.0f;
-    else if (input >= p->b && input <= p->c)
-        output = 1.0f;
-    else if (input > p->a && input < p->b)
-        output = (input - p->a) / (p->b - p->a);
-    else // input > p->c && input < p->d
-        output = (p->d - input) / (p->d - p->c);
-
-    if (output > 1.0f)
-        output = 1.0f;
-    else if (output < 0.0f)
-        output = 0.0f;
-
-    return output;
-}
\ No newline at end of file
+    return FIS_MF_Trapezoidal(input, (const FIS_MF_TrapezoidalParams*)params);
+}
@@ -14,7 +14,12 @@
 #define INC_FIS_SUGENO_H_
   
 /* Public includes -----------------------------------------------------------*/
+#include <stddef.h>
   
+#ifdef __cplusplus
+extern "C" {
+#endif
+
 /* Public typedef ------------------------------------------------------------*/
 typedef float (*FIS_MF_Eval)(float input, void* params);
 typedef float (*FIS_ConsequentFunction)(const float* inputs);
@@ -38,6 +43,7 @@ typedef struct
     int* mf_indices;                    
     FIS_ConsequentFunction consequent;  
     FIS_LogicType logic_type;               
+    const float* coefficients;          // linear consequent {p1, ..., pn, p0} (NULL: use `consequent`)
 } FIS_Rule;
 
 typedef struct {
@@ -54,6 +60,42 @@ typedef struct
     int num_rules;
 } FIS_System;
 
+/**
+ * @brief Linear (bump) allocator over a caller-supplied memory block.
+ *        Everything allocated from an arena is released at once with FIS_Arena_Reset().
+ */
+typedef struct
+{
+    unsigned char* base;
+    size_t size;
+    size_t used;
+} FIS_Arena;
+
+/**
+ * @brief Caller-owned scratch memory for a single evaluation, sized from a FIS_System.
+ *        Each thread evaluating a FIS concurrently needs its own workspace.
+ */
+typedef struct
+{
+    int num_inputs;
+    int num_rules;
+    float* degrees;                 // contiguous storage of all degrees of membership
+    float** input_degrees;          // input_degrees[i][m]: degree of MF m of input i (rows of `degrees`)
+    FIS_RuleOutput* rule_output;    // weight and weighted output of every rule (last evaluation)
+} FIS_Workspace;
+
+/**
+ * @brief Caller-owned scratch memory for FIS_EvaluateBatchReentrant(), sized from a
+ *        FIS_System: degrees of one block of samples and one gathered sample.
+ */
+typedef struct
+{
+    int num_inputs;
+    int num_degrees;
+    float* degrees;                 // [num_degrees * FIS_BATCH_BLOCK]: MF k (input by input) for sample s at k * FIS_BATCH_BLOCK + s
+    float* input_row;               // one sample gathered from the input columns (consequent functions)
+} FIS_BatchWorkspace;
+
 /* Public typedef - membership functions parameters types --------------------*/
 
 /**
@@ -82,9 +124,12 @@ typedef struct {
 
 
 /* Public define -------------------------------------------------------------*/
-#define FIS_MAX_INPUTS     6
-#define FIS_MAX_MFS        3
-#define FIS_MAX_RULES      3
+#define FIS_MAX_INPUTS     6    // Degree table of FIS_EvaluateRule() and stack tables of FIS_Evaluate() and
+#define FIS_MAX_MFS        3    // FIS_EvaluateBatch(); not a limit: see FIS_Evaluate(), FIS_EvaluateBatchReentrant()
+
+#define FIS_BATCH_BLOCK    64   // Samples processed per inner loop in batch evaluation
+
+#define FIS_ARENA_ALIGN    16   // Default alignment of arena allocations
 
 /* Public macro --------------------------------------------------------------*/
 #define __FIS_MF_CreateTriangular(name, a_, b_, c_)                              \
@@ -115,6 +160,112 @@ typedef struct {
         .params = &name##_params,                                                                   \
     };
 
+/* Public inline functions ---------------------------------------------------*/
+/**
+ * @brief Neutral element of the rule logic operator (weight before the first antecedent).
+ */
+static inline float FIS_InitialWeight(FIS_LogicType logic_type)
+{
+    if (logic_type == FIS_OR_MAX || logic_type == FIS_OR_PROB_SUM)
+        return 0.0f;
+    else
+        return 1.0f;
+}
+
+/**
+ * @brief Checks whether the rule logic operator is a t-norm (AND). A zero weight
+ *        of such a rule stays zero, so remaining antecedents can be skipped.
+ */
+static inline int FIS_IsConjunction(FIS_LogicType logic_type)
+{
+    return logic_type == FIS_AND_MIN || logic_type == FIS_AND_PRODUCT;
+}
+
+/**
+ * @brief Combines current rule weight with the next antecedent degree of membership.
+ */
+static inline float FIS_CombineDegree(FIS_LogicType logic_type, float weight, float degree)
+{
+    switch (logic_type) 
+    {
+        case FIS_AND_PRODUCT:
+            return weight * degree;
+        case FIS_AND_MIN:
+            return (degree < weight) ? degree : weight;
+        case FIS_OR_MAX:
+            return (degree > weight) ? degree : weight;
+        case FIS_OR_PROB_SUM:
+            return weight + degree - (weight * degree);
+    }
+    return weight;
+}
+
+/**
+ * @brief First-order (linear) consequent: y = p1*x1 + ... + pn*xn + p0.
+ *
+ * @param[in] coefficients  Array of num_inputs + 1 coefficients {p1, ..., pn, p0}
+ *                          (order of MATLAB linear output MF parameters).
+ * @param[in] inputs        Array of crisp input values.
+ * @param[in] num_inputs    Number of inputs.
+ */
+static inline float FIS_LinearConsequent(const float* coefficients, const float* inputs, int num_inputs)
+{
+    float output = 0.0f;
+
+    for (int i = 0; i < num_inputs; ++i)
+        output += coefficients[i] * inputs[i];
+
+    return output + coefficients[num_inputs];
+}
+
+/**
+ * @brief Triangular membership function (inlinable body of FIS_MF_TriangularEval()).
+ */
+static inline float FIS_MF_Triangular(float input, const FIS_MF_TriangularParams* p)
+{
+    float output = 0.0;
+
+    if (input < p->a || input > p->c)
+        output = 0.0f;
+    else if (input == p->b)
+        output =1.0f;
+    else if (input < p->b)
+        output = (input - p->a) / (p->b - p->a);
+    else // input > p->b
+        output = (p->c - input) / (p->c - p->b);
+
+    if (output > 1.0f)
+        output = 1.0f;
+    else if (output < 0.0f)
+        output = 0.0f;
+
+    return output;
+}
+
+/**
+ * @brief Trapezoidal membership function (inlinable body of FIS_MF_TrapezoidalEval()).
+ */
+static inline float FIS_MF_Trapezoidal(float input, const FIS_MF_TrapezoidalParams* p)
+{
+    float output = 0.0;
+
+    if (input < p->a || input > p->d)
+         output = 0.0f;
+    else if (input >= p->b && input <= p->c)
+        output = 1.0f;
+    else if (input > p->a && input < p->b)
+        output = (input - p->a) / (p->b - p->a);
+    else // input > p->c && input < p->d
+        output = (p->d - input) / (p->d - p->c);
+
+    if (output > 1.0f)
+        output = 1.0f;
+    else if (output < 0.0f)
+        output = 0.0f;
+
+    return output;
+}
+
 /* Public function prototypes ------------------------------------------------*/
 /**
  * @brief Evaluates a single membership function for a given input value.
@@ -138,9 +289,11 @@ void FIS_FuzzifyInput(float input, FIS_MembershipFunction** mf_array, int mf_cou
 
 /**
  * @brief Evaluates a single fuzzy rule, including computing rule weight and weighted output.
+ *        The consequent is not evaluated for rules with zero firing strength.
  *
  * @param[in]  rule              Pointer to the rule to be evaluated.
- * @param[in]  input_degrees     2D array of fuzzified degrees for all inputs and their MFs.
+ * @param[in]  input_degrees     2D array of fuzzified degrees for all inputs and their MFs
+ *                               (input_count <= FIS_MAX_INPUTS; FIS_Workspace has no such limit).
  * @param[in]  inputs            Original crisp input values.
  * @param[in]  input_count       Number of inputs in the system.
  * @return                       Struct containing rule weight and weighted output.
@@ -158,6 +311,11 @@ float FIS_DefuzzifyOutput(FIS_RuleOutput* rule_output, int rule_count);
 
 /**
  * @brief Main evaluation function for a complete Sugeno-type fuzzy inference system.
+ *        Systems up to FIS_MAX_INPUTS inputs with FIS_MAX_MFS MFs each fuzzify into a
+ *        table on the stack; larger ones (any number of inputs, MFs and rules) evaluate
+ *        memberships per antecedent term instead. No rule outputs are stored and
+ *        nothing is allocated. For large rule bases FIS_EvaluateReentrant() with an
+ *        arena workspace avoids the repeated membership evaluations.
  *
  * @param[in] fis       Pointer to the FIS system definition.
  * @param[in] inputs    Array of crisp input values.
@@ -165,6 +323,109 @@ float FIS_DefuzzifyOutput(FIS_RuleOutput* rule_output, int rule_count);
  */
 float FIS_Evaluate(FIS_System* fis, float* inputs);
 
+/**
+ * @brief Reentrant evaluation of a complete Sugeno-type fuzzy inference system.
+ *        All intermediate results are kept in the caller-owned workspace, so
+ *        any number of threads may evaluate the same FIS at the same time.
+ *
+ * @param[in]     fis       Pointer to the FIS system definition.
+ * @param[in]     inputs    Array of crisp input values.
+ * @param[in,out] ws        Workspace created for this FIS with FIS_Workspace_Create().
+ * @return                  Final crisp output after inference and defuzzification.
+ */
+float FIS_EvaluateReentrant(const FIS_System* fis, const float* inputs, FIS_Workspace* ws);
+
+/**
+ * @brief Evaluates a Sugeno FIS for a batch of samples.
+ *        Inputs are passed in structure-of-arrays layout: inputs[i][s] is the value
+ *        of input i for sample s. Samples are processed in blocks of FIS_BATCH_BLOCK,
+ *        each stage running as a tight loop over the block. Results are identical
+ *        to calling FIS_Evaluate() for every sample. Systems larger than the stack
+ *        tables (see FIS_Evaluate()) need FIS_EvaluateBatchReentrant(); outputs are
+ *        not written for them.
+ *
+ * @param[in]  fis       Pointer to the FIS system definition.
+ * @param[in]  inputs    Array of fis->num_inputs pointers to input columns.
+ * @param[out] outputs   Array of `count` crisp output values.
+ * @param[in]  count     Number of samples.
+ */
+void FIS_EvaluateBatch(FIS_System* fis, const float* const* inputs, float* outputs, int count);
+
+/**
+ * @brief FIS_EvaluateBatch() for systems of any size, with the degrees of a block
+ *        and the samples passed to consequent functions kept in the workspace.
+ *        Results are identical to FIS_EvaluateBatch().
+ *
+ * @param[in]     fis       Pointer to the FIS system definition.
+ * @param[in]     inputs    Array of fis->num_inputs pointers to input columns.
+ * @param[out]    outputs   Array of `count` crisp output values.
+ * @param[in]     count     Number of samples.
+ * @param[in,out] ws        Workspace created for this FIS with FIS_BatchWorkspace_Create().
+ */
+void FIS_EvaluateBatchReentrant(const FIS_System* fis, const float* const* inputs, float* outputs, int count, FIS_BatchWorkspace* ws);
+
+/* Public function prototypes - memory management ----------------------------*/
+/**
+ * @brief Initializes an arena over a caller-supplied memory block.
+ *
+ * @param[out] arena    Arena to be initialized.
+ * @param[in]  buffer   Memory block (static, stack or heap).
+ * @param[in]  size     Size of the memory block in bytes.
+ */
+void FIS_Arena_Init(FIS_Arena* arena, void* buffer, size_t size);
+
+/**
+ * @brief Allocates an aligned block from the arena.
+ *
+ * @param[in,out] arena   Arena to allocate from.
+ * @param[in]     size    Requested size in bytes.
+ * @param[in]     align   Requested alignment (power of two).
+ * @return                Pointer to the block or NULL if the arena is exhausted.
+ */
+void* FIS_Arena_Alloc(FIS_Arena* arena, size_t size, size_t align);
+
+/**
+ * @brief Releases all blocks allocated from the arena in O(1).
+ *
+ * @param[in,out] arena   Arena to be reset.
+ */
+void FIS_Arena_Reset(FIS_Arena* arena);
+
+/**
+ * @brief Computes the arena space needed by FIS_Workspace_Create() for a given FIS.
+ *
+ * @param[in] fis       Pointer to the FIS system definition.
+ * @return              Size in bytes (including alignment padding).
+ */
+size_t FIS_Workspace_Size(const FIS_System* fis);
+
+/**
+ * @brief Creates an evaluation workspace for a given FIS.
+ *
+ * @param[in]     fis     Pointer to the FIS system definition.
+ * @param[in,out] arena   Arena with at least FIS_Workspace_Size() bytes available.
+ * @return                Pointer to the workspace or NULL if the arena is exhausted.
+ */
+FIS_Workspace* FIS_Workspace_Create(const FIS_System* fis, FIS_Arena* arena);
+
+/**
+ * @brief Computes the arena space needed by FIS_BatchWorkspace_Create() for a given FIS.
+ *
+ * @param[in] fis       Pointer to the FIS system definition.
+ * @return              Size in bytes (including alignment padding).
+ */
+size_t FIS_BatchWorkspace_Size(const FIS_System* fis);
+
+/**
+ * @brief Creates a batch evaluation workspace for a given FIS.
+ *
+ * @param[in]     fis     Pointer to the FIS system definition.
+ * @param[in,out] arena   Arena with at least FIS_BatchWorkspace_Size() bytes available.
+ * @return                Pointer to the workspace or NULL if the arena is exhausted
+ *                        (arena left unchanged).
+ */
+FIS_BatchWorkspace* FIS_BatchWorkspace_Create(const FIS_System* fis, FIS_Arena* arena);
+
 /* Public function prototypes - membership functions evaluation --------------*/
 /**
  * @brief Triangular membership function evaluation implementation.
@@ -184,4 +445,8 @@ float FIS_MF_TriangularEval(float input, void* params);
  */
 float FIS_MF_TrapezoidalEval(float input, void* params);
   
+#ifdef __cplusplus
+}
+#endif
+
 #endif /* INC_FIS_SUGENO_H_ */
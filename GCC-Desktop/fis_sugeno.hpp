@@ -0,0 +1,198 @@
+/**
+  ******************************************************************************
+  * @file		: fis_sugeno.hpp
+  * @author  	: AW		Adrian.Wojcik@put.poznan.pl
+  * @version 	: 1.0.0
+  * @date    	: Oct 17, 2026
+  * @brief   	: Takagi-Sugeno-Kang (Sugeno) Fuzzy Inference System for
+  *               embedded control systems
+  *               C++17 header-only layer: FIS structure (inputs, MF types, rules,
+  *               logic operators) as template parameters and constexpr data, so
+  *               evaluation is fully unrolled and inlined without indirect calls
+  *
+  ******************************************************************************
+  */
+
+#ifndef INC_FIS_SUGENO_HPP_
+#define INC_FIS_SUGENO_HPP_
+
+/* Public includes -----------------------------------------------------------*/
+#include <array>
+#include <cstddef>
+#include <tuple>
+#include <utility>
+#include "fis_sugeno.h"
+
+namespace fis
+{
+
+/* Public typedef - membership functions -------------------------------------*/
+/**
+ * @brief Triangular membership function (same arithmetic as FIS_MF_TriangularEval()).
+ */
+struct Triangular
+{
+    FIS_MF_TriangularParams params;
+
+    float operator()(float input) const noexcept
+    {
+        return FIS_MF_Triangular(input, &params);
+    }
+};
+
+/**
+ * @brief Trapezoidal membership function (same arithmetic as FIS_MF_TrapezoidalEval()).
+ */
+struct Trapezoidal
+{
+    FIS_MF_TrapezoidalParams params;
+
+    float operator()(float input) const noexcept
+    {
+        return FIS_MF_Trapezoidal(input, &params);
+    }
+};
+
+/* Public typedef - rules ----------------------------------------------------*/
+/**
+ * @brief Antecedent term: "input(Input) is mf". Any callable float(float) can be used as MF.
+ */
+template <std::size_t Input, typename MF>
+struct Term
+{
+    static constexpr std::size_t input = Input;
+    MF mf;
+};
+
+/**
+ * @brief Linear consequent y = p1*x1 + ... + pn*xn + p0, coefficients {p1, ..., pn, p0}
+ *        (same summation order as FIS_LinearConsequent()).
+ */
+template <std::size_t NumInputs>
+struct Linear
+{
+    std::array<float, NumInputs + 1> coefficients;
+
+    float operator()(const float* inputs) const noexcept
+    {
+        return evaluate(inputs, std::make_index_sequence<NumInputs>{});
+    }
+
+private:
+    template <std::size_t... I>
+    float evaluate(const float* inputs, std::index_sequence<I...>) const noexcept
+    {
+        float output = 0.0f;
+        ((output += coefficients[I] * inputs[I]), ...);
+        return output + coefficients[NumInputs];
+    }
+};
+
+/**
+ * @brief Rule: logic operator, consequent (any callable float(const float*)) and
+ *        antecedent terms. AND rules stop at the first zero degree, as FIS_EvaluateRule().
+ */
+template <FIS_LogicType Logic, typename Consequent, typename... Terms>
+struct Rule
+{
+    Consequent consequent;
+    std::tuple<Terms...> terms;
+
+    float weight(const float* inputs) const noexcept
+    {
+        float w = FIS_InitialWeight(Logic);
+
+        std::apply([&](const auto&... term) {
+            if constexpr (Logic == FIS_AND_MIN || Logic == FIS_AND_PRODUCT)
+                (void)(((w = FIS_CombineDegree(Logic, w, term.mf(inputs[term.input]))) == 0.0f) || ...);
+            else
+                ((w = FIS_CombineDegree(Logic, w, term.mf(inputs[term.input]))), ...);
+        }, terms);
+
+        return w;
+    }
+};
+
+/* Public typedef - system ---------------------------------------------------*/
+/**
+ * @brief Sugeno FIS with NumInputs inputs and a fixed set of rules; weighted average
+ *        defuzzification. Results match FIS_Evaluate() of the equivalent FIS_System.
+ */
+template <std::size_t NumInputs, typename... Rules>
+struct System
+{
+    static constexpr std::size_t num_inputs = NumInputs;
+    static constexpr std::size_t num_rules = sizeof...(Rules);
+
+    std::tuple<Rules...> rules;
+
+    float operator()(const float* inputs) const noexcept
+    {
+        float numerator = 0.0f;
+        float denominator = 0.0f;
+
+        std::apply([&](const auto&... rule) {
+            (accumulate(rule, inputs, numerator, denominator), ...);
+        }, rules);
+
+        if (denominator == 0.0f)
+            return 0.0f;
+
+        return numerator / denominator;
+    }
+
+    float operator()(const std::array<float, NumInputs>& inputs) const noexcept
+    {
+        return (*this)(inputs.data());
+    }
+
+private:
+    template <typename R>
+    static void accumulate(const R& rule, const float* inputs, float& numerator, float& denominator) noexcept
+    {
+        const float weight = rule.weight(inputs);
+        const float output = (weight == 0.0f) ? 0.0f : weight * rule.consequent(inputs);
+
+        numerator += output;
+        denominator += weight;
+    }
+};
+
+/* Public functions - constexpr builders -------------------------------------*/
+constexpr Triangular triangular(float a, float b, float c)
+{
+    return Triangular{ { a, b, c } };
+}
+
+constexpr Trapezoidal trapezoidal(float a, float b, float c, float d)
+{
+    return Trapezoidal{ { a, b, c, d } };
+}
+
+template <std::size_t Input, typename MF>
+constexpr Term<Input, MF> term(MF mf)
+{
+    return Term<Input, MF>{ mf };
+}
+
+template <typename... P>
+constexpr Linear<sizeof...(P) - 1> linear(P... coefficients)
+{
+    return Linear<sizeof...(P) - 1>{ { { static_cast<float>(coefficients)... } } };
+}
+
+template <FIS_LogicType Logic, typename Consequent, typename... Terms>
+constexpr Rule<Logic, Consequent, Terms...> rule(Consequent consequent, Terms... terms)
+{
+    return Rule<Logic, Consequent, Terms...>{ consequent, { terms... } };
+}
+
+template <std::size_t NumInputs, typename... Rules>
+constexpr System<NumInputs, Rules...> system(Rules... rules)
+{
+    return System<NumInputs, Rules...>{ { rules... } };
+}
+
+} // namespace fis
+
+#endif /* INC_FIS_SUGENO_HPP_ */
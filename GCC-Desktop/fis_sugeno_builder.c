@@ -0,0 +1,358 @@
+/**
+  ******************************************************************************
+  * @file		: fis_sugeno_builder.c
+  * @author  	: AW		Adrian.Wojcik@put.poznan.pl
+  * @version 	: 1.0.0
+  * @date    	: Oct 17, 2026
+  * @brief   	: Takagi-Sugeno-Kang (Sugeno) Fuzzy Inference System for
+  *               embedded control systems
+  *               Programmatic FIS builder: inputs, MFs and rules are recorded
+  *               in a scratch arena, the finished FIS_System is laid out in a
+  *               single arena allocation
+  *
+  ******************************************************************************
+  */
+
+/* Private includes ----------------------------------------------------------*/
+#include <string.h>
+#include "fis_sugeno_builder.h"
+
+/* Private typedef -----------------------------------------------------------*/
+struct FIS_BuilderInput
+{
+    FIS_BuilderInput* next;
+    int num_mfs;
+};
+
+struct FIS_BuilderMF
+{
+    FIS_BuilderMF* next;
+    int input;
+    int index;                          // position within the input
+    FIS_MF_Eval eval;
+    const void* params;                 // custom MFs: caller-owned parameters
+    FIS_MF_TrapezoidalParams values;    // triangular/trapezoidal MFs: copied parameters
+};
+
+struct FIS_BuilderRule
+{
+    FIS_BuilderRule* next;
+    int* mf_indices;
+    FIS_LogicType logic_type;
+    float* coefficients;
+    FIS_ConsequentFunction consequent;
+};
+
+/* Private functions ---------------------------------------------------------*/
+static size_t FIS_Builder_AlignUp(size_t size)
+{
+    return (size + FIS_ARENA_ALIGN - 1) & ~(size_t)(FIS_ARENA_ALIGN - 1);
+}
+
+/**
+ * @brief Carves the next table out of the block laid out by FIS_Builder_Finalize().
+ */
+static void* FIS_Builder_Take(unsigned char* block, size_t* offset, size_t size)
+{
+    void* table = block + *offset;
+    *offset += FIS_Builder_AlignUp(size);
+    return table;
+}
+
+/**
+ * @brief Allocates a record from the scratch arena; a failure is sticky.
+ */
+static void* FIS_Builder_Record(FIS_Builder* builder, size_t size)
+{
+    void* record = builder->error ? NULL : FIS_Arena_Alloc(builder->scratch, size, FIS_ARENA_ALIGN);
+    if (record == NULL)
+        builder->error = 1;
+    return record;
+}
+
+static FIS_BuilderInput* FIS_Builder_FindInput(const FIS_Builder* builder, int input)
+{
+    FIS_BuilderInput* record = builder->inputs;
+    for (int i = 0; record != NULL && i < input; ++i)
+        record = record->next;
+    return record;
+}
+
+static FIS_BuilderRule* FIS_Builder_FindRule(const FIS_Builder* builder, int rule)
+{
+    if (rule < 0 || rule >= builder->num_rules)
+        return NULL;
+
+    // Consequents are usually set right after AddRule()
+    if (rule == builder->num_rules - 1)
+        return builder->last_rule;
+
+    FIS_BuilderRule* record = builder->rules;
+    for (int r = 0; r < rule; ++r)
+        record = record->next;
+    return record;
+}
+
+/* Public functions ----------------------------------------------------------*/
+void FIS_Builder_Init(FIS_Builder* builder, FIS_Arena* scratch)
+{
+    memset(builder, 0, sizeof(FIS_Builder));
+    builder->scratch = scratch;
+}
+
+int FIS_Builder_AddInput(FIS_Builder* builder)
+{
+    // Antecedents are stored per input: the input count is fixed by the first rule
+    if (builder->num_rules > 0)
+        builder->error = 1;
+
+    FIS_BuilderInput* record = FIS_Builder_Record(builder, sizeof(FIS_BuilderInput));
+    if (record == NULL)
+        return -1;
+
+    record->next = NULL;
+    record->num_mfs = 0;
+    if (builder->last_input != NULL)
+        builder->last_input->next = record;
+    else
+        builder->inputs = record;
+    builder->last_input = record;
+    return builder->num_inputs++;
+}
+
+int FIS_Builder_AddMF(FIS_Builder* builder, int input, FIS_MF_Eval eval, const void* params)
+{
+    FIS_BuilderInput* owner = FIS_Builder_FindInput(builder, input);
+    if (input < 0 || owner == NULL || (eval != NULL && params == NULL))
+        builder->error = 1;
+
+    FIS_BuilderMF* record = FIS_Builder_Record(builder, sizeof(FIS_BuilderMF));
+    if (record == NULL)
+        return -1;
+
+    memset(record, 0, sizeof(FIS_BuilderMF));
+    record->input = input;
+    record->index = owner->num_mfs++;
+    record->eval = eval;
+    record->params = params;
+
+    if (eval == FIS_MF_TriangularEval)
+    {
+        const FIS_MF_TriangularParams* p = params;
+        record->values = (FIS_MF_TrapezoidalParams){ .a = p->a, .b = p->b, .c = p->c, .d = 0.0f };
+        builder->num_triangular++;
+    }
+    else if (eval == FIS_MF_TrapezoidalEval)
+    {
+        record->values = *(const FIS_MF_TrapezoidalParams*)params;
+        builder->num_trapezoidal++;
+    }
+
+    if (builder->last_mf != NULL)
+        builder->last_mf->next = record;
+    else
+        builder->mfs = record;
+    builder->last_mf = record;
+    builder->num_mfs++;
+    return record->index;
+}
+
+int FIS_Builder_AddRule(FIS_Builder* builder, FIS_LogicType logic_type, const int* mf_indices)
+{
+    if (logic_type < FIS_AND_MIN || logic_type > FIS_OR_PROB_SUM)
+        builder->error = 1;
+
+    // Every antecedent term must reference an existing MF
+    const FIS_BuilderInput* input = builder->inputs;
+    for (int i = 0; i < builder->num_inputs; ++i, input = input->next)
+        if (mf_indices[i] >= input->num_mfs)
+            builder->error = 1;
+
+    FIS_BuilderRule* record = FIS_Builder_Record(builder, sizeof(FIS_BuilderRule));
+    int* indices = FIS_Builder_Record(builder, sizeof(int) * (builder->num_inputs > 0 ? builder->num_inputs : 1));
+    if (record == NULL || indices == NULL)
+        return -1;
+
+    for (int i = 0; i < builder->num_inputs; ++i)
+        indices[i] = (mf_indices[i] < 0) ? -1 : mf_indices[i];
+
+    *record = (FIS_BuilderRule){ .next = NULL, .mf_indices = indices, .logic_type = logic_type,
+                                 .coefficients = NULL, .consequent = NULL };
+    if (builder->last_rule != NULL)
+        builder->last_rule->next = record;
+    else
+        builder->rules = record;
+    builder->last_rule = record;
+    return builder->num_rules++;
+}
+
+int FIS_Builder_SetConsequentLinear(FIS_Builder* builder, int rule, const float* coefficients)
+{
+    FIS_BuilderRule* record = FIS_Builder_FindRule(builder, rule);
+    if (record == NULL)
+    {
+        builder->error = 1;
+        return 0;
+    }
+
+    if (record->coefficients == NULL)
+    {
+        record->coefficients = FIS_Builder_Record(builder, sizeof(float) * (builder->num_inputs + 1));
+        if (record->coefficients == NULL)
+            return 0;
+        builder->num_linear++;
+    }
+
+    memcpy(record->coefficients, coefficients, sizeof(float) * (builder->num_inputs + 1));
+    record->consequent = NULL;
+    return 1;
+}
+
+int FIS_Builder_SetConsequentFunction(FIS_Builder* builder, int rule, FIS_ConsequentFunction consequent)
+{
+    FIS_BuilderRule* record = FIS_Builder_FindRule(builder, rule);
+    if (record == NULL || consequent == NULL)
+    {
+        builder->error = 1;
+        return 0;
+    }
+
+    // A linear consequent set before is dropped (its scratch copy stays unused)
+    if (record->coefficients != NULL)
+        builder->num_linear--;
+    record->coefficients = NULL;
+    record->consequent = consequent;
+    return 1;
+}
+
+int FIS_Builder_AddSystem(FIS_Builder* builder, const FIS_System* fis)
+{
+    if (builder->num_inputs > 0 || builder->num_rules > 0)
+    {
+        builder->error = 1;
+        return 0;
+    }
+
+    for (int i = 0; i < fis->num_inputs; ++i)
+    {
+        FIS_Builder_AddInput(builder);
+        for (int m = 0; m < fis->num_mfs_per_input[i]; ++m)
+        {
+            const FIS_MembershipFunction* mf = fis->input_mfs[i][m];
+            FIS_Builder_AddMF(builder, i, (mf != NULL) ? mf->eval : NULL, (mf != NULL) ? mf->params : NULL);
+        }
+    }
+
+    for (int r = 0; r < fis->num_rules && !builder->error; ++r)
+    {
+        const FIS_Rule* rule = &fis->rules[r];
+        const int index = FIS_Builder_AddRule(builder, rule->logic_type, rule->mf_indices);
+
+        if (rule->coefficients != NULL)
+            FIS_Builder_SetConsequentLinear(builder, index, rule->coefficients);
+        else
+            FIS_Builder_SetConsequentFunction(builder, index, rule->consequent);
+    }
+
+    return !builder->error;
+}
+
+size_t FIS_Builder_Size(const FIS_Builder* builder)
+{
+    const size_t num_inputs = builder->num_inputs;
+    const size_t num_mfs = builder->num_mfs;
+    const size_t num_rules = builder->num_rules;
+
+    return FIS_Builder_AlignUp(sizeof(FIS_System))
+         + FIS_Builder_AlignUp(sizeof(int) * num_inputs)
+         + FIS_Builder_AlignUp(sizeof(FIS_MembershipFunction**) * num_inputs)
+         + FIS_Builder_AlignUp(sizeof(FIS_MembershipFunction*) * num_mfs)
+         + FIS_Builder_AlignUp(sizeof(FIS_MembershipFunction) * num_mfs)
+         + FIS_Builder_AlignUp(sizeof(FIS_MF_TriangularParams) * builder->num_triangular)
+         + FIS_Builder_AlignUp(sizeof(FIS_MF_TrapezoidalParams) * builder->num_trapezoidal)
+         + FIS_Builder_AlignUp(sizeof(FIS_Rule) * num_rules)
+         + FIS_Builder_AlignUp(sizeof(int) * num_rules * num_inputs)
+         + FIS_Builder_AlignUp(sizeof(float) * builder->num_linear * (num_inputs + 1))
+         + FIS_ARENA_ALIGN - 1;
+}
+
+FIS_System* FIS_Builder_Finalize(const FIS_Builder* builder, FIS_Arena* arena)
+{
+    if (builder->error)
+        return NULL;
+
+    for (const FIS_BuilderRule* record = builder->rules; record != NULL; record = record->next)
+        if (record->coefficients == NULL && record->consequent == NULL)
+            return NULL;
+
+    // One block, tables in evaluation order
+    const size_t size = FIS_Builder_Size(builder) - (FIS_ARENA_ALIGN - 1);
+    unsigned char* block = FIS_Arena_Alloc(arena, size, FIS_ARENA_ALIGN);
+    if (block == NULL)
+        return NULL;
+
+    const int num_inputs = builder->num_inputs;
+    size_t offset = 0;
+
+    FIS_System* fis = FIS_Builder_Take(block, &offset, sizeof(FIS_System));
+    int* num_mfs_per_input = FIS_Builder_Take(block, &offset, sizeof(int) * num_inputs);
+    FIS_MembershipFunction*** input_mfs = FIS_Builder_Take(block, &offset, sizeof(FIS_MembershipFunction**) * num_inputs);
+    FIS_MembershipFunction** mf_table = FIS_Builder_Take(block, &offset, sizeof(FIS_MembershipFunction*) * builder->num_mfs);
+    FIS_MembershipFunction* mfs = FIS_Builder_Take(block, &offset, sizeof(FIS_MembershipFunction) * builder->num_mfs);
+    FIS_MF_TriangularParams* triangular = FIS_Builder_Take(block, &offset, sizeof(FIS_MF_TriangularParams) * builder->num_triangular);
+    FIS_MF_TrapezoidalParams* trapezoidal = FIS_Builder_Take(block, &offset, sizeof(FIS_MF_TrapezoidalParams) * builder->num_trapezoidal);
+    FIS_Rule* rules = FIS_Builder_Take(block, &offset, sizeof(FIS_Rule) * builder->num_rules);
+    int* mf_indices = FIS_Builder_Take(block, &offset, sizeof(int) * (size_t)builder->num_rules * num_inputs);
+    float* coefficients = FIS_Builder_Take(block, &offset, sizeof(float) * (size_t)builder->num_linear * (num_inputs + 1));
+
+    // Inputs: MF pointer rows of the shared table
+    const FIS_BuilderInput* input = builder->inputs;
+    for (int i = 0, first = 0; i < num_inputs; first += input->num_mfs, ++i, input = input->next)
+    {
+        num_mfs_per_input[i] = input->num_mfs;
+        input_mfs[i] = &mf_table[first];
+    }
+
+    // Membership functions in the order they were added
+    int k = 0;
+    for (const FIS_BuilderMF* record = builder->mfs; record != NULL; record = record->next, ++k)
+    {
+        FIS_MembershipFunction* mf = &mfs[k];
+        mf->eval = record->eval;
+
+        if (record->eval == FIS_MF_TriangularEval)
+        {
+            *triangular = (FIS_MF_TriangularParams){ .a = record->values.a, .b = record->values.b, .c = record->values.c };
+            mf->params = triangular++;
+        }
+        else if (record->eval == FIS_MF_TrapezoidalEval)
+        {
+            *trapezoidal = record->values;
+            mf->params = trapezoidal++;
+        }
+        else
+            mf->params = (void*)record->params;
+
+        input_mfs[record->input][record->index] = (record->eval != NULL) ? mf : NULL;
+    }
+
+    // Rules with their antecedents and linear consequents
+    int r = 0;
+    for (const FIS_BuilderRule* record = builder->rules; record != NULL; record = record->next, ++r)
+    {
+        memcpy(&mf_indices[r * num_inputs], record->mf_indices, sizeof(int) * num_inputs);
+        rules[r] = (FIS_Rule){ .mf_indices = &mf_indices[r * num_inputs], .consequent = record->consequent,
+                               .logic_type = record->logic_type, .coefficients = NULL };
+
+        if (record->coefficients != NULL)
+        {
+            memcpy(coefficients, record->coefficients, sizeof(float) * (num_inputs + 1));
+            rules[r].coefficients = coefficients;
+            coefficients += num_inputs + 1;
+        }
+    }
+
+    *fis = (FIS_System){ .num_inputs = num_inputs, .num_mfs_per_input = num_mfs_per_input,
+                         .input_mfs = input_mfs, .rules = rules, .num_rules = builder->num_rules };
+    return fis;
+}
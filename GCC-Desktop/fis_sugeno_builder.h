@@ -0,0 +1,153 @@
+/**
+  ******************************************************************************
+  * @file		: fis_sugeno_builder.h
+  * @author  	: AW		Adrian.Wojcik@put.poznan.pl
+  * @version 	: 1.0.0
+  * @date    	: Oct 17, 2026
+  * @brief   	: Takagi-Sugeno-Kang (Sugeno) Fuzzy Inference System for
+  *               embedded control systems
+  *               Programmatic FIS builder: inputs, MFs and rules are recorded
+  *               in a scratch arena, the finished FIS_System is laid out in a
+  *               single arena allocation
+  *
+  ******************************************************************************
+  */
+
+#ifndef INC_FIS_SUGENO_BUILDER_H_
+#define INC_FIS_SUGENO_BUILDER_H_
+
+/* Public includes -----------------------------------------------------------*/
+#include <stddef.h>
+#include "fis_sugeno.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Public typedef ------------------------------------------------------------*/
+typedef struct FIS_BuilderInput FIS_BuilderInput;
+typedef struct FIS_BuilderMF FIS_BuilderMF;
+typedef struct FIS_BuilderRule FIS_BuilderRule;
+
+/**
+ * @brief FIS under construction. Records live in the scratch arena until
+ *        FIS_Builder_Finalize(); the builder itself holds lists and counters only.
+ */
+typedef struct
+{
+    FIS_Arena* scratch;
+    int num_inputs;
+    int num_mfs;
+    int num_triangular;         // MFs whose parameters are copied into the system
+    int num_trapezoidal;
+    int num_rules;
+    int num_linear;
+    int error;                  // sticky: set by the first failed call, checked by FIS_Builder_Finalize()
+    FIS_BuilderInput* inputs;
+    FIS_BuilderInput* last_input;
+    FIS_BuilderMF* mfs;
+    FIS_BuilderMF* last_mf;
+    FIS_BuilderRule* rules;
+    FIS_BuilderRule* last_rule;
+} FIS_Builder;
+
+/* Public function prototypes ------------------------------------------------*/
+/**
+ * @brief Starts an empty FIS. Reuse the builder for another FIS by resetting the
+ *        scratch arena and calling FIS_Builder_Init() again.
+ *
+ * @param[out]    builder   Builder to be initialized.
+ * @param[in,out] scratch   Arena receiving the records (not needed after FIS_Builder_Finalize()).
+ */
+void FIS_Builder_Init(FIS_Builder* builder, FIS_Arena* scratch);
+
+/**
+ * @brief Adds an input. All inputs must be added before the first rule.
+ *
+ * @param[in,out] builder   Builder.
+ * @return                  Index of the input or -1 on error.
+ */
+int FIS_Builder_AddInput(FIS_Builder* builder);
+
+/**
+ * @brief Adds a membership function to an input. Parameters of FIS_MF_TriangularEval
+ *        (FIS_MF_TriangularParams) and FIS_MF_TrapezoidalEval (FIS_MF_TrapezoidalParams)
+ *        are copied into the system; other functions keep the `params` pointer as is.
+ *
+ * @param[in,out] builder   Builder.
+ * @param[in]     input     Index returned by FIS_Builder_AddInput().
+ * @param[in]     eval      Membership function (NULL: degree -1, as a NULL MF pointer).
+ * @param[in]     params    Parameters of `eval`.
+ * @return                  Index of the MF within the input or -1 on error.
+ */
+int FIS_Builder_AddMF(FIS_Builder* builder, int input, FIS_MF_Eval eval, const void* params);
+
+/**
+ * @brief Adds a rule. The consequent is set with FIS_Builder_SetConsequentLinear()
+ *        or FIS_Builder_SetConsequentFunction().
+ *
+ * @param[in,out] builder      Builder.
+ * @param[in]     logic_type   Antecedent connective.
+ * @param[in]     mf_indices   MF index per input (-1: input not in the antecedent), copied.
+ * @return                     Index of the rule or -1 on error.
+ */
+int FIS_Builder_AddRule(FIS_Builder* builder, FIS_LogicType logic_type, const int* mf_indices);
+
+/**
+ * @brief Sets a linear consequent; the coefficients are copied into the system.
+ *        Setting the last added rule takes constant time.
+ *
+ * @param[in,out] builder        Builder.
+ * @param[in]     rule           Index returned by FIS_Builder_AddRule().
+ * @param[in]     coefficients   {p1, ..., pn, p0}, n = number of inputs.
+ * @return                       1 on success, 0 on error.
+ */
+int FIS_Builder_SetConsequentLinear(FIS_Builder* builder, int rule, const float* coefficients);
+
+/**
+ * @brief Sets a consequent function (kept by pointer).
+ *
+ * @param[in,out] builder      Builder.
+ * @param[in]     rule         Index returned by FIS_Builder_AddRule().
+ * @param[in]     consequent   Consequent function.
+ * @return                     1 on success, 0 on error.
+ */
+int FIS_Builder_SetConsequentFunction(FIS_Builder* builder, int rule, FIS_ConsequentFunction consequent);
+
+/**
+ * @brief Adds all inputs, MFs and rules of an existing FIS to an empty builder
+ *        (e.g. to compact a FIS declared with static arrays into one block).
+ *
+ * @param[in,out] builder   Empty builder.
+ * @param[in]     fis       Pointer to the FIS system definition.
+ * @return                  1 on success, 0 on error.
+ */
+int FIS_Builder_AddSystem(FIS_Builder* builder, const FIS_System* fis);
+
+/**
+ * @brief Measures the arena space FIS_Builder_Finalize() needs (including alignment).
+ *
+ * @param[in] builder   Builder.
+ * @return              Size in bytes.
+ */
+size_t FIS_Builder_Size(const FIS_Builder* builder);
+
+/**
+ * @brief Lays out the FIS in one arena allocation: system, MF tables, copied
+ *        parameters, rules, antecedents and coefficients, in this order. The
+ *        system holds no pointers outside the block (except custom MF parameters
+ *        and consequent functions), so it is released in O(1) by resetting or
+ *        rewinding the arena.
+ *
+ * @param[in]     builder   Builder (unchanged; may be finalized again).
+ * @param[in,out] arena     Arena receiving the FIS.
+ * @return                  Pointer to the FIS or NULL if a call failed, a rule has no
+ *                          consequent or the arena is exhausted.
+ */
+FIS_System* FIS_Builder_Finalize(const FIS_Builder* builder, FIS_Arena* arena);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* INC_FIS_SUGENO_BUILDER_H_ */
@@ -0,0 +1,321 @@
+/**
+  ******************************************************************************
+  * @file		: fis_sugeno_codegen.c
+  * @author  	: AW		Adrian.Wojcik@put.poznan.pl
+  * @version 	: 1.0.0
+  * @date    	: Oct 17, 2026
+  * @brief   	: Takagi-Sugeno-Kang (Sugeno) Fuzzy Inference System for
+  *               embedded control systems
+  *               C code generator: FIS_System emitted as a specialized,
+  *               straight-line C function
+  *
+  ******************************************************************************
+  */
+
+/* Private includes ----------------------------------------------------------*/
+#include <math.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "fis_sugeno_codegen.h"
+
+/* Private typedef -----------------------------------------------------------*/
+/**
+ * @brief Output buffer with snprintf() semantics: `length` counts everything
+ *        emitted, only the first `size - 1` characters are stored.
+ */
+typedef struct
+{
+    char* buffer;
+    size_t size;
+    size_t length;
+} FIS_CodegenOutput;
+
+/* Private functions ---------------------------------------------------------*/
+static void FIS_Codegen_Printf(FIS_CodegenOutput* out, const char* format, ...)
+{
+    char* dst = NULL;
+    size_t available = 0;
+    va_list args;
+
+    if (out->length < out->size)
+    {
+        dst = out->buffer + out->length;
+        available = out->size - out->length;
+    }
+
+    va_start(args, format);
+    int n = vsnprintf(dst, available, format, args);
+    va_end(args);
+
+    if (n > 0)
+        out->length += (size_t)n;
+}
+
+/**
+ * @brief Formats a float as a C literal that converts back to the same value.
+ */
+static const char* FIS_Codegen_Float(char* literal, float value)
+{
+    int n = 0;
+
+    // Shortest representation which converts back exactly (9 digits always do)
+    for (int digits = 6; digits <= 9; ++digits)
+    {
+        n = snprintf(literal, 32, "%.*g", digits, (double)value);
+        if (strtof(literal, NULL) == value)
+            break;
+    }
+
+    // "%g" may drop both the decimal point and the exponent ("3", "1e+03" is fine)
+    if (strpbrk(literal, ".e") == NULL)
+        strcpy(literal + n, ".0");
+    strcat(literal, "f");
+    return literal;
+}
+
+/**
+ * @brief Formats `x - a` as " - a" / " + |a|" (same result in IEEE arithmetic), or
+ *        nothing for a == 0.
+ */
+static const char* FIS_Codegen_Shift(char* text, float a)
+{
+    char literal[32];
+
+    if (a == 0.0f)
+        text[0] = '\0';
+    else
+        snprintf(text, 40, " %c %s", (a < 0.0f) ? '+' : '-', FIS_Codegen_Float(literal, fabsf(a)));
+    return text;
+}
+
+/**
+ * @brief Emits `mu<i>_<m> = <degree of membership>;` with the branches of
+ *        FIS_MF_Triangular()/FIS_MF_Trapezoidal() for constant parameters.
+ *        Branches which cannot be taken and no-op clamps are left out.
+ */
+static int FIS_Codegen_EmitMF(FIS_CodegenOutput* out, const FIS_MembershipFunction* mf, int i, int m)
+{
+    char a[32], b[32], c[32], d[32], w[32], shift[40];
+
+    if (mf == NULL)
+    {
+        FIS_Codegen_Printf(out, "\n    const float mu%d_%d = -1.0f; // no MF\n", i, m);
+        return 1;
+    }
+
+    if (mf->eval == FIS_MF_TriangularEval)
+    {
+        const FIS_MF_TriangularParams* p = (const FIS_MF_TriangularParams*)mf->params;
+        if (!isfinite(p->a) || !isfinite(p->c) || !(p->a <= p->b && p->b <= p->c))
+            return 0;
+
+        FIS_Codegen_Float(a, p->a);
+        FIS_Codegen_Float(b, p->b);
+        FIS_Codegen_Float(c, p->c);
+
+        FIS_Codegen_Printf(out, "\n    /* input %d, MF %d: triangular(%s, %s, %s) */\n", i, m, a, b, c);
+        FIS_Codegen_Printf(out, "    float mu%d_%d;\n", i, m);
+        FIS_Codegen_Printf(out, "    if (x%d < %s || x%d > %s)\n        mu%d_%d = 0.0f;\n", i, a, i, c, i, m);
+        FIS_Codegen_Printf(out, "    else if (x%d == %s)\n        mu%d_%d = 1.0f;\n", i, b, i, m);
+        if (p->a < p->b)
+            FIS_Codegen_Printf(out, "    else if (x%d < %s)\n        mu%d_%d = (x%d%s) / %s;\n",
+                               i, b, i, m, i, FIS_Codegen_Shift(shift, p->a), FIS_Codegen_Float(w, p->b - p->a));
+        if (p->b < p->c)
+            FIS_Codegen_Printf(out, "    else\n        mu%d_%d = (%s - x%d) / %s;\n",
+                               i, m, c, i, FIS_Codegen_Float(w, p->c - p->b));
+        else
+            FIS_Codegen_Printf(out, "    else\n        mu%d_%d = x%d;\n", i, m, i); // NaN only
+        return 1;
+    }
+
+    if (mf->eval == FIS_MF_TrapezoidalEval)
+    {
+        const FIS_MF_TrapezoidalParams* p = (const FIS_MF_TrapezoidalParams*)mf->params;
+        if (!isfinite(p->a) || !isfinite(p->d) || !(p->a <= p->b && p->b <= p->c && p->c <= p->d))
+            return 0;
+
+        FIS_Codegen_Float(a, p->a);
+        FIS_Codegen_Float(b, p->b);
+        FIS_Codegen_Float(c, p->c);
+        FIS_Codegen_Float(d, p->d);
+
+        FIS_Codegen_Printf(out, "\n    /* input %d, MF %d: trapezoidal(%s, %s, %s, %s) */\n", i, m, a, b, c, d);
+        FIS_Codegen_Printf(out, "    float mu%d_%d;\n", i, m);
+        FIS_Codegen_Printf(out, "    if (x%d < %s || x%d > %s)\n        mu%d_%d = 0.0f;\n", i, a, i, d, i, m);
+        FIS_Codegen_Printf(out, "    else if (x%d >= %s && x%d <= %s)\n        mu%d_%d = 1.0f;\n", i, b, i, c, i, m);
+        if (p->a < p->b)
+        {
+            // x == a falls through to the right slope in FIS_MF_Trapezoidal() and is clamped to 1
+            FIS_Codegen_Printf(out, "    else if (x%d == %s)\n        mu%d_%d = 1.0f;\n", i, a, i, m);
+            FIS_Codegen_Printf(out, "    else if (x%d < %s)\n        mu%d_%d = (x%d%s) / %s;\n",
+                               i, b, i, m, i, FIS_Codegen_Shift(shift, p->a), FIS_Codegen_Float(w, p->b - p->a));
+        }
+        if (p->c < p->d)
+            FIS_Codegen_Printf(out, "    else\n        mu%d_%d = (%s - x%d) / %s;\n",
+                               i, m, d, i, FIS_Codegen_Float(w, p->d - p->c));
+        else
+            FIS_Codegen_Printf(out, "    else\n        mu%d_%d = x%d;\n", i, m, i); // NaN only
+        return 1;
+    }
+
+    return 0;
+}
+
+/**
+ * @brief Emits the weight of rule r (FIS_EvaluateRuleRows(): AND rules stop at zero).
+ */
+static void FIS_Codegen_EmitWeight(FIS_CodegenOutput* out, const FIS_System* fis, const FIS_Rule* rule, int r)
+{
+    const int conjunction = FIS_IsConjunction(rule->logic_type);
+    char w[32];
+    int first = 1;
+
+    // The first antecedent combines with the neutral element as a constant
+    snprintf(w, sizeof(w), "%s", conjunction ? "1.0f" : "0.0f");
+
+    for (int i = 0; i < fis->num_inputs; ++i)
+    {
+        const int m = rule->mf_indices[i];
+        if (m < 0)
+            continue;
+
+        if (first)
+            FIS_Codegen_Printf(out, "    float w%d = ", r);
+        else if (conjunction)
+            FIS_Codegen_Printf(out, "    if (w%d != 0.0f)\n        w%d = ", r, r);
+        else
+            FIS_Codegen_Printf(out, "    w%d = ", r);
+
+        switch (rule->logic_type)
+        {
+            case FIS_AND_PRODUCT:
+                FIS_Codegen_Printf(out, "%s * mu%d_%d;\n", w, i, m);
+                break;
+            case FIS_AND_MIN:
+                FIS_Codegen_Printf(out, "(mu%d_%d < %s) ? mu%d_%d : %s;\n", i, m, w, i, m, w);
+                break;
+            case FIS_OR_MAX:
+                FIS_Codegen_Printf(out, "(mu%d_%d > %s) ? mu%d_%d : %s;\n", i, m, w, i, m, w);
+                break;
+            case FIS_OR_PROB_SUM:
+                FIS_Codegen_Printf(out, "%s + mu%d_%d - (%s * mu%d_%d);\n", w, i, m, w, i, m);
+                break;
+        }
+
+        snprintf(w, sizeof(w), "w%d", r);
+        first = 0;
+    }
+
+    // No antecedents: constant weight
+    if (first)
+        FIS_Codegen_Printf(out, "    const float w%d = %s;\n", r, w);
+}
+
+/**
+ * @brief Emits the weighted consequent of rule r (FIS_LinearConsequent() order,
+ *        zero coefficients left out).
+ */
+static void FIS_Codegen_EmitConsequent(FIS_CodegenOutput* out, const FIS_Rule* rule, int num_inputs, int r)
+{
+    char p[32];
+    int terms = 0;
+
+    FIS_Codegen_Printf(out, "    if (w%d != 0.0f)\n    {\n", r);
+    for (int i = 0; i < num_inputs; ++i)
+    {
+        if (rule->coefficients[i] == 0.0f)
+            continue;
+
+        FIS_Codegen_Printf(out, terms == 0 ? "        float y%d = %s * x%d;\n" : "        y%d += %s * x%d;\n",
+                           r, FIS_Codegen_Float(p, rule->coefficients[i]), i);
+        ++terms;
+    }
+    if (terms == 0)
+        FIS_Codegen_Printf(out, "        float y%d = 0.0f;\n", r);
+    if (rule->coefficients[num_inputs] != 0.0f)
+        FIS_Codegen_Printf(out, "        y%d += %s;\n", r, FIS_Codegen_Float(p, rule->coefficients[num_inputs]));
+    FIS_Codegen_Printf(out, "        numerator += w%d * y%d;\n    }\n", r, r);
+}
+
+/**
+ * @brief Checks whether any rule references MF m of input i.
+ */
+static int FIS_Codegen_MFUsed(const FIS_System* fis, int i, int m)
+{
+    for (int r = 0; r < fis->num_rules; ++r)
+        if (fis->rules[r].mf_indices[i] == m)
+            return 1;
+    return 0;
+}
+
+/**
+ * @brief Checks whether input i appears in any antecedent or linear consequent.
+ */
+static int FIS_Codegen_InputUsed(const FIS_System* fis, int i)
+{
+    for (int r = 0; r < fis->num_rules; ++r)
+        if (fis->rules[r].mf_indices[i] >= 0 || fis->rules[r].coefficients[i] != 0.0f)
+            return 1;
+    return 0;
+}
+
+/* Public functions ----------------------------------------------------------*/
+size_t FIS_Codegen_Emit(const FIS_System* fis, const char* function_name, char* buffer, size_t size)
+{
+    FIS_CodegenOutput out = { .buffer = buffer, .size = size, .length = 0 };
+
+    if (size > 0)
+        buffer[0] = '\0';
+
+    // Only linear consequents can be inlined
+    for (int r = 0; r < fis->num_rules; ++r)
+    {
+        const FIS_Rule* rule = &fis->rules[r];
+        if (rule->coefficients == NULL)
+            return 0;
+
+        for (int i = 0; i < fis->num_inputs; ++i)
+        {
+            const int m = rule->mf_indices[i];
+            if (m >= fis->num_mfs_per_input[i])
+                return 0;
+        }
+    }
+
+    FIS_Codegen_Printf(&out, "/* Generated by sugeno_codegen: %d inputs, %d rules. Do not edit. */\n",
+                       fis->num_inputs, fis->num_rules);
+    FIS_Codegen_Printf(&out, "float %s(const float* inputs)\n{\n", function_name);
+
+    for (int i = 0; i < fis->num_inputs; ++i)
+        if (FIS_Codegen_InputUsed(fis, i))
+            FIS_Codegen_Printf(&out, "    const float x%d = inputs[%d];\n", i, i);
+
+    // Fuzzification step: referenced MFs only
+    for (int i = 0; i < fis->num_inputs; ++i)
+        for (int m = 0; m < fis->num_mfs_per_input[i]; ++m)
+            if (FIS_Codegen_MFUsed(fis, i, m) && !FIS_Codegen_EmitMF(&out, fis->input_mfs[i][m], i, m))
+                return 0;
+
+    // Rules: weights, then consequents of firing rules
+    FIS_Codegen_Printf(&out, "\n    float numerator = 0.0f;\n");
+    for (int r = 0; r < fis->num_rules; ++r)
+    {
+        FIS_Codegen_Printf(&out, "\n    /* rule %d */\n", r);
+        FIS_Codegen_EmitWeight(&out, fis, &fis->rules[r], r);
+        FIS_Codegen_EmitConsequent(&out, &fis->rules[r], fis->num_inputs, r);
+    }
+
+    // Defuzzification: weighted average
+    FIS_Codegen_Printf(&out, "\n    const float denominator = ");
+    for (int r = 0; r < fis->num_rules; ++r)
+        FIS_Codegen_Printf(&out, r == 0 ? "w%d" : " + w%d", r);
+    if (fis->num_rules == 0)
+        FIS_Codegen_Printf(&out, "0.0f");
+    FIS_Codegen_Printf(&out, ";\n");
+    FIS_Codegen_Printf(&out, "    if (denominator == 0.0f)\n        return 0.0f;\n\n");
+    FIS_Codegen_Printf(&out, "    return numerator / denominator;\n}\n");
+
+    return out.length;
+}
@@ -0,0 +1,50 @@
+/**
+  ******************************************************************************
+  * @file		: fis_sugeno_codegen.h
+  * @author  	: AW		Adrian.Wojcik@put.poznan.pl
+  * @version 	: 1.0.0
+  * @date    	: Oct 17, 2026
+  * @brief   	: Takagi-Sugeno-Kang (Sugeno) Fuzzy Inference System for
+  *               embedded control systems
+  *               C code generator: FIS_System emitted as a specialized,
+  *               straight-line C function
+  *
+  ******************************************************************************
+  */
+
+#ifndef INC_FIS_SUGENO_CODEGEN_H_
+#define INC_FIS_SUGENO_CODEGEN_H_
+
+/* Public includes -----------------------------------------------------------*/
+#include <stddef.h>
+#include "fis_sugeno.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Public function prototypes ------------------------------------------------*/
+/**
+ * @brief Emits C source of `float function_name(const float* inputs)` evaluating the FIS.
+ *        MFs, rules and linear consequents are inlined with constants folded; unused
+ *        inputs and MFs, -1 antecedents and zero coefficients are removed. Floating-point
+ *        operations keep the order of FIS_Evaluate(), so results are identical for finite
+ *        inputs (unless the target compiler contracts multiply-adds); a non-finite input
+ *        with a zero coefficient no longer turns the output into NaN.
+ *
+ * @param[in]  fis            Pointer to the FIS system definition. Only triangular and
+ *                            trapezoidal MFs and linear (coefficient) consequents are supported.
+ * @param[in]  function_name  Name of the generated function.
+ * @param[out] buffer         Output buffer (NUL-terminated, truncated as with snprintf()).
+ *                            May be NULL if `size` is 0.
+ * @param[in]  size           Size of the buffer in bytes.
+ * @return                    Length of the complete source (excluding NUL), or 0 if the
+ *                            FIS is not supported.
+ */
+size_t FIS_Codegen_Emit(const FIS_System* fis, const char* function_name, char* buffer, size_t size);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* INC_FIS_SUGENO_CODEGEN_H_ */
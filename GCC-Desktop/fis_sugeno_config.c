@@ -15,6 +15,17 @@
 #include <stddef.h>
 #include "fis_sugeno.h"
 
+/* Private variables ---------------------------------------------------------*/
+/* Linear consequents of the *_InitLinear() variants: {p1, ..., pn, p0} (float) */
+/*                                      x[0]        x[1]       x[2]      x[3]     x[4]  x[5]  const */
+static const float K0_coefficients[] = {  -0.5456f,  108.3730f,   4.0827f,  0.5456f,  1.0912f, 0.0f, 0.0f };
+static const float K1_coefficients[] = { -16.9129f,  423.9900f, 194.2168f, 16.9129f, 33.8259f, 0.0f, 0.0f };
+static const float K2_coefficients[] = { -43.6463f, 1080.2933f, 786.3601f, 43.6463f, 87.2925f, 0.0f, 0.0f };
+
+/*                                                  x[0]                 x[1]                x[2]              x[3]             x[4]        const */
+static const float PID_GA_coefficients[] = {          4.772f,            -4.772f, 31189.5424836601f, 0.1087128408f, -0.4213676f, 0.0f };
+static const float PID_PP_coefficients[] = { 85.1622936535121f, -85.1622936535121f, 2972.72484560811f,          0.0f,         0.0f, 0.0f };
+
 /* Private functions ---------------------------------------------------------*/
 float K0(const float* x) 
 {
@@ -41,6 +52,22 @@ float PID_PP(const float* x)
     return 85.1622936535121 * x[0] + (-85.1622936535121) * x[1] + 2972.72484560811 * x[2] + 0 * x[3] + 0 * x[4]  + 0;
 }
 
+/**
+ * @brief Copies a reference FIS with rule r taking the linear consequent coefficients[r].
+ */
+static void FIS_Config_Linearize(const FIS_System* reference, const float* const* coefficients, FIS_Rule* rules, FIS_System* fis)
+{
+    for (int r = 0; r < reference->num_rules; ++r)
+    {
+        rules[r] = reference->rules[r];
+        rules[r].consequent = NULL;
+        rules[r].coefficients = coefficients[r];
+    }
+
+    *fis = *reference;
+    fis->rules = rules;
+}
+
 /* Public functions ----------------------------------------------------------*/
 void FIS_InvertedPendulumController_Init(FIS_System** fis)
 {
@@ -70,9 +97,9 @@ void FIS_InvertedPendulumController_Init(FIS_System** fis)
     static int rule2_indices[] = { -1, -1, -1, -1, -1, 2 }; // if input(5) is mf2
 
     static FIS_Rule rules[] = {
-        { rule0_indices, K0, FIS_AND_MIN }, // if input(5) is mf0 then K0 
-        { rule1_indices, K1, FIS_AND_MIN }, // if input(5) is mf1 then K1 
-        { rule2_indices, K2, FIS_AND_MIN }  // if input(5) is mf2 then K2
+        { rule0_indices, K0, FIS_AND_MIN, NULL }, // if input(5) is mf0 then K0 
+        { rule1_indices, K1, FIS_AND_MIN, NULL }, // if input(5) is mf1 then K1 
+        { rule2_indices, K2, FIS_AND_MIN, NULL }  // if input(5) is mf2 then K2
     };
 
     static FIS_System _fis = {
@@ -113,9 +140,9 @@ void FIS_PMSM_SpeedController_Init(FIS_System** fis)
     static int rule2_indices[] = { -1, -1, -1,  2, -1 }; // if input(3) is mf_negative
 
     static FIS_Rule rules[] = {
-        { rule0_indices, PID_PP, FIS_AND_MIN }, // if input(3) is mf_positive then PID_PP
-        { rule1_indices, PID_GA, FIS_AND_MIN }, // if input(3) is mf_static then PID_GA
-        { rule2_indices, PID_PP, FIS_AND_MIN }  // if input(3) is mf_negative then PID_PP
+        { rule0_indices, PID_PP, FIS_AND_MIN, NULL }, // if input(3) is mf_positive then PID_PP
+        { rule1_indices, PID_GA, FIS_AND_MIN, NULL }, // if input(3) is mf_static then PID_GA
+        { rule2_indices, PID_PP, FIS_AND_MIN, NULL }  // if input(3) is mf_negative then PID_PP
     };
 
     static FIS_System _fis = {
@@ -127,4 +154,30 @@ void FIS_PMSM_SpeedController_Init(FIS_System** fis)
     };
 
     *fis = &_fis;
-}
\ No newline at end of file
+}
+
+void FIS_InvertedPendulumController_InitLinear(FIS_System** fis)
+{
+    static const float* const coefficients[] = { K0_coefficients, K1_coefficients, K2_coefficients };
+    static FIS_Rule rules[3];
+    static FIS_System _fis;
+    FIS_System* reference;
+
+    FIS_InvertedPendulumController_Init(&reference);
+    FIS_Config_Linearize(reference, coefficients, rules, &_fis);
+
+    *fis = &_fis;
+}
+
+void FIS_PMSM_SpeedController_InitLinear(FIS_System** fis)
+{
+    static const float* const coefficients[] = { PID_PP_coefficients, PID_GA_coefficients, PID_PP_coefficients };
+    static FIS_Rule rules[3];
+    static FIS_System _fis;
+    FIS_System* reference;
+
+    FIS_PMSM_SpeedController_Init(&reference);
+    FIS_Config_Linearize(reference, coefficients, rules, &_fis);
+
+    *fis = &_fis;
+}
@@ -17,6 +17,10 @@
   /* Public includes -----------------------------------------------------------*/
   #include "fis_sugeno.h"
   
+  #ifdef __cplusplus
+  extern "C" {
+  #endif
+
   /* Public typedef ------------------------------------------------------------*/
   
   /* Public define -------------------------------------------------------------*/
@@ -29,5 +33,15 @@
   void FIS_InvertedPendulumController_Init(FIS_System** fis);
   void FIS_PMSM_SpeedController_Init(FIS_System** fis);
 
+  /* Same controllers with float coefficient arrays (FIS_Rule::coefficients) instead of
+     the double-precision consequent functions: compiled plans, code generator, binary
+     images and Lipschitz bounds need linear consequents */
+  void FIS_InvertedPendulumController_InitLinear(FIS_System** fis);
+  void FIS_PMSM_SpeedController_InitLinear(FIS_System** fis);
+
+  #ifdef __cplusplus
+  }
+  #endif
+
   #endif /* INC_FIS_SUGENO_CONFIG_H_ */
   
\ No newline at end of file
@@ -0,0 +1,55 @@
+/**
+  ******************************************************************************
+  * @file		: fis_sugeno_config.hpp
+  * @author  	: AW		Adrian.Wojcik@put.poznan.pl
+  * @version 	: 1.0.0
+  * @date    	: Oct 17, 2026
+  * @brief   	: Takagi-Sugeno-Kang (Sugeno) Fuzzy Inference System for
+  *               embedded control systems
+  *               Configuration file: compile-time FIS definitions (C++17),
+  *               equivalent to 'fis_sugeno_config.c'
+  *
+  ******************************************************************************
+  */
+
+#ifndef INC_FIS_SUGENO_CONFIG_HPP_
+#define INC_FIS_SUGENO_CONFIG_HPP_
+
+/* Public includes -----------------------------------------------------------*/
+#include "fis_sugeno.hpp"
+
+namespace fis::config
+{
+
+/* Public variables ----------------------------------------------------------*/
+/* Linear consequents: {p1, ..., pn, p0} */
+/*                                     x[0]       x[1]      x[2]     x[3]     x[4]  x[5]  const */
+inline constexpr auto K0 = linear(  -0.5456f,  108.3730f,   4.0827f,  0.5456f,  1.0912f, 0.0f, 0.0f);
+inline constexpr auto K1 = linear( -16.9129f,  423.9900f, 194.2168f, 16.9129f, 33.8259f, 0.0f, 0.0f);
+inline constexpr auto K2 = linear( -43.6463f, 1080.2933f, 786.3601f, 43.6463f, 87.2925f, 0.0f, 0.0f);
+
+/*                                                 x[0]                 x[1]                x[2]              x[3]         x[4]        const */
+inline constexpr auto PID_GA = linear(          4.772f,            -4.772f, 31189.5424836601f, 0.1087128408f, -0.4213676f, 0.0f);
+inline constexpr auto PID_PP = linear(85.1622936535121f, -85.1622936535121f, 2972.72484560811f,          0.0f,         0.0f, 0.0f);
+
+/**
+ * @brief Inverted pendulum controller (FIS_InvertedPendulumController_Init()).
+ */
+inline constexpr auto inverted_pendulum_controller = system<6>(
+    rule<FIS_AND_MIN>(K0, term<5>(triangular(0.1f, 0.1f, 3.1f))),  // if input(5) is mf0 then K0
+    rule<FIS_AND_MIN>(K1, term<5>(triangular(0.1f, 3.1f, 8.1f))),  // if input(5) is mf1 then K1
+    rule<FIS_AND_MIN>(K2, term<5>(triangular(3.1f, 8.1f, 8.1f)))   // if input(5) is mf2 then K2
+);
+
+/**
+ * @brief PMSM speed controller (FIS_PMSM_SpeedController_Init()).
+ */
+inline constexpr auto pmsm_speed_controller = system<5>(
+    rule<FIS_AND_MIN>(PID_PP, term<3>(trapezoidal(-5.0f, -5.0f, -0.2f, 0.0f))),  // if input(3) is mf_positive then PID_PP
+    rule<FIS_AND_MIN>(PID_GA, term<3>(triangular(-0.5f, 0.0f, 0.5f))),           // if input(3) is mf_static then PID_GA
+    rule<FIS_AND_MIN>(PID_PP, term<3>(trapezoidal(0.0f, 0.2f, 5.0f, 5.0f)))      // if input(3) is mf_negative then PID_PP
+);
+
+} // namespace fis::config
+
+#endif /* INC_FIS_SUGENO_CONFIG_HPP_ */
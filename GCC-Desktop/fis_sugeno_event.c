@@ -0,0 +1,353 @@
+/**
+  ******************************************************************************
+  * @file		: fis_sugeno_event.c
+  * @author  	: AW		Adrian.Wojcik@put.poznan.pl
+  * @version 	: 1.0.0
+  * @date    	: Oct 17, 2026
+  * @brief   	: Takagi-Sugeno-Kang (Sugeno) Fuzzy Inference System for
+  *               embedded control systems
+  *               Event-triggered evaluation: per-input Lipschitz bounds of a
+  *               compiled FIS decide when the previous output is still within
+  *               a tolerance
+  *
+  ******************************************************************************
+  */
+
+/* Private includes ----------------------------------------------------------*/
+#include <math.h>
+#include <string.h>
+#include "fis_sugeno_event.h"
+
+/* Private functions ---------------------------------------------------------*/
+/**
+ * @brief Shape points of a triangular (a, b, b, c) or trapezoidal (a, b, c, d) MF.
+ *
+ * @return  1 on success, 0 for other MF types.
+ */
+static int FIS_Event_Shape(const FIS_PlanMF* mf, float shape[4])
+{
+    if (mf->type == FIS_MF_TYPE_TRIANGULAR)
+    {
+        shape[0] = mf->params.tri.a;
+        shape[1] = mf->params.tri.b;
+        shape[2] = mf->params.tri.b;
+        shape[3] = mf->params.tri.c;
+        return 1;
+    }
+    if (mf->type == FIS_MF_TYPE_TRAPEZOIDAL)
+    {
+        shape[0] = mf->params.trap.a;
+        shape[1] = mf->params.trap.b;
+        shape[2] = mf->params.trap.c;
+        shape[3] = mf->params.trap.d;
+        return 1;
+    }
+    return 0;
+}
+
+/**
+ * @brief Continuous degree of a shape (no isolated jump at the left foot).
+ */
+static float FIS_Event_Degree(const float shape[4], float x)
+{
+    const float rising = (x >= shape[1]) ? 1.0f : (x <= shape[0]) ? 0.0f : (x - shape[0]) / (shape[1] - shape[0]);
+    const float falling = (x <= shape[2]) ? 1.0f : (x >= shape[3]) ? 0.0f : (shape[3] - x) / (shape[3] - shape[2]);
+    return fminf(rising, falling);
+}
+
+/**
+ * @brief Absolute slope of a shape just right of x.
+ */
+static float FIS_Event_RightSlope(const float shape[4], float x)
+{
+    if (x >= shape[0] && x < shape[1])
+        return 1.0f / (shape[1] - shape[0]);
+    if (x >= shape[2] && x < shape[3])
+        return 1.0f / (shape[3] - shape[2]);
+    return 0.0f;
+}
+
+/**
+ * @brief Number of rule antecedents referencing a degree slot.
+ */
+static int FIS_Event_SlotUses(const FIS_Plan* plan, int slot)
+{
+    const int32_t* terms = FIS_PLAN_TERMS(plan);
+    int uses = 0;
+
+    for (int t = 0; t < plan->num_terms; ++t)
+        uses += (terms[t] == slot);
+    return uses;
+}
+
+/**
+ * @brief Weighted degree sum S(x) = sum_m k_m * mu_m(x) of one input over [lower, upper]:
+ *        its extremes (S is piecewise linear, so they lie on shape points or box ends)
+ *        and the largest sum of absolute slopes. k_m: number of rules using MF m
+ *        (unit_weights: 1 for every MF).
+ *
+ * @return  1 on success; 0 for an MF without a shape or a vertical edge in the box.
+ */
+static int FIS_Event_InputProfile(const FIS_Plan* plan, int input, float lower, float upper, int unit_weights,
+                                  float* sum_min, float* sum_max, float* slope_max)
+{
+    const FIS_PlanInput* plan_input = &FIS_PLAN_INPUTS(plan)[input];
+    const FIS_PlanMF* mfs = &FIS_PLAN_MFS(plan)[plan_input->first_mf];
+    float shape[4];
+
+    for (int m = 0; m < plan_input->num_mfs; ++m)
+    {
+        if (!unit_weights && FIS_Event_SlotUses(plan, plan_input->first_mf + m) == 0)
+            continue;
+        if (!FIS_Event_Shape(&mfs[m], shape))
+            return 0;
+
+        // Vertical edges: 0 left of a == b but 1 at it, 1 at c == d but 0 right of it
+        if ((shape[0] == shape[1] && shape[0] > lower && shape[0] <= upper)
+            || (shape[2] == shape[3] && shape[3] >= lower && shape[3] < upper))
+            return 0;
+    }
+
+    *sum_min = INFINITY;
+    *sum_max = -INFINITY;
+    *slope_max = 0.0f;
+
+    // Candidate points: box ends, then shape points inside the box
+    for (int c = -2; c < 4 * plan_input->num_mfs; ++c)
+    {
+        float x = (c == -2) ? lower : upper;
+        if (c >= 0)
+        {
+            if (!FIS_Event_Shape(&mfs[c / 4], shape))
+                continue;
+            x = shape[c % 4];
+            if (!(x > lower && x < upper))
+                continue;
+        }
+
+        float sum = 0.0f;
+        float slope = 0.0f;
+        for (int m = 0; m < plan_input->num_mfs; ++m)
+        {
+            const int uses = unit_weights ? 1 : FIS_Event_SlotUses(plan, plan_input->first_mf + m);
+            if (uses == 0 || !FIS_Event_Shape(&mfs[m], shape))
+                continue;
+
+            sum += uses * FIS_Event_Degree(shape, x);
+            slope += uses * FIS_Event_RightSlope(shape, x);
+        }
+
+        *sum_min = fminf(*sum_min, sum);
+        *sum_max = fmaxf(*sum_max, sum);
+        if (x < upper)
+            *slope_max = fmaxf(*slope_max, slope);
+    }
+    return 1;
+}
+
+/* Public functions ----------------------------------------------------------*/
+int FIS_Event_LipschitzBounds(const FIS_Plan* plan, const float* lower, const float* upper, float* bounds)
+{
+    const FIS_PlanRule* rules = FIS_PLAN_RULES(plan);
+    const FIS_PlanInput* inputs = FIS_PLAN_INPUTS(plan);
+    const int tensor = (plan->flags & FIS_PLAN_FLAG_TENSOR) != 0;
+
+    if (plan->num_consequents > plan->num_linear)
+        return 0;
+
+    // Weight sum S: sum of per-input sums (rules with at most one antecedent) or
+    // product of per-input sums (AND_PRODUCT grid)
+    int single = 1;
+    float weight_sum_min = tensor ? 1.0f : 0.0f;
+    for (int r = 0; r < plan->num_rules; ++r)
+    {
+        single &= (rules[r].num_terms <= 1);
+        if (rules[r].num_terms == 0)
+            weight_sum_min += FIS_InitialWeight((FIS_LogicType)rules[r].logic_type);
+    }
+    if (!single && !tensor)
+        return 0;
+
+    float sum_max_product = 1.0f;
+    for (int i = 0; i < plan->num_inputs; ++i)
+    {
+        float sum_min, sum_max, slope_max;
+        bounds[i] = 0.0f;
+        if (inputs[i].num_mfs == 0)
+            continue;
+        if (!FIS_Event_InputProfile(plan, i, lower[i], upper[i], tensor, &sum_min, &sum_max, &slope_max))
+            return 0;
+
+        bounds[i] = slope_max;
+        if (tensor)
+        {
+            weight_sum_min *= sum_min;
+            sum_max_product *= sum_max;
+        }
+        else
+        {
+            weight_sum_min += sum_min;
+        }
+    }
+
+    if (!(weight_sum_min > 0.0f))
+        return 0;
+
+    // Grid: |dw_r/dx_i| = |mu_i'| * product of the other degrees, summed over rules
+    if (tensor)
+    {
+        for (int i = 0; i < plan->num_inputs; ++i)
+        {
+            float sum_min, sum_max, slope_max;
+            if (inputs[i].num_mfs > 0 && FIS_Event_InputProfile(plan, i, lower[i], upper[i], 1, &sum_min, &sum_max, &slope_max))
+                bounds[i] *= sum_max_product / sum_max;
+        }
+    }
+
+    // Range of the consequents over the box (interval arithmetic) and largest gains
+    const int32_t* columns = FIS_PLAN_COLUMNS(plan);
+    const float* matrix = FIS_PLAN_MATRIX(plan);
+    float output_min = INFINITY;
+    float output_max = -INFINITY;
+
+    for (int l = 0; l < plan->num_linear; ++l)
+    {
+        float low = 0.0f, high = 0.0f;
+        for (int c = 0; c < plan->num_columns; ++c)
+        {
+            const float coefficient = matrix[c * plan->linear_stride + l];
+            const int j = columns[c];
+            if (j == plan->num_inputs)
+            {
+                low += coefficient;
+                high += coefficient;
+                continue;
+            }
+
+            low += fminf(coefficient * lower[j], coefficient * upper[j]);
+            high += fmaxf(coefficient * lower[j], coefficient * upper[j]);
+        }
+        output_min = fminf(output_min, low);
+        output_max = fmaxf(output_max, high);
+    }
+
+    const float spread = (plan->num_linear > 0) ? (output_max - output_min) / weight_sum_min : 0.0f;
+    for (int i = 0; i < plan->num_inputs; ++i)
+        bounds[i] *= spread;
+
+    for (int c = 0; c < plan->num_columns; ++c)
+    {
+        if (columns[c] == plan->num_inputs)
+            continue;
+
+        float gain = 0.0f;
+        for (int l = 0; l < plan->num_linear; ++l)
+            gain = fmaxf(gain, fabsf(matrix[c * plan->linear_stride + l]));
+        bounds[columns[c]] += gain;
+    }
+    return 1;
+}
+
+size_t FIS_Event_Size(const FIS_Plan* plan)
+{
+    return sizeof(FIS_EventTrigger)
+         + FIS_Plan_WorkspaceSize(plan)
+         + sizeof(float) * 4 * plan->num_inputs
+         + sizeof(int32_t) * (plan->num_inputs + 1)
+         + sizeof(float) * plan->num_degrees
+         + 8 * (FIS_ARENA_ALIGN - 1);
+}
+
+FIS_EventTrigger* FIS_Event_Create(const FIS_Plan* plan, const float* lower, const float* upper, float tolerance, FIS_Arena* arena)
+{
+    const size_t mark = arena->used;
+    FIS_EventTrigger* trigger = FIS_Arena_Alloc(arena, sizeof(FIS_EventTrigger), FIS_ARENA_ALIGN);
+    FIS_PlanWorkspace* ws = FIS_Plan_CreateWorkspace(plan, arena);
+    float* box_lower = FIS_Arena_Alloc(arena, sizeof(float) * plan->num_inputs, FIS_ARENA_ALIGN);
+    float* box_upper = FIS_Arena_Alloc(arena, sizeof(float) * plan->num_inputs, FIS_ARENA_ALIGN);
+    float* lipschitz = FIS_Arena_Alloc(arena, sizeof(float) * plan->num_inputs, FIS_ARENA_ALIGN);
+    float* anchor = FIS_Arena_Alloc(arena, sizeof(float) * plan->num_inputs, FIS_ARENA_ALIGN);
+    int32_t* first_singular = FIS_Arena_Alloc(arena, sizeof(int32_t) * (plan->num_inputs + 1), FIS_ARENA_ALIGN);
+    float* singular = FIS_Arena_Alloc(arena, sizeof(float) * plan->num_degrees, FIS_ARENA_ALIGN);
+
+    if (trigger == NULL || ws == NULL || box_lower == NULL || box_upper == NULL || lipschitz == NULL
+        || anchor == NULL || first_singular == NULL || (singular == NULL && plan->num_degrees > 0)
+        || !FIS_Event_LipschitzBounds(plan, lower, upper, lipschitz))
+    {
+        arena->used = mark;
+        return NULL;
+    }
+
+    // Trapezoid left feet: 1 at x == a < b, 0 on both sides
+    const FIS_PlanInput* inputs = FIS_PLAN_INPUTS(plan);
+    const FIS_PlanMF* mfs = FIS_PLAN_MFS(plan);
+    int num_singular = 0;
+    for (int i = 0; i < plan->num_inputs; ++i)
+    {
+        first_singular[i] = num_singular;
+        for (int m = inputs[i].first_mf; m < inputs[i].first_mf + inputs[i].num_mfs; ++m)
+        {
+            const FIS_MF_TrapezoidalParams* trap = &mfs[m].params.trap;
+            if (mfs[m].type == FIS_MF_TYPE_TRAPEZOIDAL && trap->a < trap->b && trap->a >= lower[i] && trap->a <= upper[i])
+                singular[num_singular++] = trap->a;
+        }
+    }
+    first_singular[plan->num_inputs] = num_singular;
+
+    memcpy(box_lower, lower, sizeof(float) * plan->num_inputs);
+    memcpy(box_upper, upper, sizeof(float) * plan->num_inputs);
+
+    trigger->plan = plan;
+    trigger->ws = ws;
+    trigger->lower = box_lower;
+    trigger->upper = box_upper;
+    trigger->lipschitz = lipschitz;
+    trigger->first_singular = first_singular;
+    trigger->singular = singular;
+    trigger->anchor = anchor;
+    trigger->tolerance = tolerance;
+    trigger->output = 0.0f;
+    trigger->evaluations = 0;
+    trigger->skipped = 0;
+    FIS_Event_Invalidate(trigger);
+    return trigger;
+}
+
+float FIS_Event_Evaluate(FIS_EventTrigger* trigger, const float* inputs)
+{
+    const FIS_Plan* plan = trigger->plan;
+    int anchorable = 1;
+    float change = 0.0f;
+
+    trigger->evaluations++;
+
+    for (int i = 0; i < plan->num_inputs; ++i)
+    {
+        const float x = inputs[i];
+        if (!(x >= trigger->lower[i] && x <= trigger->upper[i]))
+        {
+            anchorable = 0;
+            break;
+        }
+        for (int k = trigger->first_singular[i]; k < trigger->first_singular[i + 1]; ++k)
+            anchorable &= (x != trigger->singular[k]);
+
+        change += trigger->lipschitz[i] * fabsf(x - trigger->anchor[i]);
+    }
+
+    if (trigger->valid && anchorable && change <= trigger->tolerance)
+    {
+        trigger->skipped++;
+        return trigger->output;
+    }
+
+    trigger->output = FIS_Plan_Evaluate(plan, inputs, trigger->ws);
+    memcpy(trigger->anchor, inputs, sizeof(float) * plan->num_inputs);
+    trigger->valid = anchorable;
+    return trigger->output;
+}
+
+void FIS_Event_Invalidate(FIS_EventTrigger* trigger)
+{
+    trigger->valid = 0;
+}
@@ -0,0 +1,118 @@
+/**
+  ******************************************************************************
+  * @file		: fis_sugeno_event.h
+  * @author  	: AW		Adrian.Wojcik@put.poznan.pl
+  * @version 	: 1.0.0
+  * @date    	: Oct 17, 2026
+  * @brief   	: Takagi-Sugeno-Kang (Sugeno) Fuzzy Inference System for
+  *               embedded control systems
+  *               Event-triggered evaluation: per-input Lipschitz bounds of a
+  *               compiled FIS decide when the previous output is still within
+  *               a tolerance
+  *
+  ******************************************************************************
+  */
+
+#ifndef INC_FIS_SUGENO_EVENT_H_
+#define INC_FIS_SUGENO_EVENT_H_
+
+/* Public includes -----------------------------------------------------------*/
+#include <stddef.h>
+#include <stdint.h>
+#include "fis_sugeno_plan.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Public typedef ------------------------------------------------------------*/
+/**
+ * @brief Event-triggered evaluator of one controller instance. The plan is evaluated
+ *        when sum_i lipschitz[i] * |x_i - anchor_i| exceeds the tolerance (or an input
+ *        leaves the operating box); otherwise the output at the anchor is returned.
+ */
+typedef struct
+{
+    const FIS_Plan* plan;
+    FIS_PlanWorkspace* ws;
+    float* lower;                   // [num_inputs]: operating box
+    float* upper;                   // [num_inputs]
+    float* lipschitz;               // [num_inputs]: bound of |dy/dx_i| over the box
+    int32_t* first_singular;        // [num_inputs + 1]: singular values of each input
+    float* singular;                // values where the MF definitions jump (always evaluated, never anchors)
+    float* anchor;                  // [num_inputs]: inputs of the last evaluation
+    float tolerance;
+    float output;                   // output at the anchor
+    int32_t valid;                  // 0: no anchor (new, invalidated, or last inputs outside the box)
+    uint32_t evaluations;           // calls
+    uint32_t skipped;               // calls answered with the output at the anchor
+} FIS_EventTrigger;
+
+/* Public function prototypes ------------------------------------------------*/
+/**
+ * @brief Per-input Lipschitz bounds of the output of a plan over an operating box:
+ *        |y(x) - y(x')| <= sum_i bounds[i] * |x_i - x'_i| for x, x' in the box.
+ *        bounds[i] = max_r |gain of x_i in rule r|
+ *                  + max_x sum_r |dw_r/dx_i| * (y_max - y_min) / S_min,
+ *        from the MF slopes, the interval range of the linear consequents and the
+ *        smallest weight sum S_min (rules with at most one antecedent, or
+ *        FIS_PLAN_FLAG_TENSOR grids). Isolated points where an MF definition jumps
+ *        (the left foot of a trapezoid) are excluded.
+ *
+ * @param[in]  plan      Pointer to the compiled plan.
+ * @param[in]  lower     Lower end of the box, per input.
+ * @param[in]  upper     Upper end of the box, per input.
+ * @param[out] bounds    Bound per input (0 for inputs the output does not depend on).
+ * @return               1 on success; 0 if the plan has custom MFs or consequent
+ *                       functions, other rule structures, a weight sum reaching zero
+ *                       or a vertical MF edge inside the box.
+ */
+int FIS_Event_LipschitzBounds(const FIS_Plan* plan, const float* lower, const float* upper, float* bounds);
+
+/**
+ * @brief Computes the arena space needed by FIS_Event_Create().
+ *
+ * @param[in] plan      Pointer to the compiled plan.
+ * @return              Size in bytes (including alignment padding).
+ */
+size_t FIS_Event_Size(const FIS_Plan* plan);
+
+/**
+ * @brief Creates an event-triggered evaluator (with its own plan workspace).
+ *
+ * @param[in]     plan        Pointer to the compiled plan (must stay valid).
+ * @param[in]     lower       Lower end of the operating box, per input (copied).
+ * @param[in]     upper       Upper end of the operating box, per input (copied).
+ * @param[in]     tolerance   Largest accepted difference from the evaluated output.
+ * @param[in,out] arena       Arena with at least FIS_Event_Size() bytes available.
+ * @return                    Pointer to the evaluator, or NULL if the Lipschitz bounds
+ *                            are not available (FIS_Event_LipschitzBounds()) or the
+ *                            arena is exhausted.
+ */
+FIS_EventTrigger* FIS_Event_Create(const FIS_Plan* plan, const float* lower, const float* upper, float tolerance, FIS_Arena* arena);
+
+/**
+ * @brief Returns the output at the anchor if the inputs are in the box, none is a
+ *        singular value and the Lipschitz bound of the change is within the
+ *        tolerance (trigger->skipped is counted); otherwise evaluates the plan with
+ *        FIS_Plan_Evaluate() and makes the inputs the new anchor.
+ *
+ * @param[in,out] trigger   Evaluator created with FIS_Event_Create().
+ * @param[in]     inputs    Array of crisp input values.
+ * @return                  Crisp output, within the tolerance of FIS_Plan_Evaluate()
+ *                          (up to float rounding).
+ */
+float FIS_Event_Evaluate(FIS_EventTrigger* trigger, const float* inputs);
+
+/**
+ * @brief Drops the anchor; the next call evaluates the plan.
+ *
+ * @param[in,out] trigger   Evaluator.
+ */
+void FIS_Event_Invalidate(FIS_EventTrigger* trigger);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* INC_FIS_SUGENO_EVENT_H_ */
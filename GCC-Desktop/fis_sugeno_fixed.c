@@ -0,0 +1,565 @@
+/**
+  ******************************************************************************
+  * @file		: fis_sugeno_fixed.c
+  * @author  	: AW		Adrian.Wojcik@put.poznan.pl
+  * @version 	: 1.0.0
+  * @date    	: Oct 17, 2026
+  * @brief   	: Takagi-Sugeno-Kang (Sugeno) Fuzzy Inference System for
+  *               embedded control systems
+  *               Fixed-point engine for integer-only cores: Q31 inputs and MF
+  *               parameters, Q15 degrees of membership, saturating t-norms and
+  *               integer weighted-average defuzzification
+  *
+  ******************************************************************************
+  */
+
+/* Private includes ----------------------------------------------------------*/
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include "fis_sugeno_fixed.h"
+
+/* Private define ------------------------------------------------------------*/
+#define FIS_FIXED_SLOPE_LIMIT   1073741824.0    // 2^30: slope mantissa bound
+#define FIS_FIXED_MAX_SHIFT     46              // (X - A) * S stays below 2^62 inside the slope
+#define FIS_FIXED_COEFF_LIMIT   2147483647.0    // 2^31 - 1: consequent coefficient bound
+#define FIS_FIXED_MAX_COEFF_SHIFT 31            // sum(C * X) + constant stays below 2^62
+
+/* Private functions ---------------------------------------------------------*/
+/**
+ * @brief Smallest exponent e with 2^e > range.
+ */
+static int FIS_Fixed_Exponent(double range)
+{
+    int exponent = 0;
+    double scale = 1.0;
+
+    if (range < 0.0)
+        range = -range;
+
+    while (scale <= range && exponent < 127)
+    {
+        scale *= 2.0;
+        ++exponent;
+    }
+    while (scale * 0.5 > range && exponent > -64 && range > 0.0)
+    {
+        scale *= 0.5;
+        --exponent;
+    }
+    return exponent;
+}
+
+/**
+ * @brief 2^exponent as double.
+ */
+static double FIS_Fixed_Pow2(int exponent)
+{
+    double value = 1.0;
+
+    for (int e = 0; e < exponent; ++e)
+        value *= 2.0;
+    for (int e = 0; e > exponent; --e)
+        value *= 0.5;
+    return value;
+}
+
+/**
+ * @brief Slope of FIS_Q15_ONE over `width` input LSBs as S * 2^-shift.
+ */
+static void FIS_Fixed_Slope(int64_t width, int32_t* slope, int32_t* shift)
+{
+    *slope = 0;
+    *shift = 0;
+    if (width <= 0)
+        return;     // degenerate edge, never evaluated
+
+    const double s = (double)FIS_Q15_ONE / (double)width;
+    double scaled = s;
+    int sh = 0;
+
+    while (scaled * 2.0 < FIS_FIXED_SLOPE_LIMIT && sh < FIS_FIXED_MAX_SHIFT)
+    {
+        scaled *= 2.0;
+        ++sh;
+    }
+    *slope = (int32_t)(scaled + 0.5);
+    *shift = sh;
+}
+
+/**
+ * @brief Saturates a value to the Q15 degree range.
+ */
+static inline FIS_Q15 FIS_Fixed_SaturateDegree(int64_t degree)
+{
+    if (degree > FIS_Q15_ONE)
+        return FIS_Q15_ONE;
+    if (degree < 0)
+        return 0;
+    return (FIS_Q15)degree;
+}
+
+/**
+ * @brief Saturates a value to the Q31 range.
+ */
+static inline FIS_Q31 FIS_Fixed_SaturateQ31(int64_t value)
+{
+    if (value > FIS_Q31_MAX)
+        return FIS_Q31_MAX;
+    if (value < FIS_Q31_MIN)
+        return FIS_Q31_MIN;
+    return (FIS_Q31)value;
+}
+
+/**
+ * @brief Fixed-point membership function; branches follow FIS_MF_Triangular() and
+ *        FIS_MF_Trapezoidal() (including the degree 1 of a trapezoid at x == a < b).
+ */
+static inline FIS_Q15 FIS_Fixed_MF(const FIS_FixedMF* mf, FIS_Q31 x)
+{
+    switch (mf->type)
+    {
+        case FIS_FIXED_MF_TRIANGULAR:
+            if (x < mf->a || x > mf->c)
+                return 0;
+            if (x == mf->b)
+                return FIS_Q15_ONE;
+            if (x < mf->b)
+                return FIS_Fixed_SaturateDegree(((int64_t)x - mf->a) * mf->rise_slope >> mf->rise_shift);
+            return FIS_Fixed_SaturateDegree(((int64_t)mf->c - x) * mf->fall_slope >> mf->fall_shift);
+
+        case FIS_FIXED_MF_TRAPEZOIDAL:
+            if (x < mf->a || x > mf->d)
+                return 0;
+            if (x >= mf->b && x <= mf->c)
+                return FIS_Q15_ONE;
+            if (x > mf->a && x < mf->b)
+                return FIS_Fixed_SaturateDegree(((int64_t)x - mf->a) * mf->rise_slope >> mf->rise_shift);
+            if (x > mf->c)
+                return FIS_Fixed_SaturateDegree(((int64_t)mf->d - x) * mf->fall_slope >> mf->fall_shift);
+            return FIS_Q15_ONE;     // x == a < b: (d - a) / (d - c) saturated
+
+        default:
+            return -FIS_Q15_ONE;
+    }
+}
+
+/**
+ * @brief Branch-free FIS_Fixed_MF() over an array (both slopes computed, result
+ *        selected); |X - A| * S < 2^62 for any Q31 input, so no overflow.
+ */
+static void FIS_Fixed_MFArray(const FIS_FixedMF* mf, const FIS_Q31* x, int32_t* degree, int n)
+{
+    const int64_t a = mf->a, b = mf->b, c = mf->c, d = mf->d;
+    const int64_t rise_slope = mf->rise_slope, fall_slope = mf->fall_slope;
+    const int rise_shift = mf->rise_shift, fall_shift = mf->fall_shift;
+
+    switch (mf->type)
+    {
+        case FIS_FIXED_MF_TRIANGULAR:
+            for (int s = 0; s < n; ++s)
+            {
+                const int64_t v = x[s];
+                int64_t rise = ((v - a) * rise_slope) >> rise_shift;
+                int64_t fall = ((c - v) * fall_slope) >> fall_shift;
+                rise = (rise > FIS_Q15_ONE) ? FIS_Q15_ONE : (rise < 0) ? 0 : rise;
+                fall = (fall > FIS_Q15_ONE) ? FIS_Q15_ONE : (fall < 0) ? 0 : fall;
+                const int64_t edge = (v < b) ? rise : fall;
+                degree[s] = (int32_t)((v < a || v > c) ? 0 : (v == b) ? FIS_Q15_ONE : edge);
+            }
+            break;
+
+        case FIS_FIXED_MF_TRAPEZOIDAL:
+            for (int s = 0; s < n; ++s)
+            {
+                const int64_t v = x[s];
+                int64_t rise = ((v - a) * rise_slope) >> rise_shift;
+                int64_t fall = ((d - v) * fall_slope) >> fall_shift;
+                rise = (rise > FIS_Q15_ONE) ? FIS_Q15_ONE : (rise < 0) ? 0 : rise;
+                fall = (fall > FIS_Q15_ONE) ? FIS_Q15_ONE : (fall < 0) ? 0 : fall;
+                const int64_t edge = (v > a && v < b) ? rise : (v > c) ? fall : FIS_Q15_ONE;
+                degree[s] = (int32_t)((v < a || v > d) ? 0 : edge);
+            }
+            break;
+
+        default:
+            for (int s = 0; s < n; ++s)
+                degree[s] = -FIS_Q15_ONE;
+            break;
+    }
+}
+
+/**
+ * @brief Neutral weight of the rule logic operator.
+ */
+static inline int32_t FIS_Fixed_InitialWeight(int32_t logic_type)
+{
+    return FIS_IsConjunction((FIS_LogicType)logic_type) ? FIS_Q15_ONE : 0;
+}
+
+/**
+ * @brief Saturating Q15 t-norms / s-norms.
+ */
+static inline int32_t FIS_Fixed_CombineDegree(int32_t logic_type, int32_t weight, int32_t degree)
+{
+    switch (logic_type)
+    {
+        case FIS_AND_PRODUCT:
+            return (weight * degree + (1 << 14)) >> 15;
+        case FIS_AND_MIN:
+            return (degree < weight) ? degree : weight;
+        case FIS_OR_MAX:
+            return (degree > weight) ? degree : weight;
+        case FIS_OR_PROB_SUM:
+        {
+            const int32_t sum = weight + degree - ((weight * degree + (1 << 14)) >> 15);
+            return (sum > FIS_Q15_ONE) ? FIS_Q15_ONE : sum;
+        }
+    }
+    return weight;
+}
+
+/**
+ * @brief Linear consequent of a rule in the Q31 format of the output.
+ */
+static inline FIS_Q31 FIS_Fixed_Consequent(const FIS_FixedSystem* fis, int r, const FIS_Q31* inputs)
+{
+    const FIS_FixedRule* rule = &fis->rules[r];
+    const int32_t* coefficients = &fis->coefficients[r * fis->num_inputs];
+    int64_t sum = rule->constant;
+
+    for (int i = 0; i < fis->num_inputs; ++i)
+        sum += (int64_t)coefficients[i] * inputs[i];
+
+    const int64_t round = (rule->shift > 0) ? (int64_t)1 << (rule->shift - 1) : 0;
+    return FIS_Fixed_SaturateQ31((sum + round) >> rule->shift);
+}
+
+/**
+ * @brief Weighted average with rounding to nearest.
+ */
+static inline FIS_Q31 FIS_Fixed_Defuzzify(int64_t numerator, int64_t denominator)
+{
+    if (denominator == 0)
+        return 0;
+    if (denominator < 0)
+    {
+        numerator = -numerator;
+        denominator = -denominator;
+    }
+
+    const int64_t half = denominator / 2;
+    return FIS_Fixed_SaturateQ31((numerator >= 0) ? (numerator + half) / denominator : (numerator - half) / denominator);
+}
+
+/* Public functions ----------------------------------------------------------*/
+size_t FIS_Fixed_Size(const FIS_System* fis)
+{
+    int num_mfs = 0;
+    int num_terms = 0;
+
+    for (int i = 0; i < fis->num_inputs; ++i)
+        num_mfs += fis->num_mfs_per_input[i];
+    for (int r = 0; r < fis->num_rules; ++r)
+        for (int i = 0; i < fis->num_inputs; ++i)
+            num_terms += (fis->rules[r].mf_indices[i] >= 0);
+
+    return sizeof(FIS_FixedSystem)
+         + sizeof(int8_t) * fis->num_inputs
+         + sizeof(FIS_FixedMF) * num_mfs
+         + sizeof(int32_t) * (fis->num_inputs + 1)
+         + sizeof(FIS_FixedRule) * fis->num_rules
+         + sizeof(int32_t) * num_terms
+         + sizeof(int32_t) * fis->num_rules * fis->num_inputs
+         + 7 * (FIS_ARENA_ALIGN - 1);
+}
+
+const FIS_FixedSystem* FIS_Fixed_Convert(const FIS_System* fis, const float* input_ranges, FIS_Arena* arena)
+{
+    int num_mfs = 0;
+    int num_terms = 0;
+
+    for (int i = 0; i < fis->num_inputs; ++i)
+    {
+        for (int m = 0; m < fis->num_mfs_per_input[i]; ++m)
+        {
+            const FIS_MembershipFunction* mf = fis->input_mfs[i][m];
+            if (mf != NULL && mf->eval != FIS_MF_TriangularEval && mf->eval != FIS_MF_TrapezoidalEval)
+                return NULL;
+        }
+        num_mfs += fis->num_mfs_per_input[i];
+    }
+    for (int r = 0; r < fis->num_rules; ++r)
+    {
+        if (fis->rules[r].coefficients == NULL)
+            return NULL;
+        for (int i = 0; i < fis->num_inputs; ++i)
+        {
+            if (fis->rules[r].mf_indices[i] >= fis->num_mfs_per_input[i])
+                return NULL;
+            num_terms += (fis->rules[r].mf_indices[i] >= 0);
+        }
+    }
+
+    FIS_FixedSystem* fixed = FIS_Arena_Alloc(arena, sizeof(FIS_FixedSystem), FIS_ARENA_ALIGN);
+    int8_t* input_exponents = FIS_Arena_Alloc(arena, sizeof(int8_t) * fis->num_inputs, FIS_ARENA_ALIGN);
+    FIS_FixedMF* mfs = FIS_Arena_Alloc(arena, sizeof(FIS_FixedMF) * num_mfs, FIS_ARENA_ALIGN);
+    int32_t* first_mf = FIS_Arena_Alloc(arena, sizeof(int32_t) * (fis->num_inputs + 1), FIS_ARENA_ALIGN);
+    FIS_FixedRule* rules = FIS_Arena_Alloc(arena, sizeof(FIS_FixedRule) * fis->num_rules, FIS_ARENA_ALIGN);
+    int32_t* terms = FIS_Arena_Alloc(arena, sizeof(int32_t) * num_terms, FIS_ARENA_ALIGN);
+    int32_t* coefficients = FIS_Arena_Alloc(arena, sizeof(int32_t) * fis->num_rules * fis->num_inputs, FIS_ARENA_ALIGN);
+
+    if (fixed == NULL || input_exponents == NULL || mfs == NULL || first_mf == NULL ||
+        rules == NULL || terms == NULL || coefficients == NULL)
+        return NULL;
+
+    // Input formats: smallest power-of-two range covering the given range and all breakpoints
+    for (int i = 0; i < fis->num_inputs; ++i)
+    {
+        float range = (input_ranges[i] < 0.0f) ? -input_ranges[i] : input_ranges[i];
+
+        for (int m = 0; m < fis->num_mfs_per_input[i]; ++m)
+        {
+            const FIS_MembershipFunction* mf = fis->input_mfs[i][m];
+            if (mf == NULL)
+                continue;
+
+            const float* points = (const float*)mf->params;
+            const int num_points = (mf->eval == FIS_MF_TriangularEval) ? 3 : 4;
+            for (int p = 0; p < num_points; ++p)
+            {
+                const float point = (points[p] < 0.0f) ? -points[p] : points[p];
+                if (point > range)
+                    range = point;
+            }
+        }
+        input_exponents[i] = (int8_t)FIS_Fixed_Exponent(range);
+    }
+
+    // Membership functions: breakpoints in the input format, precomputed slopes
+    int k = 0;
+    for (int i = 0; i < fis->num_inputs; ++i)
+    {
+        first_mf[i] = k;
+        for (int m = 0; m < fis->num_mfs_per_input[i]; ++m, ++k)
+        {
+            const FIS_MembershipFunction* mf = fis->input_mfs[i][m];
+            const int e = input_exponents[i];
+            memset(&mfs[k], 0, sizeof(FIS_FixedMF));
+            mfs[k].input = i;
+
+            if (mf == NULL)
+            {
+                mfs[k].type = FIS_FIXED_MF_NONE;
+            }
+            else if (mf->eval == FIS_MF_TriangularEval)
+            {
+                const FIS_MF_TriangularParams* p = mf->params;
+                mfs[k].type = FIS_FIXED_MF_TRIANGULAR;
+                mfs[k].a = FIS_Fixed_FromFloat(p->a, e);
+                mfs[k].b = FIS_Fixed_FromFloat(p->b, e);
+                mfs[k].c = FIS_Fixed_FromFloat(p->c, e);
+                FIS_Fixed_Slope((int64_t)mfs[k].b - mfs[k].a, &mfs[k].rise_slope, &mfs[k].rise_shift);
+                FIS_Fixed_Slope((int64_t)mfs[k].c - mfs[k].b, &mfs[k].fall_slope, &mfs[k].fall_shift);
+            }
+            else
+            {
+                const FIS_MF_TrapezoidalParams* p = mf->params;
+                mfs[k].type = FIS_FIXED_MF_TRAPEZOIDAL;
+                mfs[k].a = FIS_Fixed_FromFloat(p->a, e);
+                mfs[k].b = FIS_Fixed_FromFloat(p->b, e);
+                mfs[k].c = FIS_Fixed_FromFloat(p->c, e);
+                mfs[k].d = FIS_Fixed_FromFloat(p->d, e);
+                FIS_Fixed_Slope((int64_t)mfs[k].b - mfs[k].a, &mfs[k].rise_slope, &mfs[k].rise_shift);
+                FIS_Fixed_Slope((int64_t)mfs[k].d - mfs[k].c, &mfs[k].fall_slope, &mfs[k].fall_shift);
+            }
+        }
+    }
+    first_mf[fis->num_inputs] = k;
+
+    // Output format: bound of all linear consequents over the input ranges
+    double bound = 0.0;
+    for (int r = 0; r < fis->num_rules; ++r)
+    {
+        const float* p = fis->rules[r].coefficients;
+        double rule_bound = (p[fis->num_inputs] < 0.0f) ? -p[fis->num_inputs] : p[fis->num_inputs];
+
+        for (int i = 0; i < fis->num_inputs; ++i)
+            rule_bound += ((p[i] < 0.0f) ? -p[i] : p[i]) * FIS_Fixed_Pow2(input_exponents[i]);
+        if (rule_bound > bound)
+            bound = rule_bound;
+    }
+    const int output_exponent = FIS_Fixed_Exponent(bound);
+
+    // Rules: antecedent terms and consequent coefficients scaled to the output format
+    int t = 0;
+    for (int r = 0; r < fis->num_rules; ++r)
+    {
+        const FIS_Rule* rule = &fis->rules[r];
+        const float* p = rule->coefficients;
+        double max_coefficient = 0.0;
+
+        rules[r].first_term = t;
+        rules[r].logic_type = rule->logic_type;
+        for (int i = 0; i < fis->num_inputs; ++i)
+            if (rule->mf_indices[i] >= 0)
+                terms[t++] = first_mf[i] + rule->mf_indices[i];
+        rules[r].num_terms = t - rules[r].first_term;
+
+        // Coefficients scaled to the output format (recomputed below: no per-input buffer)
+        for (int i = 0; i < fis->num_inputs; ++i)
+        {
+            const double scaled = p[i] * FIS_Fixed_Pow2(input_exponents[i] - output_exponent);
+            if ((scaled < 0.0 ? -scaled : scaled) > max_coefficient)
+                max_coefficient = (scaled < 0.0) ? -scaled : scaled;
+        }
+
+        int shift = 0;
+        while (shift < FIS_FIXED_MAX_COEFF_SHIFT && max_coefficient * FIS_Fixed_Pow2(shift + 1) < FIS_FIXED_COEFF_LIMIT)
+            ++shift;
+
+        for (int i = 0; i < fis->num_inputs; ++i)
+        {
+            const double c = p[i] * FIS_Fixed_Pow2(input_exponents[i] - output_exponent) * FIS_Fixed_Pow2(shift);
+            coefficients[r * fis->num_inputs + i] = (int32_t)((c < 0.0) ? c - 0.5 : c + 0.5);
+        }
+        const double constant = p[fis->num_inputs] * FIS_Fixed_Pow2(31 - output_exponent) * FIS_Fixed_Pow2(shift);
+        rules[r].constant = (int64_t)((constant < 0.0) ? constant - 0.5 : constant + 0.5);
+        rules[r].shift = shift;
+    }
+
+    fixed->num_inputs = fis->num_inputs;
+    fixed->num_rules = fis->num_rules;
+    fixed->output_exponent = output_exponent;
+    fixed->input_exponents = input_exponents;
+    fixed->mfs = mfs;
+    fixed->first_mf = first_mf;
+    fixed->rules = rules;
+    fixed->terms = terms;
+    fixed->coefficients = coefficients;
+    return fixed;
+}
+
+FIS_Q31 FIS_Fixed_Evaluate(const FIS_FixedSystem* fis, const FIS_Q31* inputs)
+{
+    int64_t numerator = 0;
+    int64_t denominator = 0;
+
+    for (int r = 0; r < fis->num_rules; ++r)
+    {
+        const FIS_FixedRule* rule = &fis->rules[r];
+        const int conjunction = FIS_IsConjunction((FIS_LogicType)rule->logic_type);
+        int32_t weight = FIS_Fixed_InitialWeight(rule->logic_type);
+
+        for (int t = rule->first_term; t < rule->first_term + rule->num_terms; ++t)
+        {
+            const FIS_FixedMF* mf = &fis->mfs[fis->terms[t]];
+            weight = FIS_Fixed_CombineDegree(rule->logic_type, weight, FIS_Fixed_MF(mf, inputs[mf->input]));
+            if (conjunction && weight == 0)
+                break;
+        }
+
+        if (weight == 0)
+            continue;
+
+        numerator += (int64_t)weight * FIS_Fixed_Consequent(fis, r, inputs);
+        denominator += weight;
+    }
+
+    return FIS_Fixed_Defuzzify(numerator, denominator);
+}
+
+void FIS_Fixed_EvaluateBatch(const FIS_FixedSystem* fis, const FIS_Q31* const* inputs, FIS_Q31* outputs, int count)
+{
+    int32_t weight[FIS_BATCH_BLOCK];
+    int32_t degree[FIS_BATCH_BLOCK];
+    int64_t numerator[FIS_BATCH_BLOCK];
+    int64_t denominator[FIS_BATCH_BLOCK];
+    int64_t sum[FIS_BATCH_BLOCK];
+
+    for (int start = 0; start < count; start += FIS_BATCH_BLOCK)
+    {
+        int n = count - start;
+        if (n > FIS_BATCH_BLOCK)
+            n = FIS_BATCH_BLOCK;
+
+        for (int s = 0; s < n; ++s)
+        {
+            numerator[s] = 0;
+            denominator[s] = 0;
+        }
+
+        for (int r = 0; r < fis->num_rules; ++r)
+        {
+            const FIS_FixedRule* rule = &fis->rules[r];
+            const int32_t w0 = FIS_Fixed_InitialWeight(rule->logic_type);
+            int firing = 0;
+
+            for (int s = 0; s < n; ++s)
+                weight[s] = w0;
+
+            for (int t = rule->first_term; t < rule->first_term + rule->num_terms; ++t)
+            {
+                const FIS_FixedMF* mf = &fis->mfs[fis->terms[t]];
+                FIS_Fixed_MFArray(mf, inputs[mf->input] + start, degree, n);
+                for (int s = 0; s < n; ++s)
+                    weight[s] = FIS_Fixed_CombineDegree(rule->logic_type, weight[s], degree[s]);
+            }
+
+            for (int s = 0; s < n; ++s)
+                firing |= (weight[s] != 0);
+            if (!firing)
+                continue;
+
+            // Linear consequent column by column; non-firing samples add zero
+            const int32_t* coefficients = &fis->coefficients[r * fis->num_inputs];
+            for (int s = 0; s < n; ++s)
+                sum[s] = rule->constant;
+            for (int i = 0; i < fis->num_inputs; ++i)
+            {
+                const int64_t c = coefficients[i];
+                const FIS_Q31* x = inputs[i] + start;
+                for (int s = 0; s < n; ++s)
+                    sum[s] += c * x[s];
+            }
+
+            const int64_t round = (rule->shift > 0) ? (int64_t)1 << (rule->shift - 1) : 0;
+            for (int s = 0; s < n; ++s)
+            {
+                numerator[s] += (int64_t)weight[s] * FIS_Fixed_SaturateQ31((sum[s] + round) >> rule->shift);
+                denominator[s] += weight[s];
+            }
+        }
+
+        for (int s = 0; s < n; ++s)
+            outputs[start + s] = FIS_Fixed_Defuzzify(numerator[s], denominator[s]);
+    }
+}
+
+float FIS_Fixed_Validate(const FIS_FixedSystem* fixed, FIS_System* fis, float* inputs, int count)
+{
+    // Host-side report: rows of larger systems are converted in a heap buffer
+    FIS_Q31 stack_x[FIS_MAX_INPUTS];
+    FIS_Q31* x = (fis->num_inputs <= FIS_MAX_INPUTS) ? stack_x : malloc(sizeof(FIS_Q31) * fis->num_inputs);
+    float max_error = 0.0f;
+
+    if (x == NULL)
+        return -1.0f;
+
+    for (int s = 0; s < count; ++s)
+    {
+        float* row = &inputs[s * fis->num_inputs];
+        for (int i = 0; i < fis->num_inputs; ++i)
+            x[i] = FIS_Fixed_FromFloat(row[i], fixed->input_exponents[i]);
+
+        const float out = FIS_Fixed_ToFloat(FIS_Fixed_Evaluate(fixed, x), fixed->output_exponent);
+        const float expected = FIS_Evaluate(fis, row);
+        const float error = (out > expected) ? out - expected : expected - out;
+        if (error > max_error)
+            max_error = error;
+    }
+
+    if (x != stack_x)
+        free(x);
+    return max_error;
+}
@@ -0,0 +1,178 @@
+/**
+  ******************************************************************************
+  * @file		: fis_sugeno_fixed.h
+  * @author  	: AW		Adrian.Wojcik@put.poznan.pl
+  * @version 	: 1.0.0
+  * @date    	: Oct 17, 2026
+  * @brief   	: Takagi-Sugeno-Kang (Sugeno) Fuzzy Inference System for
+  *               embedded control systems
+  *               Fixed-point engine for integer-only cores: Q31 inputs and MF
+  *               parameters, Q15 degrees of membership, saturating t-norms and
+  *               integer weighted-average defuzzification
+  *
+  ******************************************************************************
+  */
+
+#ifndef INC_FIS_SUGENO_FIXED_H_
+#define INC_FIS_SUGENO_FIXED_H_
+
+/* Public includes -----------------------------------------------------------*/
+#include <stdint.h>
+#include "fis_sugeno.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Public typedef ------------------------------------------------------------*/
+typedef int16_t FIS_Q15;    // degree of membership: 1.0 = FIS_Q15_ONE
+typedef int32_t FIS_Q31;    // signal with a power-of-two range: x = X * 2^(exponent - 31)
+
+/**
+ * @brief Fixed-point membership function. Breakpoints are in the Q31 format of the
+ *        input; slopes are degree increments per input LSB: S * 2^-shift.
+ */
+typedef struct
+{
+    int32_t type;               // FIS_Fixed_MFType
+    int32_t input;              // input index
+    FIS_Q31 a, b, c, d;         // triangle: d unused
+    int32_t rise_slope;
+    int32_t rise_shift;
+    int32_t fall_slope;
+    int32_t fall_shift;
+} FIS_FixedMF;
+
+typedef enum
+{
+    FIS_FIXED_MF_NONE,          // NULL membership function: degree -FIS_Q15_ONE
+    FIS_FIXED_MF_TRIANGULAR,
+    FIS_FIXED_MF_TRAPEZOIDAL
+} FIS_Fixed_MFType;
+
+/**
+ * @brief Fixed-point rule with a linear consequent:
+ *        Y = (sum(C_i * X_i) + constant) * 2^-shift, in the Q31 format of the output.
+ */
+typedef struct
+{
+    int32_t first_term;         // index of the first antecedent term
+    int32_t num_terms;
+    int32_t logic_type;         // FIS_LogicType
+    int32_t shift;
+    int64_t constant;
+} FIS_FixedRule;
+
+typedef struct
+{
+    int num_inputs;
+    int num_rules;
+    int output_exponent;                // y = Y * 2^(output_exponent - 31)
+    const int8_t* input_exponents;      // [num_inputs]
+    const FIS_FixedMF* mfs;             // all MFs, input by input
+    const int32_t* first_mf;            // [num_inputs + 1]: MFs of input i are [first_mf[i], first_mf[i + 1])
+    const FIS_FixedRule* rules;         // [num_rules]
+    const int32_t* terms;               // MF index of each antecedent term
+    const int32_t* coefficients;        // [num_rules][num_inputs]
+} FIS_FixedSystem;
+
+/* Public define -------------------------------------------------------------*/
+#define FIS_Q15_ONE         32767
+#define FIS_Q31_MAX         INT32_MAX
+#define FIS_Q31_MIN         (-INT32_MAX)
+
+/* Public inline functions ---------------------------------------------------*/
+/**
+ * @brief Converts a float to Q31 with a given exponent (saturating, NaN to 0).
+ */
+static inline FIS_Q31 FIS_Fixed_FromFloat(float x, int exponent)
+{
+    double scaled = (double)x;
+
+    for (int e = exponent; e < 31; ++e)
+        scaled *= 2.0;
+    for (int e = 31; e < exponent; ++e)
+        scaled *= 0.5;
+
+    if (!(scaled > (double)FIS_Q31_MIN))
+        return (scaled <= (double)FIS_Q31_MIN) ? FIS_Q31_MIN : 0;
+    if (scaled >= (double)FIS_Q31_MAX)
+        return FIS_Q31_MAX;
+
+    return (FIS_Q31)((scaled < 0.0) ? scaled - 0.5 : scaled + 0.5);
+}
+
+/**
+ * @brief Converts a Q31 value with a given exponent to float.
+ */
+static inline float FIS_Fixed_ToFloat(FIS_Q31 x, int exponent)
+{
+    double value = (double)x;
+
+    for (int e = exponent; e < 31; ++e)
+        value *= 0.5;
+    for (int e = 31; e < exponent; ++e)
+        value *= 2.0;
+
+    return (float)value;
+}
+
+/* Public function prototypes ------------------------------------------------*/
+/**
+ * @brief Computes the arena space needed by FIS_Fixed_Convert().
+ *
+ * @param[in] fis       Pointer to the FIS system definition.
+ * @return              Size in bytes (including alignment padding).
+ */
+size_t FIS_Fixed_Size(const FIS_System* fis);
+
+/**
+ * @brief Converts a float FIS to fixed point. Each input gets the smallest power-of-two
+ *        range covering `input_ranges` and its MF breakpoints; the output range is the
+ *        bound of the linear consequents over these input ranges.
+ *
+ * @param[in]     fis           Pointer to the FIS system definition. Only triangular and
+ *                              trapezoidal MFs and linear (coefficient) consequents are supported.
+ * @param[in]     input_ranges  Max absolute value of every input.
+ * @param[in,out] arena         Arena with at least FIS_Fixed_Size() bytes available.
+ * @return                      Pointer to the fixed-point system, or NULL if the FIS is
+ *                              not supported or the arena is exhausted.
+ */
+const FIS_FixedSystem* FIS_Fixed_Convert(const FIS_System* fis, const float* input_ranges, FIS_Arena* arena);
+
+/**
+ * @brief Evaluates a fixed-point FIS (integer arithmetic only, reentrant).
+ *
+ * @param[in] fis       Pointer to the fixed-point system.
+ * @param[in] inputs    Array of Q31 inputs (see fis->input_exponents).
+ * @return              Q31 output (see fis->output_exponent).
+ */
+FIS_Q31 FIS_Fixed_Evaluate(const FIS_FixedSystem* fis, const FIS_Q31* inputs);
+
+/**
+ * @brief Evaluates a fixed-point FIS for a batch of samples (structure-of-arrays inputs,
+ *        see FIS_EvaluateBatch()). Results are identical to FIS_Fixed_Evaluate().
+ *
+ * @param[in]  fis      Pointer to the fixed-point system.
+ * @param[in]  inputs   Array of fis->num_inputs pointers to Q31 input columns.
+ * @param[out] outputs  Array of `count` Q31 outputs.
+ * @param[in]  count    Number of samples.
+ */
+void FIS_Fixed_EvaluateBatch(const FIS_FixedSystem* fis, const FIS_Q31* const* inputs, FIS_Q31* outputs, int count);
+
+/**
+ * @brief Converter report: evaluates test vectors with the fixed-point and the float engine.
+ *
+ * @param[in] fixed     Pointer to the fixed-point system.
+ * @param[in] fis       Float FIS it was converted from.
+ * @param[in] inputs    Test vectors, `count` rows of fis->num_inputs float values.
+ * @param[in] count     Number of test vectors.
+ * @return              Max absolute output deviation from FIS_Evaluate() (-1 if out of memory).
+ */
+float FIS_Fixed_Validate(const FIS_FixedSystem* fixed, FIS_System* fis, float* inputs, int count);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* INC_FIS_SUGENO_FIXED_H_ */
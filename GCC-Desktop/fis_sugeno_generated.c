@@ -0,0 +1,183 @@
+/**
+  ******************************************************************************
+  * @file		: fis_sugeno_generated.c
+  * @brief   	: Takagi-Sugeno-Kang (Sugeno) Fuzzy Inference System for
+  *               embedded control systems
+  *               Generated code: specialized FIS evaluation functions
+  *               (sugeno_codegen, from 'fis_sugeno_config.c'). Do not edit.
+  *
+  ******************************************************************************
+  */
+
+/* Private includes ----------------------------------------------------------*/
+#include "fis_sugeno_generated.h"
+
+/* Public functions ----------------------------------------------------------*/
+/* Generated by sugeno_codegen: 6 inputs, 3 rules. Do not edit. */
+float FIS_InvertedPendulumController_Evaluate(const float* inputs)
+{
+    const float x0 = inputs[0];
+    const float x1 = inputs[1];
+    const float x2 = inputs[2];
+    const float x3 = inputs[3];
+    const float x4 = inputs[4];
+    const float x5 = inputs[5];
+
+    /* input 5, MF 0: triangular(0.1f, 0.1f, 3.1f) */
+    float mu5_0;
+    if (x5 < 0.1f || x5 > 3.1f)
+        mu5_0 = 0.0f;
+    else if (x5 == 0.1f)
+        mu5_0 = 1.0f;
+    else
+        mu5_0 = (3.1f - x5) / 3.0f;
+
+    /* input 5, MF 1: triangular(0.1f, 3.1f, 8.1f) */
+    float mu5_1;
+    if (x5 < 0.1f || x5 > 8.1f)
+        mu5_1 = 0.0f;
+    else if (x5 == 3.1f)
+        mu5_1 = 1.0f;
+    else if (x5 < 3.1f)
+        mu5_1 = (x5 - 0.1f) / 3.0f;
+    else
+        mu5_1 = (8.1f - x5) / 5.0000005f;
+
+    /* input 5, MF 2: triangular(3.1f, 8.1f, 8.1f) */
+    float mu5_2;
+    if (x5 < 3.1f || x5 > 8.1f)
+        mu5_2 = 0.0f;
+    else if (x5 == 8.1f)
+        mu5_2 = 1.0f;
+    else if (x5 < 8.1f)
+        mu5_2 = (x5 - 3.1f) / 5.0000005f;
+    else
+        mu5_2 = x5;
+
+    float numerator = 0.0f;
+
+    /* rule 0 */
+    float w0 = (mu5_0 < 1.0f) ? mu5_0 : 1.0f;
+    if (w0 != 0.0f)
+    {
+        float y0 = -0.5456f * x0;
+        y0 += 108.373f * x1;
+        y0 += 4.0827f * x2;
+        y0 += 0.5456f * x3;
+        y0 += 1.0912f * x4;
+        numerator += w0 * y0;
+    }
+
+    /* rule 1 */
+    float w1 = (mu5_1 < 1.0f) ? mu5_1 : 1.0f;
+    if (w1 != 0.0f)
+    {
+        float y1 = -16.9129f * x0;
+        y1 += 423.99f * x1;
+        y1 += 194.2168f * x2;
+        y1 += 16.9129f * x3;
+        y1 += 33.8259f * x4;
+        numerator += w1 * y1;
+    }
+
+    /* rule 2 */
+    float w2 = (mu5_2 < 1.0f) ? mu5_2 : 1.0f;
+    if (w2 != 0.0f)
+    {
+        float y2 = -43.6463f * x0;
+        y2 += 1080.2933f * x1;
+        y2 += 786.3601f * x2;
+        y2 += 43.6463f * x3;
+        y2 += 87.2925f * x4;
+        numerator += w2 * y2;
+    }
+
+    const float denominator = w0 + w1 + w2;
+    if (denominator == 0.0f)
+        return 0.0f;
+
+    return numerator / denominator;
+}
+
+/* Generated by sugeno_codegen: 5 inputs, 3 rules. Do not edit. */
+float FIS_PMSM_SpeedController_Evaluate(const float* inputs)
+{
+    const float x0 = inputs[0];
+    const float x1 = inputs[1];
+    const float x2 = inputs[2];
+    const float x3 = inputs[3];
+    const float x4 = inputs[4];
+
+    /* input 3, MF 0: trapezoidal(-5.0f, -5.0f, -0.2f, 0.0f) */
+    float mu3_0;
+    if (x3 < -5.0f || x3 > 0.0f)
+        mu3_0 = 0.0f;
+    else if (x3 >= -5.0f && x3 <= -0.2f)
+        mu3_0 = 1.0f;
+    else
+        mu3_0 = (0.0f - x3) / 0.2f;
+
+    /* input 3, MF 1: triangular(-0.5f, 0.0f, 0.5f) */
+    float mu3_1;
+    if (x3 < -0.5f || x3 > 0.5f)
+        mu3_1 = 0.0f;
+    else if (x3 == 0.0f)
+        mu3_1 = 1.0f;
+    else if (x3 < 0.0f)
+        mu3_1 = (x3 + 0.5f) / 0.5f;
+    else
+        mu3_1 = (0.5f - x3) / 0.5f;
+
+    /* input 3, MF 2: trapezoidal(0.0f, 0.2f, 5.0f, 5.0f) */
+    float mu3_2;
+    if (x3 < 0.0f || x3 > 5.0f)
+        mu3_2 = 0.0f;
+    else if (x3 >= 0.2f && x3 <= 5.0f)
+        mu3_2 = 1.0f;
+    else if (x3 == 0.0f)
+        mu3_2 = 1.0f;
+    else if (x3 < 0.2f)
+        mu3_2 = (x3) / 0.2f;
+    else
+        mu3_2 = x3;
+
+    float numerator = 0.0f;
+
+    /* rule 0 */
+    float w0 = (mu3_0 < 1.0f) ? mu3_0 : 1.0f;
+    if (w0 != 0.0f)
+    {
+        float y0 = 85.16229f * x0;
+        y0 += -85.16229f * x1;
+        y0 += 2972.7249f * x2;
+        numerator += w0 * y0;
+    }
+
+    /* rule 1 */
+    float w1 = (mu3_1 < 1.0f) ? mu3_1 : 1.0f;
+    if (w1 != 0.0f)
+    {
+        float y1 = 4.772f * x0;
+        y1 += -4.772f * x1;
+        y1 += 31189.543f * x2;
+        y1 += 0.10871284f * x3;
+        y1 += -0.4213676f * x4;
+        numerator += w1 * y1;
+    }
+
+    /* rule 2 */
+    float w2 = (mu3_2 < 1.0f) ? mu3_2 : 1.0f;
+    if (w2 != 0.0f)
+    {
+        float y2 = 85.16229f * x0;
+        y2 += -85.16229f * x1;
+        y2 += 2972.7249f * x2;
+        numerator += w2 * y2;
+    }
+
+    const float denominator = w0 + w1 + w2;
+    if (denominator == 0.0f)
+        return 0.0f;
+
+    return numerator / denominator;
+}
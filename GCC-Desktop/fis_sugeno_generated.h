@@ -0,0 +1,45 @@
+/**
+  ******************************************************************************
+  * @file		: fis_sugeno_generated.h
+  * @author  	: AW		Adrian.Wojcik@put.poznan.pl
+  * @version 	: 1.0.0
+  * @date    	: Oct 17, 2026
+  * @brief   	: Takagi-Sugeno-Kang (Sugeno) Fuzzy Inference System for
+  *               embedded control systems
+  *               Generated code: specialized FIS evaluation functions
+  *               ('fis_sugeno_generated.c', regenerate with sugeno_codegen)
+  *
+  ******************************************************************************
+  */
+
+#ifndef INC_FIS_SUGENO_GENERATED_H_
+#define INC_FIS_SUGENO_GENERATED_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Public function prototypes ------------------------------------------------*/
+/**
+ * @brief Inverted pendulum controller (FIS_InvertedPendulumController_InitLinear()),
+ *        straight-line code. Results match FIS_Evaluate().
+ *
+ * @param[in] inputs    Array of 6 crisp input values.
+ * @return              Crisp output.
+ */
+float FIS_InvertedPendulumController_Evaluate(const float* inputs);
+
+/**
+ * @brief PMSM speed controller (FIS_PMSM_SpeedController_InitLinear()),
+ *        straight-line code. Results match FIS_Evaluate().
+ *
+ * @param[in] inputs    Array of 5 crisp input values.
+ * @return              Crisp output.
+ */
+float FIS_PMSM_SpeedController_Evaluate(const float* inputs);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* INC_FIS_SUGENO_GENERATED_H_ */
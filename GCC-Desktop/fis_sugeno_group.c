@@ -0,0 +1,218 @@
+/**
+  ******************************************************************************
+  * @file		: fis_sugeno_group.c
+  * @author  	: AW		Adrian.Wojcik@put.poznan.pl
+  * @version 	: 1.0.0
+  * @date    	: Oct 17, 2026
+  * @brief   	: Takagi-Sugeno-Kang (Sugeno) Fuzzy Inference System for
+  *               embedded control systems
+  *               FIS group: several systems evaluated on the same input vector,
+  *               with MFs common to the members fuzzified once
+  *
+  ******************************************************************************
+  */
+
+/* Private includes ----------------------------------------------------------*/
+#include <string.h>
+#include "fis_sugeno_group.h"
+
+/* Private functions ---------------------------------------------------------*/
+/**
+ * @brief Total number of MFs (degree slots) of a system.
+ */
+static int FIS_Group_DegreeCount(const FIS_System* fis)
+{
+    int count = 0;
+    for (int i = 0; i < fis->num_inputs; ++i)
+        count += fis->num_mfs_per_input[i];
+    return count;
+}
+
+/**
+ * @brief Packed MFs of two plans with the same shape and parameters.
+ */
+static int FIS_Group_SameMF(const FIS_Plan* plan_a, int slot_a, const FIS_Plan* plan_b, int slot_b)
+{
+    const FIS_PlanMF* a = &FIS_PLAN_MFS(plan_a)[slot_a];
+    const FIS_PlanMF* b = &FIS_PLAN_MFS(plan_b)[slot_b];
+
+    if (a->type != b->type)
+        return 0;
+
+    switch (a->type)
+    {
+        case FIS_MF_TYPE_TRIANGULAR:
+            return memcmp(&a->params.tri, &b->params.tri, sizeof(FIS_MF_TriangularParams)) == 0;
+        case FIS_MF_TYPE_TRAPEZOIDAL:
+            return memcmp(&a->params.trap, &b->params.trap, sizeof(FIS_MF_TrapezoidalParams)) == 0;
+        case FIS_MF_TYPE_CUSTOM:
+        {
+            const FIS_PlanCustomMF* custom_a = &FIS_PLAN_CUSTOM_MFS(plan_a)[a->custom];
+            const FIS_PlanCustomMF* custom_b = &FIS_PLAN_CUSTOM_MFS(plan_b)[b->custom];
+            return custom_a->eval == custom_b->eval && custom_a->params == custom_b->params;
+        }
+        default:
+            return 1;
+    }
+}
+
+/* Public functions ----------------------------------------------------------*/
+size_t FIS_Group_Size(const FIS_System* const* systems, int num_systems)
+{
+    size_t size = sizeof(FIS_Group) + sizeof(FIS_Plan*) * num_systems
+                + sizeof(int32_t) * (num_systems + 1);
+    int num_degrees = 0;
+
+    for (int k = 0; k < num_systems; ++k)
+    {
+        size += FIS_Plan_Size(systems[k]);
+        num_degrees += FIS_Group_DegreeCount(systems[k]);
+    }
+
+    // Distinct MF tables sized for the worst case (no MF shared); every allocation
+    // may need up to (FIS_ARENA_ALIGN - 1) bytes of padding
+    return size + sizeof(int32_t) * 4 * num_degrees + 7 * (FIS_ARENA_ALIGN - 1);
+}
+
+const FIS_Group* FIS_Group_Compile(const FIS_System* const* systems, int num_systems, FIS_Arena* arena)
+{
+    const size_t mark = arena->used;
+    const int num_inputs = systems[0]->num_inputs;
+    int num_degrees = 0;
+
+    for (int k = 0; k < num_systems; ++k)
+    {
+        if (systems[k]->num_inputs != num_inputs)
+            return NULL;
+        num_degrees += FIS_Group_DegreeCount(systems[k]);
+    }
+
+    FIS_Group* group = FIS_Arena_Alloc(arena, sizeof(FIS_Group), FIS_ARENA_ALIGN);
+    const FIS_Plan** plans = FIS_Arena_Alloc(arena, sizeof(FIS_Plan*) * num_systems, FIS_ARENA_ALIGN);
+    int32_t* first_slot = FIS_Arena_Alloc(arena, sizeof(int32_t) * (num_systems + 1), FIS_ARENA_ALIGN);
+    int32_t* slot_map = FIS_Arena_Alloc(arena, sizeof(int32_t) * num_degrees, FIS_ARENA_ALIGN);
+    int32_t* unique_input = FIS_Arena_Alloc(arena, sizeof(int32_t) * num_degrees, FIS_ARENA_ALIGN);
+    int32_t* unique_system = FIS_Arena_Alloc(arena, sizeof(int32_t) * num_degrees, FIS_ARENA_ALIGN);
+    int32_t* unique_slot = FIS_Arena_Alloc(arena, sizeof(int32_t) * num_degrees, FIS_ARENA_ALIGN);
+
+    int ok = group != NULL && plans != NULL && first_slot != NULL
+          && ((slot_map != NULL && unique_input != NULL && unique_system != NULL && unique_slot != NULL)
+              || num_degrees == 0);
+    for (int k = 0; ok && k < num_systems; ++k)
+    {
+        plans[k] = FIS_Compile(systems[k], arena);
+        ok = (plans[k] != NULL);
+    }
+    if (!ok)
+    {
+        arena->used = mark;
+        return NULL;
+    }
+
+    first_slot[0] = 0;
+    for (int k = 0; k < num_systems; ++k)
+        first_slot[k + 1] = first_slot[k] + plans[k]->num_degrees;
+
+    // Distinct MFs input by input, in member order (first occurrence holds the MF)
+    int num_unique = 0;
+    for (int i = 0; i < num_inputs; ++i)
+    {
+        const int first_unique = num_unique;
+
+        for (int k = 0; k < num_systems; ++k)
+        {
+            const FIS_PlanInput* input = &FIS_PLAN_INPUTS(plans[k])[i];
+
+            for (int m = 0; m < input->num_mfs; ++m)
+            {
+                const int slot = input->first_mf + m;
+                int u = first_unique;
+                while (u < num_unique && !FIS_Group_SameMF(plans[unique_system[u]], unique_slot[u], plans[k], slot))
+                    ++u;
+
+                if (u == num_unique)
+                {
+                    unique_input[u] = i;
+                    unique_system[u] = k;
+                    unique_slot[u] = slot;
+                    ++num_unique;
+                }
+                slot_map[first_slot[k] + slot] = u;
+            }
+        }
+    }
+
+    group->num_systems = num_systems;
+    group->num_inputs = num_inputs;
+    group->num_degrees = num_degrees;
+    group->num_unique = num_unique;
+    group->plans = plans;
+    group->unique_input = unique_input;
+    group->unique_system = unique_system;
+    group->unique_slot = unique_slot;
+    group->first_slot = first_slot;
+    group->slot_map = slot_map;
+    return group;
+}
+
+size_t FIS_Group_WorkspaceSize(const FIS_Group* group)
+{
+    size_t size = sizeof(FIS_GroupWorkspace) + sizeof(FIS_PlanWorkspace*) * group->num_systems
+                + sizeof(float) * group->num_unique + 2 * (FIS_ARENA_ALIGN - 1) + (FIS_PLAN_ALIGN - 1);
+
+    for (int k = 0; k < group->num_systems; ++k)
+        size += FIS_Plan_WorkspaceSize(group->plans[k]);
+    return size;
+}
+
+FIS_GroupWorkspace* FIS_Group_CreateWorkspace(const FIS_Group* group, FIS_Arena* arena)
+{
+    const size_t mark = arena->used;
+    FIS_GroupWorkspace* ws = FIS_Arena_Alloc(arena, sizeof(FIS_GroupWorkspace), FIS_ARENA_ALIGN);
+    FIS_PlanWorkspace** member_ws = FIS_Arena_Alloc(arena, sizeof(FIS_PlanWorkspace*) * group->num_systems, FIS_ARENA_ALIGN);
+    float* degrees = FIS_Arena_Alloc(arena, sizeof(float) * group->num_unique, FIS_PLAN_ALIGN);
+
+    int ok = ws != NULL && member_ws != NULL && (degrees != NULL || group->num_unique == 0);
+    for (int k = 0; ok && k < group->num_systems; ++k)
+    {
+        member_ws[k] = FIS_Plan_CreateWorkspace(group->plans[k], arena);
+        ok = (member_ws[k] != NULL);
+    }
+    if (!ok)
+    {
+        arena->used = mark;
+        return NULL;
+    }
+
+    ws->ws = member_ws;
+    ws->degrees = degrees;
+    return ws;
+}
+
+void FIS_Group_Evaluate(const FIS_Group* group, const float* inputs, float* outputs, FIS_GroupWorkspace* ws)
+{
+    int fuzzified = 0;
+
+    for (int k = 0; k < group->num_systems; ++k)
+    {
+        const FIS_Plan* plan = group->plans[k];
+        if ((plan->flags & FIS_PLAN_FLAG_PARTITION) && FIS_Plan_EvaluatePartition(plan, inputs, &outputs[k]))
+            continue;
+
+        // Shared stage: degrees of the distinct MFs, on the first member that needs them
+        if (!fuzzified)
+        {
+            for (int u = 0; u < group->num_unique; ++u)
+                ws->degrees[u] = FIS_Plan_MembershipDegree(group->plans[group->unique_system[u]],
+                                                           group->unique_slot[u], inputs[group->unique_input[u]]);
+            fuzzified = 1;
+        }
+
+        const int32_t* slot_map = &group->slot_map[group->first_slot[k]];
+        float* degrees = ws->ws[k]->degrees;
+        for (int s = 0; s < plan->num_degrees; ++s)
+            degrees[s] = ws->degrees[slot_map[s]];
+
+        outputs[k] = FIS_Plan_EvaluateFuzzified(plan, inputs, ws->ws[k]);
+    }
+}
@@ -0,0 +1,112 @@
+/**
+  ******************************************************************************
+  * @file		: fis_sugeno_group.h
+  * @author  	: AW		Adrian.Wojcik@put.poznan.pl
+  * @version 	: 1.0.0
+  * @date    	: Oct 17, 2026
+  * @brief   	: Takagi-Sugeno-Kang (Sugeno) Fuzzy Inference System for
+  *               embedded control systems
+  *               FIS group: several systems evaluated on the same input vector,
+  *               with MFs common to the members fuzzified once
+  *
+  ******************************************************************************
+  */
+
+#ifndef INC_FIS_SUGENO_GROUP_H_
+#define INC_FIS_SUGENO_GROUP_H_
+
+/* Public includes -----------------------------------------------------------*/
+#include <stddef.h>
+#include <stdint.h>
+#include "fis_sugeno_plan.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Public typedef ------------------------------------------------------------*/
+/**
+ * @brief Compiled group of systems with the same inputs (e.g. a controller and its
+ *        shadow-mode candidates). Each member keeps its own plan; degree slot s of
+ *        member k is read from unique MF slot_map[first_slot[k] + s].
+ */
+typedef struct
+{
+    int32_t num_systems;
+    int32_t num_inputs;
+    int32_t num_degrees;                    // degree slots of all members
+    int32_t num_unique;                     // distinct MFs (function and parameters), fuzzified once
+    const FIS_Plan* const* plans;           // [num_systems]
+    const int32_t* unique_input;            // [num_unique]: input of each distinct MF
+    const int32_t* unique_system;           // [num_unique]: member whose plan holds the MF
+    const int32_t* unique_slot;             // [num_unique]: degree slot of the MF in that plan
+    const int32_t* first_slot;              // [num_systems + 1]: slots of each member in slot_map
+    const int32_t* slot_map;                // [num_degrees]: distinct MF of every member degree slot
+} FIS_Group;
+
+/**
+ * @brief Caller-owned scratch memory of FIS_Group_Evaluate().
+ */
+typedef struct
+{
+    FIS_PlanWorkspace** ws;                     // [num_systems]: plan workspace of each member
+    float* degrees;                         // [num_unique]: degrees of the distinct MFs
+} FIS_GroupWorkspace;
+
+/* Public function prototypes ------------------------------------------------*/
+/**
+ * @brief Computes the arena space needed by FIS_Group_Compile().
+ *
+ * @param[in] systems       Array of num_systems FIS definitions.
+ * @param[in] num_systems   Number of members.
+ * @return                  Size in bytes (including alignment padding).
+ */
+size_t FIS_Group_Size(const FIS_System* const* systems, int num_systems);
+
+/**
+ * @brief Compiles every member into a plan and finds the MFs shared by the members:
+ *        MFs of the same input with the same shape and parameters (custom MFs: the
+ *        same function and parameter pointer) get one degree.
+ *
+ * @param[in]     systems       Array of num_systems FIS definitions with the same
+ *                              number of inputs (same input vector).
+ * @param[in]     num_systems   Number of members.
+ * @param[in,out] arena         Arena with at least FIS_Group_Size() bytes available.
+ * @return                      Pointer to the group, or NULL if the numbers of inputs
+ *                              differ, a member cannot be compiled or the arena is exhausted.
+ */
+const FIS_Group* FIS_Group_Compile(const FIS_System* const* systems, int num_systems, FIS_Arena* arena);
+
+/**
+ * @brief Computes the arena space needed by FIS_Group_CreateWorkspace().
+ */
+size_t FIS_Group_WorkspaceSize(const FIS_Group* group);
+
+/**
+ * @brief Allocates a workspace for FIS_Group_Evaluate() (one per thread).
+ *
+ * @param[in]     group     Pointer to the compiled group.
+ * @param[in,out] arena     Arena receiving the workspace.
+ * @return                  Pointer to the workspace or NULL if the arena is exhausted.
+ */
+FIS_GroupWorkspace* FIS_Group_CreateWorkspace(const FIS_Group* group, FIS_Arena* arena);
+
+/**
+ * @brief Evaluates all members on one input vector. The distinct MFs are fuzzified
+ *        once (only if a member needs degrees), each member gathers its degrees and
+ *        runs the remaining stages with FIS_Plan_EvaluateFuzzified(); members with
+ *        FIS_PLAN_FLAG_PARTITION take the division-free path where it applies.
+ *        outputs[k] is bit-identical to FIS_Plan_Evaluate() of member k.
+ *
+ * @param[in]     group     Pointer to the compiled group.
+ * @param[in]     inputs    Array of crisp input values, shared by all members.
+ * @param[out]    outputs   Array of num_systems crisp outputs.
+ * @param[in,out] ws        Workspace created with FIS_Group_CreateWorkspace().
+ */
+void FIS_Group_Evaluate(const FIS_Group* group, const float* inputs, float* outputs, FIS_GroupWorkspace* ws);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* INC_FIS_SUGENO_GROUP_H_ */
@@ -0,0 +1,264 @@
+/**
+  ******************************************************************************
+  * @file		: fis_sugeno_image.c
+  * @author  	: AW		Adrian.Wojcik@put.poznan.pl
+  * @version 	: 1.0.0
+  * @date    	: Oct 17, 2026
+  * @brief   	: Takagi-Sugeno-Kang (Sugeno) Fuzzy Inference System for
+  *               embedded control systems
+  *               Binary FIS image: a compiled plan without function pointers,
+  *               saved as is and evaluated in place (read-only mmap, flash)
+  *
+  ******************************************************************************
+  */
+
+#if defined(__unix__) || defined(__APPLE__)
+#define _POSIX_C_SOURCE 200809L
+#endif
+
+/* Private includes ----------------------------------------------------------*/
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "fis_sugeno_image.h"
+
+#if FIS_IMAGE_MMAP
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+/* Private functions ---------------------------------------------------------*/
+/**
+ * @brief Checks that a table of `count` elements lies inside the image and is aligned.
+ *        The count is 64-bit so products of header fields cannot wrap before the check.
+ */
+static int FIS_Image_TableFits(uint32_t offset, int64_t count, size_t element_size, uint32_t size)
+{
+    return count >= 0
+        && offset % FIS_PLAN_ALIGN == 0
+        && offset >= sizeof(FIS_Plan)
+        && (uint64_t)offset + (uint64_t)count * element_size <= size;
+}
+
+/* Public functions ----------------------------------------------------------*/
+int FIS_Image_IsPortable(const FIS_Plan* plan)
+{
+    return plan->num_custom_mfs == 0 && plan->num_consequents == plan->num_linear;
+}
+
+const FIS_Plan* FIS_Image_Check(const void* data, size_t size)
+{
+    const FIS_Plan* plan = (const FIS_Plan*)data;
+
+    // Header
+    if (data == NULL || (uintptr_t)data % FIS_PLAN_ALIGN != 0 || size < sizeof(FIS_Plan)
+        || plan->magic != FIS_PLAN_MAGIC || plan->version != FIS_PLAN_VERSION
+        || plan->size > size || !FIS_Image_IsPortable(plan))
+        return NULL;
+
+    if (plan->num_inputs < 0 || plan->num_degrees < 0 || plan->num_rules < 0 || plan->num_linear < 0 || plan->num_linear > plan->num_rules
+        || plan->linear_stride < plan->num_linear || plan->linear_stride % FIS_SIMD_MAX_LANES != 0
+        || plan->num_columns < 0 || plan->num_columns > plan->num_inputs + 1
+        || plan->scheduling_input < -1 || plan->scheduling_input >= plan->num_inputs)
+        return NULL;
+
+    // Tables
+    if (!FIS_Image_TableFits(plan->inputs_offset, plan->num_inputs, sizeof(FIS_PlanInput), plan->size)
+        || !FIS_Image_TableFits(plan->mfs_offset, plan->num_degrees, sizeof(FIS_PlanMF), plan->size)
+        || !FIS_Image_TableFits(plan->rules_offset, plan->num_rules, sizeof(FIS_PlanRule), plan->size)
+        || !FIS_Image_TableFits(plan->terms_offset, plan->num_terms, sizeof(int32_t), plan->size)
+        || !FIS_Image_TableFits(plan->columns_offset, plan->num_columns, sizeof(int32_t), plan->size)
+        || !FIS_Image_TableFits(plan->matrix_offset, (int64_t)plan->num_columns * plan->linear_stride, sizeof(float), plan->size)
+        || !FIS_Image_TableFits(plan->breakpoints_offset, plan->num_breakpoints, sizeof(float), plan->size)
+        || plan->num_segments < 0
+        || !FIS_Image_TableFits(plan->segments_offset, (int64_t)plan->num_segments + 1, sizeof(int32_t), plan->size)
+        || !FIS_Image_TableFits(plan->segment_mfs_offset, plan->num_segment_mfs, sizeof(int32_t), plan->size))
+        return NULL;
+
+    // Indices stored in the tables
+    const FIS_PlanInput* inputs = FIS_PLAN_INPUTS(plan);
+    for (int i = 0, first_mf = 0; i < plan->num_inputs; first_mf += inputs[i++].num_mfs)
+        if (inputs[i].first_mf != first_mf || inputs[i].num_mfs < 0 || first_mf + inputs[i].num_mfs > plan->num_degrees)
+            return NULL;
+
+    // Segment search: sorted breakpoints, monotone segment starts, MFs of the own input
+    const float* breakpoints = FIS_PLAN_BREAKPOINTS(plan);
+    const int32_t* segments = FIS_PLAN_SEGMENTS(plan);
+    const int32_t* segment_mfs = FIS_PLAN_SEGMENT_MFS(plan);
+    int32_t num_points = 0, num_segments = 0;
+    for (int i = 0; i < plan->num_inputs; ++i)
+    {
+        const int32_t count = inputs[i].num_breakpoints;
+        if (inputs[i].first_breakpoint != num_points || inputs[i].first_segment != num_segments
+            || count < 0 || count > plan->num_breakpoints - num_points)
+            return NULL;
+        if (count == 0)
+            continue;
+        if (2 * (int64_t)count + 1 > plan->num_segments - num_segments)
+            return NULL;
+
+        for (int j = 1; j < count; ++j)
+            if (!(breakpoints[num_points + j - 1] <= breakpoints[num_points + j]))
+                return NULL;
+
+        for (int s = num_segments; s < num_segments + 2 * count + 1; ++s)
+        {
+            if (segments[s] < 0 || segments[s] > segments[s + 1] || segments[s + 1] > plan->num_segment_mfs)
+                return NULL;
+            for (int e = segments[s]; e < segments[s + 1]; ++e)
+                if (segment_mfs[e] < 0 || segment_mfs[e] >= inputs[i].num_mfs)
+                    return NULL;
+        }
+        num_points += count;
+        num_segments += 2 * count + 1;
+    }
+    if (num_points != plan->num_breakpoints || num_segments != plan->num_segments)
+        return NULL;
+
+    // Partition plans: ascending knots (x between two knots), intervals naming existing rules
+    if (plan->flags & FIS_PLAN_FLAG_PARTITION)
+    {
+        if (plan->num_knots < 2 || plan->scheduling_input < 0
+            || !FIS_Image_TableFits(plan->knots_offset, plan->num_knots, sizeof(float), plan->size)
+            || !FIS_Image_TableFits(plan->partition_offset, (int64_t)plan->num_knots - 1, sizeof(FIS_PlanPartitionSegment), plan->size))
+            return NULL;
+
+        const float* knots = FIS_PLAN_KNOTS(plan);
+        const FIS_PlanPartitionSegment* partition = FIS_PLAN_PARTITION(plan);
+        for (int j = 0; j < plan->num_knots - 1; ++j)
+            if (!(knots[j] < knots[j + 1]) || partition[j].lower_rule < 0 || partition[j].lower_rule >= plan->num_rules
+                || partition[j].upper_rule < 0 || partition[j].upper_rule >= plan->num_rules)
+                return NULL;
+    }
+
+    // Tensor plans address matrix rows by the MF indices of the inputs with MFs
+    if (plan->flags & FIS_PLAN_FLAG_TENSOR)
+    {
+        int64_t cells = 1;
+        for (int i = 0; i < plan->num_inputs && cells <= plan->num_rules; ++i)
+            if (inputs[i].num_mfs > 0)
+                cells *= inputs[i].num_mfs;
+        if (cells != plan->num_rules || plan->num_linear != plan->num_rules)
+            return NULL;
+    }
+
+    // MFs: known shapes, aliases naming an earlier (or the same) MF of the input
+    const FIS_PlanMF* mfs = FIS_PLAN_MFS(plan);
+    for (int k = 0; k < plan->num_degrees; ++k)
+        if (mfs[k].type != FIS_MF_TYPE_NONE && mfs[k].type != FIS_MF_TYPE_TRIANGULAR && mfs[k].type != FIS_MF_TYPE_TRAPEZOIDAL)
+            return NULL;
+    for (int i = 0; i < plan->num_inputs; ++i)
+        for (int m = 0; m < inputs[i].num_mfs; ++m)
+            if (mfs[inputs[i].first_mf + m].alias < 0 || mfs[inputs[i].first_mf + m].alias > m)
+                return NULL;
+
+    const FIS_PlanRule* rules = FIS_PLAN_RULES(plan);
+    for (int r = 0; r < plan->num_rules; ++r)
+        if (rules[r].first_term < 0 || rules[r].num_terms < 0 || rules[r].first_term > plan->num_terms - rules[r].num_terms
+            || rules[r].logic_type < FIS_AND_MIN || rules[r].logic_type > FIS_OR_PROB_SUM
+            || rules[r].consequent < 0 || rules[r].consequent >= plan->num_linear)
+            return NULL;
+
+    const int32_t* terms = FIS_PLAN_TERMS(plan);
+    for (int t = 0; t < plan->num_terms; ++t)
+        if (terms[t] < 0 || terms[t] >= plan->num_degrees)
+            return NULL;
+
+    const int32_t* columns = FIS_PLAN_COLUMNS(plan);
+    for (int c = 0; c < plan->num_columns; ++c)
+        if (columns[c] < 0 || columns[c] > plan->num_inputs)
+            return NULL;
+
+    return plan;
+}
+
+int FIS_Image_Save(const FIS_Plan* plan, const char* path)
+{
+    if (!FIS_Image_IsPortable(plan))
+        return 0;
+
+    FILE* file = fopen(path, "wb");
+    if (file == NULL)
+        return 0;
+
+    int written = (fwrite(plan, 1, plan->size, file) == plan->size);
+    return (fclose(file) == 0) && written;
+}
+
+const FIS_Plan* FIS_Image_Map(const char* path, FIS_ImageMapping* mapping)
+{
+    mapping->data = NULL;
+    mapping->size = 0;
+
+#if FIS_IMAGE_MMAP
+    int fd = open(path, O_RDONLY);
+    struct stat st;
+    if (fd < 0)
+        return NULL;
+
+    if (fstat(fd, &st) == 0 && st.st_size > 0)
+    {
+        // Page-aligned, read-only and shared: one physical copy for all processes
+        void* data = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+        if (data != MAP_FAILED)
+        {
+            mapping->data = data;
+            mapping->size = (size_t)st.st_size;
+        }
+    }
+    close(fd);
+#else
+    FILE* file = fopen(path, "rb");
+    long size = -1;
+    if (file == NULL)
+        return NULL;
+
+    if (fseek(file, 0, SEEK_END) == 0)
+        size = ftell(file);
+    if (size > 0 && fseek(file, 0, SEEK_SET) == 0)
+    {
+        // Plain C has no aligned allocation: over-allocate and keep the block pointer ahead of the data
+        unsigned char* block = malloc((size_t)size + FIS_PLAN_ALIGN + sizeof(void*));
+        if (block != NULL)
+        {
+            unsigned char* data = block + sizeof(void*);
+            data += (FIS_PLAN_ALIGN - (uintptr_t)data % FIS_PLAN_ALIGN) % FIS_PLAN_ALIGN;
+            ((void**)data)[-1] = block;
+
+            if (fread(data, 1, (size_t)size, file) == (size_t)size)
+            {
+                mapping->data = data;
+                mapping->size = (size_t)size;
+            }
+            else
+                free(block);
+        }
+    }
+    fclose(file);
+#endif
+
+    if (mapping->data == NULL)
+        return NULL;
+
+    const FIS_Plan* plan = FIS_Image_Check(mapping->data, mapping->size);
+    if (plan == NULL)
+        FIS_Image_Unmap(mapping);
+    return plan;
+}
+
+void FIS_Image_Unmap(FIS_ImageMapping* mapping)
+{
+    if (mapping->data == NULL)
+        return;
+
+#if FIS_IMAGE_MMAP
+    munmap((void*)mapping->data, mapping->size);
+#else
+    free(((void* const*)mapping->data)[-1]);
+#endif
+
+    mapping->data = NULL;
+    mapping->size = 0;
+}
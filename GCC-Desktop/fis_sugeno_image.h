@@ -0,0 +1,96 @@
+/**
+  ******************************************************************************
+  * @file		: fis_sugeno_image.h
+  * @author  	: AW		Adrian.Wojcik@put.poznan.pl
+  * @version 	: 1.0.0
+  * @date    	: Oct 17, 2026
+  * @brief   	: Takagi-Sugeno-Kang (Sugeno) Fuzzy Inference System for
+  *               embedded control systems
+  *               Binary FIS image: a compiled plan without function pointers,
+  *               saved as is and evaluated in place (read-only mmap, flash)
+  *
+  ******************************************************************************
+  */
+
+#ifndef INC_FIS_SUGENO_IMAGE_H_
+#define INC_FIS_SUGENO_IMAGE_H_
+
+/* Public includes -----------------------------------------------------------*/
+#include <stddef.h>
+#include "fis_sugeno_plan.h"
+
+/* Public define -------------------------------------------------------------*/
+#if defined(__unix__) || defined(__APPLE__)
+#define FIS_IMAGE_MMAP      1       // FIS_Image_Map() uses mmap(); otherwise the file is read into memory
+#else
+#define FIS_IMAGE_MMAP      0
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Public typedef ------------------------------------------------------------*/
+/**
+ * @brief Image mapped (or read) by FIS_Image_Map().
+ */
+typedef struct
+{
+    const void* data;
+    size_t size;
+} FIS_ImageMapping;
+
+/* Public function prototypes ------------------------------------------------*/
+/**
+ * @brief Checks whether a plan can be stored as an image: only triangular/trapezoidal
+ *        MFs and linear consequents (no FIS_MF_Eval / FIS_ConsequentFunction pointers).
+ *
+ * @param[in] plan      Pointer to the compiled plan.
+ * @return              1 if portable, 0 otherwise.
+ */
+int FIS_Image_IsPortable(const FIS_Plan* plan);
+
+/**
+ * @brief Validates an image in place and returns it as a plan, without copying or
+ *        parsing. Header, table bounds and alignment, MF types and all table indices
+ *        are checked, so an image from an untrusted file cannot make the evaluator
+ *        read outside it. Images use the byte order of the host that wrote them
+ *        (a foreign byte order fails the magic check).
+ *
+ * @param[in] data      Image bytes, aligned to FIS_PLAN_ALIGN (e.g. page-aligned mmap).
+ * @param[in] size      Number of bytes available.
+ * @return              Pointer to the plan (== data) or NULL if the image is invalid.
+ */
+const FIS_Plan* FIS_Image_Check(const void* data, size_t size);
+
+/**
+ * @brief Writes a portable plan to a file (plan->size bytes, byte for byte).
+ *
+ * @param[in] plan      Pointer to the compiled plan.
+ * @param[in] path      File path.
+ * @return              1 on success, 0 if the plan is not portable or on I/O error.
+ */
+int FIS_Image_Save(const FIS_Plan* plan, const char* path);
+
+/**
+ * @brief Maps an image file read-only (shared between processes) and validates it
+ *        with FIS_Image_Check(). The plan can be evaluated directly.
+ *
+ * @param[in]  path      File path.
+ * @param[out] mapping   Mapping to release with FIS_Image_Unmap().
+ * @return               Pointer to the plan or NULL on error (nothing to release).
+ */
+const FIS_Plan* FIS_Image_Map(const char* path, FIS_ImageMapping* mapping);
+
+/**
+ * @brief Releases an image mapped with FIS_Image_Map().
+ *
+ * @param[in,out] mapping   Mapping returned by FIS_Image_Map().
+ */
+void FIS_Image_Unmap(FIS_ImageMapping* mapping);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* INC_FIS_SUGENO_IMAGE_H_ */
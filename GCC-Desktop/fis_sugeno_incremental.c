@@ -0,0 +1,347 @@
+/**
+  ******************************************************************************
+  * @file		: fis_sugeno_incremental.c
+  * @author  	: AW		Adrian.Wojcik@put.poznan.pl
+  * @version 	: 1.0.0
+  * @date    	: Oct 17, 2026
+  * @brief   	: Takagi-Sugeno-Kang (Sugeno) Fuzzy Inference System for
+  *               embedded control systems
+  *               Incremental evaluation: degrees, rule weights and blended gains
+  *               of the previous call are reused for inputs that did not change
+  *
+  ******************************************************************************
+  */
+
+/* Private includes ----------------------------------------------------------*/
+#include <string.h>
+#include "fis_sugeno_incremental.h"
+
+/* Private functions ---------------------------------------------------------*/
+/**
+ * @brief Input owning a degree slot.
+ */
+static int FIS_Incremental_SlotInput(const FIS_Plan* plan, int slot)
+{
+    const FIS_PlanInput* inputs = FIS_PLAN_INPUTS(plan);
+
+    for (int i = 0; i < plan->num_inputs; ++i)
+    {
+        if (slot >= inputs[i].first_mf && slot < inputs[i].first_mf + inputs[i].num_mfs)
+            return i;
+    }
+    return -1;
+}
+
+/**
+ * @brief Blended gain vector of the cached weights, in the order of FIS_Plan_BlendedOutput().
+ */
+static void FIS_Incremental_BlendGains(FIS_Incremental* inc)
+{
+    const FIS_Plan* plan = inc->plan;
+    const FIS_PlanRule* rules = FIS_PLAN_RULES(plan);
+    const float* matrix = FIS_PLAN_MATRIX(plan);
+    float* normalized = inc->ws->linear_outputs;
+
+    const float scale = 1.0f / inc->denominator;
+    for (int l = 0; l < plan->num_linear; ++l)
+        normalized[l] = 0.0f;
+    for (int r = 0; r < plan->num_rules; ++r)
+        normalized[rules[r].consequent] += inc->ws->rule_output[r].weight * scale;
+
+    for (int c = 0; c < plan->num_columns; ++c)
+    {
+        const float* column = &matrix[c * plan->linear_stride];
+        float gain = 0.0f;
+
+        for (int l = 0; l < plan->num_linear; ++l)
+            gain += normalized[l] * column[l];
+
+        inc->gains[c] = gain;
+    }
+}
+
+/**
+ * @brief Output from the cached weights (and gains).
+ */
+static float FIS_Incremental_Output(const FIS_Incremental* inc, const float* inputs)
+{
+    const FIS_Plan* plan = inc->plan;
+
+    if (inc->denominator == 0.0f)
+        return 0.0f;
+
+    if (plan->flags & FIS_PLAN_FLAG_GAIN_BLENDING)
+    {
+        const int32_t* columns = FIS_PLAN_COLUMNS(plan);
+        float output = 0.0f;
+
+        for (int c = 0; c < plan->num_columns; ++c)
+            output += inc->gains[c] * ((columns[c] < plan->num_inputs) ? inputs[columns[c]] : 1.0f);
+        return output;
+    }
+
+    // Weights summed per distinct consequent: each is evaluated once
+    const FIS_PlanRule* rules = FIS_PLAN_RULES(plan);
+    float* weights = inc->ws->consequent_weights;
+    float numerator = 0.0f;
+
+    for (int c = 0; c < plan->num_consequents; ++c)
+        weights[c] = 0.0f;
+    for (int r = 0; r < plan->num_rules; ++r)
+        weights[rules[r].consequent] += inc->ws->rule_output[r].weight;
+
+    for (int c = 0; c < plan->num_consequents; ++c)
+    {
+        if (weights[c] != 0.0f)
+            numerator += weights[c] * FIS_Plan_Consequent(plan, c, inputs);
+    }
+    return numerator / inc->denominator;
+}
+
+/**
+ * @brief Adds an antecedent input to the inputs whose rules are out of date.
+ */
+static void FIS_Incremental_MarkPending(FIS_Incremental* inc, int input)
+{
+    for (int k = 0; k < inc->num_pending; ++k)
+    {
+        if (inc->pending_inputs[k] == input)
+            return;
+    }
+    inc->pending_inputs[inc->num_pending++] = input;
+}
+
+/**
+ * @brief Denominator and, for gain blending plans, blended gains of the cached weights.
+ */
+static void FIS_Incremental_Normalize(FIS_Incremental* inc)
+{
+    const FIS_Plan* plan = inc->plan;
+    float denominator = 0.0f;
+
+    for (int r = 0; r < plan->num_rules; ++r)
+        denominator += inc->ws->rule_output[r].weight;
+    inc->denominator = denominator;
+
+    if ((plan->flags & FIS_PLAN_FLAG_GAIN_BLENDING) && denominator != 0.0f)
+        FIS_Incremental_BlendGains(inc);
+}
+
+/**
+ * @brief Fuzzifies the pending inputs (at their last values), then recomputes each
+ *        rule with an antecedent on them once, and normalizes.
+ */
+static void FIS_Incremental_Refresh(FIS_Incremental* inc)
+{
+    const FIS_Plan* plan = inc->plan;
+
+    for (int k = 0; k < inc->num_pending; ++k)
+    {
+        const int i = inc->pending_inputs[k];
+        float x;
+        memcpy(&x, &inc->last_bits[i], sizeof(x));
+        FIS_Plan_FuzzifySingle(plan, i, x, inc->ws);
+    }
+
+    if (++inc->stamp == 0)
+    {
+        memset(inc->rule_stamp, 0, sizeof(uint32_t) * plan->num_rules);
+        inc->stamp = 1;
+    }
+
+    for (int k = 0; k < inc->num_pending; ++k)
+    {
+        const int i = inc->pending_inputs[k];
+
+        for (int e = inc->first_rule[i]; e < inc->first_rule[i + 1]; ++e)
+        {
+            const int r = inc->input_rules[e];
+            if (inc->rule_stamp[r] == inc->stamp)
+                continue;
+
+            inc->ws->rule_output[r].weight = FIS_Plan_RuleFiring(plan, r, inc->ws->degrees);
+            inc->rule_stamp[r] = inc->stamp;
+            inc->stats.rules_recomputed++;
+        }
+    }
+
+    inc->num_pending = 0;
+    FIS_Incremental_Normalize(inc);
+}
+
+/* Public functions ----------------------------------------------------------*/
+size_t FIS_Incremental_Size(const FIS_Plan* plan)
+{
+    return sizeof(FIS_Incremental)
+         + FIS_Plan_WorkspaceSize(plan)
+         + sizeof(uint32_t) * plan->num_inputs
+         + sizeof(unsigned char) * plan->num_inputs
+         + sizeof(int32_t) * (plan->num_inputs + 1)
+         + sizeof(int32_t) * plan->num_terms
+         + sizeof(uint32_t) * plan->num_rules
+         + sizeof(float) * plan->num_columns
+         + sizeof(int32_t) * plan->num_inputs
+         + 8 * (FIS_ARENA_ALIGN - 1);
+}
+
+FIS_Incremental* FIS_Incremental_Create(const FIS_Plan* plan, FIS_Arena* arena)
+{
+    const size_t mark = arena->used;
+    FIS_Incremental* inc = FIS_Arena_Alloc(arena, sizeof(FIS_Incremental), FIS_ARENA_ALIGN);
+    FIS_PlanWorkspace* ws = FIS_Plan_CreateWorkspace(plan, arena);
+    uint32_t* last_bits = FIS_Arena_Alloc(arena, sizeof(uint32_t) * plan->num_inputs, FIS_ARENA_ALIGN);
+    unsigned char* input_role = FIS_Arena_Alloc(arena, sizeof(unsigned char) * plan->num_inputs, FIS_ARENA_ALIGN);
+    int32_t* first_rule = FIS_Arena_Alloc(arena, sizeof(int32_t) * (plan->num_inputs + 1), FIS_ARENA_ALIGN);
+    int32_t* input_rules = FIS_Arena_Alloc(arena, sizeof(int32_t) * plan->num_terms, FIS_ARENA_ALIGN);
+    uint32_t* rule_stamp = FIS_Arena_Alloc(arena, sizeof(uint32_t) * plan->num_rules, FIS_ARENA_ALIGN);
+    float* gains = FIS_Arena_Alloc(arena, sizeof(float) * plan->num_columns, FIS_ARENA_ALIGN);
+    int32_t* pending_inputs = FIS_Arena_Alloc(arena, sizeof(int32_t) * plan->num_inputs, FIS_ARENA_ALIGN);
+
+    if (inc == NULL || ws == NULL || last_bits == NULL || input_role == NULL || first_rule == NULL
+        || (input_rules == NULL && plan->num_terms > 0) || (rule_stamp == NULL && plan->num_rules > 0)
+        || (gains == NULL && plan->num_columns > 0) || pending_inputs == NULL)
+    {
+        arena->used = mark;
+        return NULL;
+    }
+
+    const FIS_PlanRule* rules = FIS_PLAN_RULES(plan);
+    const int32_t* terms = FIS_PLAN_TERMS(plan);
+    const int32_t* columns = FIS_PLAN_COLUMNS(plan);
+
+    // Consequent inputs: matrix columns, or all inputs if a consequent function may read them
+    memset(input_role, 0, sizeof(unsigned char) * plan->num_inputs);
+    for (int c = 0; c < plan->num_columns; ++c)
+    {
+        if (columns[c] < plan->num_inputs)
+            input_role[columns[c]] |= FIS_INCREMENTAL_CONSEQUENT;
+    }
+    if (plan->num_consequents > plan->num_linear)
+    {
+        for (int i = 0; i < plan->num_inputs; ++i)
+            input_role[i] |= FIS_INCREMENTAL_CONSEQUENT;
+    }
+
+    // Input -> rules lists (each rule has at most one term per input)
+    memset(first_rule, 0, sizeof(int32_t) * (plan->num_inputs + 1));
+    for (int t = 0; t < plan->num_terms; ++t)
+        first_rule[FIS_Incremental_SlotInput(plan, terms[t]) + 1]++;
+    for (int i = 0; i < plan->num_inputs; ++i)
+        first_rule[i + 1] += first_rule[i];
+
+    int num_antecedent_inputs = 0;
+    for (int i = 0; i < plan->num_inputs; ++i)
+    {
+        if (first_rule[i + 1] > first_rule[i])
+        {
+            input_role[i] |= FIS_INCREMENTAL_ANTECEDENT;
+            num_antecedent_inputs++;
+        }
+    }
+
+    for (int r = 0; r < plan->num_rules; ++r)
+    {
+        for (int t = 0; t < rules[r].num_terms; ++t)
+        {
+            const int i = FIS_Incremental_SlotInput(plan, terms[rules[r].first_term + t]);
+            input_rules[first_rule[i]++] = r;
+        }
+    }
+    for (int i = plan->num_inputs; i > 0; --i)
+        first_rule[i] = first_rule[i - 1];
+    first_rule[0] = 0;
+
+    inc->plan = plan;
+    inc->ws = ws;
+    inc->last_bits = last_bits;
+    inc->input_role = input_role;
+    inc->first_rule = first_rule;
+    inc->input_rules = input_rules;
+    inc->rule_stamp = rule_stamp;
+    inc->gains = gains;
+    inc->pending_inputs = pending_inputs;
+    inc->num_antecedent_inputs = num_antecedent_inputs;
+    FIS_Incremental_Invalidate(inc);
+    FIS_Incremental_ResetStats(inc);
+    return inc;
+}
+
+float FIS_Incremental_Evaluate(FIS_Incremental* inc, const float* inputs)
+{
+    const FIS_Plan* plan = inc->plan;
+    int antecedent_changed = 0;
+    int consequent_changed = 0;
+
+    inc->stats.evaluations++;
+    inc->stats.input_checks += inc->num_antecedent_inputs;
+
+    if (!inc->valid)
+    {
+        // Full evaluation; rules without antecedents are computed here only
+        FIS_Plan_RuleWeights(plan, inputs, inc->ws);
+        memcpy(inc->last_bits, inputs, sizeof(float) * plan->num_inputs);
+        inc->stats.rules_recomputed += plan->num_rules;
+        inc->num_pending = 0;
+        inc->valid = 1;
+        FIS_Incremental_Normalize(inc);
+
+        if ((plan->flags & FIS_PLAN_FLAG_PARTITION) && FIS_Plan_EvaluatePartition(plan, inputs, &inc->output))
+            return inc->output;
+    }
+    else
+    {
+        const int num_inputs = plan->num_inputs;
+        const unsigned char* input_role = inc->input_role;
+        uint32_t* last_bits = inc->last_bits;
+        int num_changed = 0;
+
+        for (int i = 0; i < num_inputs; ++i)
+        {
+            uint32_t bits;
+            memcpy(&bits, &inputs[i], sizeof(bits));
+            if (bits == last_bits[i])
+                continue;
+
+            last_bits[i] = bits;
+            consequent_changed |= input_role[i] & FIS_INCREMENTAL_CONSEQUENT;
+            if (input_role[i] & FIS_INCREMENTAL_ANTECEDENT)
+            {
+                num_changed++;
+                FIS_Incremental_MarkPending(inc, i);
+            }
+        }
+        antecedent_changed = num_changed > 0;
+        inc->stats.input_hits += inc->num_antecedent_inputs - num_changed;
+
+        if (!antecedent_changed && !consequent_changed)
+        {
+            inc->stats.output_hits++;
+            return inc->output;
+        }
+
+        inc->stats.weight_hits += !antecedent_changed;
+
+        // Division-free path: the weights are brought up to date when next needed
+        if ((plan->flags & FIS_PLAN_FLAG_PARTITION) && FIS_Plan_EvaluatePartition(plan, inputs, &inc->output))
+            return inc->output;
+
+        if (inc->num_pending > 0)
+            FIS_Incremental_Refresh(inc);
+    }
+
+    inc->output = FIS_Incremental_Output(inc, inputs);
+    return inc->output;
+}
+
+void FIS_Incremental_Invalidate(FIS_Incremental* inc)
+{
+    inc->valid = 0;
+    inc->num_pending = 0;
+    inc->stamp = 0;
+    memset(inc->rule_stamp, 0, sizeof(uint32_t) * inc->plan->num_rules);
+}
+
+void FIS_Incremental_ResetStats(FIS_Incremental* inc)
+{
+    memset(&inc->stats, 0, sizeof(inc->stats));
+}
@@ -0,0 +1,126 @@
+/**
+  ******************************************************************************
+  * @file		: fis_sugeno_incremental.h
+  * @author  	: AW		Adrian.Wojcik@put.poznan.pl
+  * @version 	: 1.0.0
+  * @date    	: Oct 17, 2026
+  * @brief   	: Takagi-Sugeno-Kang (Sugeno) Fuzzy Inference System for
+  *               embedded control systems
+  *               Incremental evaluation: degrees, rule weights and blended gains
+  *               of the previous call are reused for inputs that did not change
+  *
+  ******************************************************************************
+  */
+
+#ifndef INC_FIS_SUGENO_INCREMENTAL_H_
+#define INC_FIS_SUGENO_INCREMENTAL_H_
+
+/* Public includes -----------------------------------------------------------*/
+#include <stddef.h>
+#include <stdint.h>
+#include "fis_sugeno_plan.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Public typedef ------------------------------------------------------------*/
+/**
+ * @brief Cache statistics, accumulated until FIS_Incremental_ResetStats().
+ */
+typedef struct
+{
+    uint32_t evaluations;
+    uint32_t output_hits;           // no input used by the FIS changed: cached output returned
+    uint32_t weight_hits;           // no antecedent input changed: rule weights (and gains) reused
+    uint32_t input_checks;          // antecedent inputs compared (evaluations x antecedent inputs)
+    uint32_t input_hits;            // antecedent inputs whose degrees were reused
+    uint32_t rules_recomputed;      // rule weights recomputed
+} FIS_IncrementalStats;
+
+/**
+ * @brief Evaluator state of one controller instance (not shared between threads).
+ *        Inputs are compared bit by bit with the previous call; a changed input
+ *        is fuzzified again and only the rules with an antecedent on it are
+ *        recomputed.
+ */
+typedef struct
+{
+    const FIS_Plan* plan;
+    FIS_PlanWorkspace* ws;              // cached degrees (ws->degrees) and weights (ws->rule_output[r].weight)
+    uint32_t* last_bits;            // [num_inputs]: bit patterns of the inputs of the previous call
+    unsigned char* input_role;      // [num_inputs]: FIS_INCREMENTAL_ANTECEDENT | FIS_INCREMENTAL_CONSEQUENT
+    int32_t* first_rule;            // [num_inputs + 1]: rules with an antecedent on each input
+    int32_t* input_rules;           // rule indices, input by input
+    uint32_t* rule_stamp;           // [num_rules]: stamp of the call that last recomputed the weight
+    float* gains;                   // [num_columns]: blended gain vector (FIS_PLAN_FLAG_GAIN_BLENDING)
+    int32_t* pending_inputs;        // [num_inputs]: changed antecedent inputs whose rules are out of date
+    int32_t num_pending;
+    uint32_t stamp;                 // stamp of the last rule refresh
+    int32_t num_antecedent_inputs;
+    int32_t valid;                  // 0: nothing cached (new or invalidated evaluator)
+    float denominator;              // sum of the cached rule weights
+    float output;                   // output of the previous call
+    FIS_IncrementalStats stats;
+} FIS_Incremental;
+
+/* Public define -------------------------------------------------------------*/
+#define FIS_INCREMENTAL_ANTECEDENT  0x01u   // Input referenced by a rule antecedent
+#define FIS_INCREMENTAL_CONSEQUENT  0x02u   // Input read by a consequent
+
+/* Public function prototypes ------------------------------------------------*/
+/**
+ * @brief Computes the arena space needed by FIS_Incremental_Create().
+ *
+ * @param[in] plan      Pointer to the compiled plan.
+ * @return              Size in bytes (including alignment padding).
+ */
+size_t FIS_Incremental_Size(const FIS_Plan* plan);
+
+/**
+ * @brief Creates an incremental evaluator (with its own plan workspace). The plan
+ *        must stay valid.
+ *
+ * @param[in]     plan      Pointer to the compiled plan.
+ * @param[in,out] arena     Arena with at least FIS_Incremental_Size() bytes available.
+ * @return                  Pointer to the evaluator or NULL if the arena is exhausted.
+ */
+FIS_Incremental* FIS_Incremental_Create(const FIS_Plan* plan, FIS_Arena* arena);
+
+/**
+ * @brief Evaluates the plan, recomputing only the stages affected by inputs that
+ *        changed since the previous call: if no input changed the previous output is
+ *        returned; if only consequent inputs changed the weights (and, for gain
+ *        blending plans, the blended gains) are reused; otherwise the changed
+ *        antecedent inputs are fuzzified and the weights of their rules recomputed.
+ *        Plans with FIS_PLAN_FLAG_PARTITION take the division-free path where it
+ *        applies and defer the weight update to the next call that needs it.
+ *        Gain blending plans give results bit-identical to FIS_Plan_Evaluate();
+ *        other plans match FIS_Evaluate() to rounding.
+ *
+ * @param[in,out] inc       Evaluator created with FIS_Incremental_Create().
+ * @param[in]     inputs    Array of crisp input values.
+ * @return                  Final crisp output after inference and defuzzification.
+ */
+float FIS_Incremental_Evaluate(FIS_Incremental* inc, const float* inputs);
+
+/**
+ * @brief Drops the cached state; the next call evaluates all stages (e.g. after
+ *        the controller was reset or custom MF parameters changed).
+ *
+ * @param[in,out] inc       Evaluator.
+ */
+void FIS_Incremental_Invalidate(FIS_Incremental* inc);
+
+/**
+ * @brief Clears the cache statistics.
+ *
+ * @param[in,out] inc       Evaluator.
+ */
+void FIS_Incremental_ResetStats(FIS_Incremental* inc);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* INC_FIS_SUGENO_INCREMENTAL_H_ */
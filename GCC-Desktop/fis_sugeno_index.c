@@ -0,0 +1,358 @@
+/**
+  ******************************************************************************
+  * @file		: fis_sugeno_index.c
+  * @author  	: AW		Adrian.Wojcik@put.poznan.pl
+  * @version 	: 1.0.0
+  * @date    	: Oct 17, 2026
+  * @brief   	: Takagi-Sugeno-Kang (Sugeno) Fuzzy Inference System for
+  *               embedded control systems
+  *               Inverted rule index: (input, MF) -> bitset of rules, so only
+  *               rules with all antecedent MFs active are evaluated
+  *
+  ******************************************************************************
+  */
+
+/* Private includes ----------------------------------------------------------*/
+#include <string.h>
+#include "fis_sugeno_index.h"
+
+/* Private define ------------------------------------------------------------*/
+#define FIS_INDEX_WORD_BITS     64
+
+/* Private functions ---------------------------------------------------------*/
+static inline int FIS_Index_LowestBit(uint64_t bits)
+{
+#if defined(__GNUC__)
+    return __builtin_ctzll(bits);
+#else
+    int n = 0;
+    while ((bits & 1u) == 0)
+    {
+        bits >>= 1;
+        ++n;
+    }
+    return n;
+#endif
+}
+
+/**
+ * @brief Checks whether a zero degree of any antecedent MF forces the rule weight
+ *        to zero: AND rules over triangular/trapezoidal MFs (degrees in [0, 1]).
+ */
+static int FIS_Index_IsIndexable(const FIS_System* fis, const FIS_Rule* rule)
+{
+    int num_terms = 0;
+
+    if (!FIS_IsConjunction(rule->logic_type))
+        return 0;
+
+    for (int i = 0; i < fis->num_inputs; ++i)
+    {
+        const int m = rule->mf_indices[i];
+        if (m < 0)
+            continue;
+
+        const FIS_MembershipFunction* mf = fis->input_mfs[i][m];
+        if (mf == NULL || (mf->eval != FIS_MF_TriangularEval && mf->eval != FIS_MF_TrapezoidalEval))
+            return 0;
+        ++num_terms;
+    }
+    return num_terms > 0;
+}
+
+/**
+ * @brief Counts degrees and antecedent terms; 0 if a rule references a non-existent MF.
+ */
+static int FIS_Index_Count(const FIS_System* fis, int* num_degrees, int* num_terms, int* max_mfs)
+{
+    *num_degrees = 0;
+    *num_terms = 0;
+    *max_mfs = 0;
+
+    for (int i = 0; i < fis->num_inputs; ++i)
+    {
+        *num_degrees += fis->num_mfs_per_input[i];
+        if (fis->num_mfs_per_input[i] > *max_mfs)
+            *max_mfs = fis->num_mfs_per_input[i];
+    }
+
+    for (int r = 0; r < fis->num_rules; ++r)
+    {
+        for (int i = 0; i < fis->num_inputs; ++i)
+        {
+            const int m = fis->rules[r].mf_indices[i];
+            if (m >= fis->num_mfs_per_input[i])
+                return 0;
+            *num_terms += (m >= 0);
+        }
+    }
+    return 1;
+}
+
+/**
+ * @brief Weight and weighted consequent of one candidate rule (FIS_EvaluateRule()
+ *        over the rule's term list: same operations in the same order).
+ */
+static inline void FIS_Index_EvaluateRule(const FIS_RuleIndex* index, int r, const float* degrees, const float* inputs,
+                                          float* numerator, float* denominator)
+{
+    const FIS_Rule* rule = &index->fis->rules[r];
+    float weight = FIS_InitialWeight(rule->logic_type);
+    int conjunction = FIS_IsConjunction(rule->logic_type);
+
+    for (int t = index->first_term[r]; t < index->first_term[r + 1]; ++t)
+    {
+        weight = FIS_CombineDegree(rule->logic_type, weight, degrees[index->terms[t]]);
+
+        // AND of anything with zero stays zero
+        if (conjunction && weight == 0.0f)
+            return;
+    }
+
+    if (weight == 0.0f)
+        return;
+
+    float output = (rule->coefficients != NULL) ? FIS_LinearConsequent(rule->coefficients, inputs, index->num_inputs)
+                                                : rule->consequent(inputs);
+    *numerator += weight * output;
+    *denominator += weight;
+}
+
+/* Public functions ----------------------------------------------------------*/
+size_t FIS_Index_Size(const FIS_System* fis)
+{
+    int num_degrees, num_terms, max_mfs;
+    FIS_Index_Count(fis, &num_degrees, &num_terms, &max_mfs);
+    const size_t num_words = (size_t)(fis->num_rules + FIS_INDEX_WORD_BITS - 1) / FIS_INDEX_WORD_BITS;
+
+    // Every allocation may need up to (FIS_ARENA_ALIGN - 1) bytes of padding
+    return sizeof(FIS_RuleIndex)
+         + sizeof(int32_t) * (fis->num_inputs + 1)
+         + sizeof(uint64_t) * num_words * (num_degrees + fis->num_inputs)
+         + sizeof(int32_t) * 2 * (num_degrees + fis->num_inputs)
+         + sizeof(int32_t) * (fis->num_rules + 1)
+         + sizeof(int32_t) * num_terms
+         + 6 * (FIS_ARENA_ALIGN - 1);
+}
+
+const FIS_RuleIndex* FIS_Index_Create(const FIS_System* fis, FIS_Arena* arena)
+{
+    int num_degrees, num_terms, max_mfs;
+    const size_t mark = arena->used;
+
+    if (!FIS_Index_Count(fis, &num_degrees, &num_terms, &max_mfs))
+        return NULL;
+
+    const int num_words = (fis->num_rules + FIS_INDEX_WORD_BITS - 1) / FIS_INDEX_WORD_BITS;
+    const int num_sets = num_degrees + fis->num_inputs;
+
+    FIS_RuleIndex* index = FIS_Arena_Alloc(arena, sizeof(FIS_RuleIndex), FIS_ARENA_ALIGN);
+    int32_t* first_mf = FIS_Arena_Alloc(arena, sizeof(int32_t) * (fis->num_inputs + 1), FIS_ARENA_ALIGN);
+    uint64_t* sets = FIS_Arena_Alloc(arena, sizeof(uint64_t) * num_words * num_sets, FIS_ARENA_ALIGN);
+    int32_t* word_range = FIS_Arena_Alloc(arena, sizeof(int32_t) * 2 * num_sets, FIS_ARENA_ALIGN);
+    int32_t* first_term = FIS_Arena_Alloc(arena, sizeof(int32_t) * (fis->num_rules + 1), FIS_ARENA_ALIGN);
+    int32_t* terms = FIS_Arena_Alloc(arena, sizeof(int32_t) * num_terms, FIS_ARENA_ALIGN);
+
+    if (index == NULL || first_mf == NULL || sets == NULL || word_range == NULL || first_term == NULL
+        || (terms == NULL && num_terms > 0))
+    {
+        arena->used = mark;
+        return NULL;
+    }
+
+    first_mf[0] = 0;
+    for (int i = 0; i < fis->num_inputs; ++i)
+        first_mf[i + 1] = first_mf[i] + fis->num_mfs_per_input[i];
+
+    // Rule sets: one per MF, then one per input for rules that do not constrain it
+    uint64_t* mf_rules = sets;
+    uint64_t* free_rules = sets + (size_t)num_words * num_degrees;
+    memset(sets, 0, sizeof(uint64_t) * num_words * num_sets);
+
+    int t = 0, num_indexed = 0;
+    for (int r = 0; r < fis->num_rules; ++r)
+    {
+        const FIS_Rule* rule = &fis->rules[r];
+        const int indexable = FIS_Index_IsIndexable(fis, rule);
+        const uint64_t bit = (uint64_t)1 << (r % FIS_INDEX_WORD_BITS);
+        const int word = r / FIS_INDEX_WORD_BITS;
+
+        first_term[r] = t;
+        for (int i = 0; i < fis->num_inputs; ++i)
+        {
+            const int m = rule->mf_indices[i];
+            if (m >= 0)
+                terms[t++] = first_mf[i] + m;
+
+            if (indexable && m >= 0)
+                mf_rules[(size_t)(first_mf[i] + m) * num_words + word] |= bit;
+            else
+                free_rules[(size_t)i * num_words + word] |= bit;
+        }
+        num_indexed += indexable;
+    }
+    first_term[fis->num_rules] = t;
+
+    // Range of non-zero words of every set: the first input only scans these
+    for (int s = 0; s < num_sets; ++s)
+    {
+        const uint64_t* set = &sets[(size_t)s * num_words];
+        int first = num_words, end = 0;
+        for (int w = 0; w < num_words; ++w)
+        {
+            if (set[w] == 0)
+                continue;
+            if (first == num_words)
+                first = w;
+            end = w + 1;
+        }
+        word_range[2 * s] = first;
+        word_range[2 * s + 1] = end;
+    }
+
+    index->fis = fis;
+    index->num_inputs = fis->num_inputs;
+    index->num_rules = fis->num_rules;
+    index->num_degrees = num_degrees;
+    index->num_words = num_words;
+    index->max_mfs = max_mfs;
+    index->num_indexed = num_indexed;
+    index->first_mf = first_mf;
+    index->mf_rules = mf_rules;
+    index->free_rules = free_rules;
+    index->word_range = word_range;
+    index->first_term = first_term;
+    index->terms = terms;
+    return index;
+}
+
+size_t FIS_Index_WorkspaceSize(const FIS_RuleIndex* index)
+{
+    return sizeof(FIS_IndexWorkspace)
+         + sizeof(float) * index->num_degrees
+         + sizeof(uint64_t) * index->num_words
+         + sizeof(int32_t) * index->num_words
+         + sizeof(int32_t) * index->max_mfs
+         + 5 * (FIS_ARENA_ALIGN - 1);
+}
+
+FIS_IndexWorkspace* FIS_Index_CreateWorkspace(const FIS_RuleIndex* index, FIS_Arena* arena)
+{
+    const size_t mark = arena->used;
+    FIS_IndexWorkspace* ws = FIS_Arena_Alloc(arena, sizeof(FIS_IndexWorkspace), FIS_ARENA_ALIGN);
+    float* degrees = FIS_Arena_Alloc(arena, sizeof(float) * index->num_degrees, FIS_ARENA_ALIGN);
+    uint64_t* rule_mask = FIS_Arena_Alloc(arena, sizeof(uint64_t) * index->num_words, FIS_ARENA_ALIGN);
+    int32_t* live_words = FIS_Arena_Alloc(arena, sizeof(int32_t) * index->num_words, FIS_ARENA_ALIGN);
+    int32_t* active_mfs = FIS_Arena_Alloc(arena, sizeof(int32_t) * index->max_mfs, FIS_ARENA_ALIGN);
+
+    if (ws == NULL || degrees == NULL || rule_mask == NULL || live_words == NULL || active_mfs == NULL)
+    {
+        arena->used = mark;
+        return NULL;
+    }
+
+    ws->degrees = degrees;
+    ws->rule_mask = rule_mask;
+    ws->live_words = live_words;
+    ws->active_mfs = active_mfs;
+    ws->num_evaluated = 0;
+    return ws;
+}
+
+float FIS_Index_Evaluate(const FIS_RuleIndex* index, const float* inputs, FIS_IndexWorkspace* ws)
+{
+    const FIS_System* fis = index->fis;
+    const int num_words = index->num_words;
+    uint64_t* mask = ws->rule_mask;
+    int32_t* live = ws->live_words;
+    int num_live = 0;
+
+    // Fuzzification step for all inputs
+    for (int i = 0; i < index->num_inputs; ++i)
+        FIS_FuzzifyInput(inputs[i], fis->input_mfs[i], fis->num_mfs_per_input[i], &ws->degrees[index->first_mf[i]]);
+
+    // No inputs: no antecedents, every rule is a candidate
+    if (index->num_inputs == 0)
+    {
+        for (int w = 0; w < num_words; ++w)
+        {
+            mask[w] = ~(uint64_t)0;
+            live[num_live++] = w;
+        }
+        if (index->num_rules % FIS_INDEX_WORD_BITS != 0)
+            mask[num_words - 1] = ((uint64_t)1 << (index->num_rules % FIS_INDEX_WORD_BITS)) - 1;
+    }
+
+    // Candidate rules: intersection over inputs of (rules of active MFs | unconstrained rules)
+    for (int i = 0; i < index->num_inputs; ++i)
+    {
+        const float* degrees = &ws->degrees[index->first_mf[i]];
+        const uint64_t* free_rules = &index->free_rules[(size_t)i * num_words];
+        const int free_set = index->num_degrees + i;
+        int num_active = 0;
+
+        for (int m = 0; m < fis->num_mfs_per_input[i]; ++m)
+            if (degrees[m] != 0.0f)
+                ws->active_mfs[num_active++] = index->first_mf[i] + m;
+
+        if (i == 0)
+        {
+            // Scan only the words covered by the sets of the first input
+            int first = index->word_range[2 * free_set];
+            int end = index->word_range[2 * free_set + 1];
+            for (int a = 0; a < num_active; ++a)
+            {
+                const int32_t* range = &index->word_range[2 * ws->active_mfs[a]];
+                first = (range[0] < first) ? range[0] : first;
+                end = (range[1] > end) ? range[1] : end;
+            }
+
+            for (int w = first; w < end; ++w)
+            {
+                uint64_t bits = free_rules[w];
+                for (int a = 0; a < num_active; ++a)
+                    bits |= index->mf_rules[(size_t)ws->active_mfs[a] * num_words + w];
+
+                mask[w] = bits;
+                if (bits != 0)
+                    live[num_live++] = w;
+            }
+        }
+        else
+        {
+            // Words that became zero are dropped from the live list
+            int kept = 0;
+            for (int k = 0; k < num_live; ++k)
+            {
+                const int w = live[k];
+                uint64_t bits = free_rules[w];
+                for (int a = 0; a < num_active; ++a)
+                    bits |= index->mf_rules[(size_t)ws->active_mfs[a] * num_words + w];
+
+                mask[w] &= bits;
+                if (mask[w] != 0)
+                    live[kept++] = w;
+            }
+            num_live = kept;
+        }
+    }
+
+    // Candidate rules in ascending order: same sums as FIS_Evaluate()
+    float numerator = 0.0f;
+    float denominator = 0.0f;
+    int num_evaluated = 0;
+
+    for (int k = 0; k < num_live; ++k)
+    {
+        const int w = live[k];
+        for (uint64_t bits = mask[w]; bits != 0; bits &= bits - 1, ++num_evaluated)
+            FIS_Index_EvaluateRule(index, w * FIS_INDEX_WORD_BITS + FIS_Index_LowestBit(bits), ws->degrees, inputs,
+                                   &numerator, &denominator);
+    }
+    ws->num_evaluated = num_evaluated;
+
+    if (denominator == 0.0f)
+        return 0.0f;
+
+    return numerator / denominator;
+}
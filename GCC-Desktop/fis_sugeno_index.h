@@ -0,0 +1,116 @@
+/**
+  ******************************************************************************
+  * @file		: fis_sugeno_index.h
+  * @author  	: AW		Adrian.Wojcik@put.poznan.pl
+  * @version 	: 1.0.0
+  * @date    	: Oct 17, 2026
+  * @brief   	: Takagi-Sugeno-Kang (Sugeno) Fuzzy Inference System for
+  *               embedded control systems
+  *               Inverted rule index: (input, MF) -> bitset of rules, so only
+  *               rules with all antecedent MFs active are evaluated
+  *
+  ******************************************************************************
+  */
+
+#ifndef INC_FIS_SUGENO_INDEX_H_
+#define INC_FIS_SUGENO_INDEX_H_
+
+/* Public includes -----------------------------------------------------------*/
+#include <stddef.h>
+#include <stdint.h>
+#include "fis_sugeno.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Public typedef ------------------------------------------------------------*/
+/**
+ * @brief Rule sets are bitsets of num_words 64-bit words (bit r: rule r).
+ *        Rules whose weight is not forced to zero by a zero degree (OR rules,
+ *        rules with NULL or custom MFs, rules without antecedents) are in every
+ *        `free_rules` set, so they are always evaluated.
+ */
+typedef struct
+{
+    const FIS_System* fis;
+    int32_t num_inputs;
+    int32_t num_rules;
+    int32_t num_degrees;
+    int32_t num_words;
+    int32_t max_mfs;                // largest number of MFs of an input
+    int32_t num_indexed;            // rules skipped when an antecedent MF is inactive
+    const int32_t* first_mf;        // [num_inputs + 1]: offset of the degrees of each input
+    const uint64_t* mf_rules;       // [num_degrees][num_words]: rules with the MF in the antecedent
+    const uint64_t* free_rules;     // [num_inputs][num_words]: rules not constrained by the input
+    const int32_t* word_range;      // [num_degrees + num_inputs][2]: first and end non-zero word of
+                                    // each mf_rules set, then of each free_rules set
+    const int32_t* first_term;      // [num_rules + 1]: antecedent terms of each rule
+    const int32_t* terms;           // degree index of every antecedent term, input order
+} FIS_RuleIndex;
+
+/**
+ * @brief Caller-owned scratch memory of FIS_Index_Evaluate().
+ */
+typedef struct
+{
+    float* degrees;                 // [num_degrees]
+    uint64_t* rule_mask;            // [num_words]: candidate rules
+    int32_t* live_words;            // [num_words]: non-zero words of rule_mask, ascending
+    int32_t* active_mfs;            // [max_mfs]: MFs of the current input with a non-zero degree
+    int32_t num_evaluated;          // rules evaluated by the last call
+} FIS_IndexWorkspace;
+
+/* Public function prototypes ------------------------------------------------*/
+/**
+ * @brief Computes the arena space needed by FIS_Index_Create().
+ *
+ * @param[in] fis       Pointer to the FIS system definition.
+ * @return              Size in bytes (including alignment padding).
+ */
+size_t FIS_Index_Size(const FIS_System* fis);
+
+/**
+ * @brief Builds the inverted index of a FIS. The FIS must stay valid (MFs and
+ *        consequents are evaluated through it).
+ *
+ * @param[in]     fis       Pointer to the FIS system definition.
+ * @param[in,out] arena     Arena receiving the index.
+ * @return                  Pointer to the index or NULL if a rule references a
+ *                          non-existent MF or the arena is exhausted.
+ */
+const FIS_RuleIndex* FIS_Index_Create(const FIS_System* fis, FIS_Arena* arena);
+
+/**
+ * @brief Computes the arena space needed by FIS_Index_CreateWorkspace().
+ */
+size_t FIS_Index_WorkspaceSize(const FIS_RuleIndex* index);
+
+/**
+ * @brief Allocates a workspace for FIS_Index_Evaluate() (one per thread).
+ *
+ * @param[in]     index     Pointer to the index.
+ * @param[in,out] arena     Arena receiving the workspace.
+ * @return                  Pointer to the workspace or NULL if the arena is exhausted.
+ */
+FIS_IndexWorkspace* FIS_Index_CreateWorkspace(const FIS_RuleIndex* index, FIS_Arena* arena);
+
+/**
+ * @brief Evaluates the FIS visiting only candidate rules: the rule sets of the
+ *        active MFs (non-zero degree) of each input are intersected word by word,
+ *        words that become zero are dropped, and the remaining rules are evaluated
+ *        in ascending order. For finite inputs the result is bit-identical to
+ *        FIS_Evaluate().
+ *
+ * @param[in]     index     Pointer to the index.
+ * @param[in]     inputs    Array of crisp input values.
+ * @param[in,out] ws        Workspace created with FIS_Index_CreateWorkspace().
+ * @return                  Final crisp output after inference and defuzzification.
+ */
+float FIS_Index_Evaluate(const FIS_RuleIndex* index, const float* inputs, FIS_IndexWorkspace* ws);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* INC_FIS_SUGENO_INDEX_H_ */
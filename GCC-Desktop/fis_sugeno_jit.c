@@ -0,0 +1,270 @@
+/**
+  ******************************************************************************
+  * @file		: fis_sugeno_jit.c
+  * @author  	: AW		Adrian.Wojcik@put.poznan.pl
+  * @version 	: 1.0.0
+  * @date    	: Oct 17, 2026
+  * @brief   	: Takagi-Sugeno-Kang (Sugeno) Fuzzy Inference System for
+  *               embedded control systems
+  *               JIT backend (host only): generated C compiled by the local
+  *               compiler into a shared object and loaded with dlopen()
+  *
+  ******************************************************************************
+  */
+
+#if defined(__unix__) || defined(__APPLE__)
+#define _POSIX_C_SOURCE 200809L
+#endif
+
+/* Private includes ----------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "fis_sugeno_jit.h"
+#include "fis_sugeno_codegen.h"
+
+#if FIS_JIT_SUPPORTED
+#include <dlfcn.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+/* Private define ------------------------------------------------------------*/
+#define FIS_JIT_SYMBOL      "FIS_JIT_Function"
+#define FIS_JIT_PATH_MAX    512
+#define FIS_JIT_MAX_ARGS    32          // compiler command words, flags and file arguments
+#define FIS_JIT_CACHE_NAME  "fis_sugeno"
+
+/* Private functions ---------------------------------------------------------*/
+#if FIS_JIT_SUPPORTED
+static uint64_t FIS_JIT_Hash(uint64_t hash, const char* text)
+{
+    // FNV-1a, 64 bit
+    for (; *text != '\0'; ++text)
+    {
+        hash ^= (unsigned char)*text;
+        hash *= 0x100000001b3ull;
+    }
+    return hash;
+}
+
+/**
+ * @brief Checks that a cache directory (followed if a link) or a shared object (not
+ *        a link) is owned by the caller and not writable by group or others, so no
+ *        other user can plant code that the process loads.
+ */
+static int FIS_JIT_IsPrivate(const char* path, int directory)
+{
+    struct stat info;
+
+    if ((directory ? stat(path, &info) : lstat(path, &info)) != 0)
+        return 0;
+
+    return (directory ? S_ISDIR(info.st_mode) : S_ISREG(info.st_mode))
+        && info.st_uid == geteuid() && (info.st_mode & (S_IWGRP | S_IWOTH)) == 0;
+}
+
+/**
+ * @brief Per-user default cache directory, $XDG_CACHE_HOME/fis_sugeno or
+ *        $HOME/.cache/fis_sugeno, created with mode 0700 if missing.
+ *
+ * @return  1 on success, 0 if neither variable holds an absolute path or the
+ *          directory cannot be created.
+ */
+static int FIS_JIT_DefaultCacheDir(char* dir, size_t size)
+{
+    const char* base = getenv("XDG_CACHE_HOME");
+    const char* home = getenv("HOME");
+    int length;
+
+    if (base != NULL && base[0] == '/')
+        length = snprintf(dir, size, "%s", base);
+    else if (home != NULL && home[0] == '/')
+        length = snprintf(dir, size, "%s/.cache", home);
+    else
+        return 0;
+
+    if (length < 0 || (size_t)length + sizeof("/" FIS_JIT_CACHE_NAME) > size)
+        return 0;
+
+    mkdir(dir, S_IRWXU);
+    strcat(dir, "/" FIS_JIT_CACHE_NAME);
+    return mkdir(dir, S_IRWXU) == 0 || errno == EEXIST;
+}
+
+/**
+ * @brief Splits blank-separated words (no quoting) into argv entries.
+ *
+ * @return  Number of words, or -1 if argv is full.
+ */
+static int FIS_JIT_SplitWords(char* text, char** argv, int max_args)
+{
+    int argc = 0;
+
+    for (char* word = strtok(text, " \t"); word != NULL; word = strtok(NULL, " \t"))
+    {
+        if (argc == max_args)
+            return -1;
+        argv[argc++] = word;
+    }
+    return argc;
+}
+
+/**
+ * @brief Runs the compiler without a shell (output discarded).
+ *
+ * @return  1 if it exited with status 0.
+ */
+static int FIS_JIT_Run(char* const* argv)
+{
+    const pid_t pid = fork();
+    if (pid < 0)
+        return 0;
+
+    if (pid == 0)
+    {
+        const int null = open("/dev/null", O_WRONLY);
+        if (null >= 0)
+        {
+            dup2(null, STDOUT_FILENO);
+            dup2(null, STDERR_FILENO);
+        }
+        execvp(argv[0], argv);
+        _exit(127);
+    }
+
+    int status;
+    while (waitpid(pid, &status, 0) < 0)
+    {
+        if (errno != EINTR)
+            return 0;
+    }
+    return WIFEXITED(status) && WEXITSTATUS(status) == 0;
+}
+
+/**
+ * @brief Writes the source to a new file next to the target (mkstemp(), never an
+ *        existing file or link) and compiles it; the shared object is made private
+ *        and renamed into place, so concurrent processes never load a partial file.
+ */
+static int FIS_JIT_Compile(const char* source, const char* cc, const char* path)
+{
+    char source_path[FIS_JIT_PATH_MAX + 64];
+    char object_path[FIS_JIT_PATH_MAX + 64];
+    char words[FIS_JIT_PATH_MAX];
+    char* argv[FIS_JIT_MAX_ARGS + 1];
+
+    snprintf(source_path, sizeof(source_path), "%s.c.XXXXXX", path);
+    snprintf(object_path, sizeof(object_path), "%s.tmp.XXXXXX", path);
+    const int source_fd = mkstemp(source_path);
+    if (source_fd < 0)
+        return 0;
+    const int object_fd = mkstemp(object_path);
+    if (object_fd < 0)
+    {
+        close(source_fd);
+        remove(source_path);
+        return 0;
+    }
+    close(object_fd);
+
+    int written = 0;
+    FILE* file = fdopen(source_fd, "w");
+    if (file != NULL)
+    {
+        written = (fputs(source, file) >= 0);
+        written = (fclose(file) == 0) && written;
+    }
+    else
+        close(source_fd);
+
+    // cc [words of cc] [FIS_JIT_CFLAGS] -o object -x c source
+    int argc = 0;
+    const int length = snprintf(words, sizeof(words), "%s %s", cc, FIS_JIT_CFLAGS);
+    const int count = (length > 0 && (size_t)length < sizeof(words)) ? FIS_JIT_SplitWords(words, argv, FIS_JIT_MAX_ARGS - 5) : -1;
+    if (count > 0)
+    {
+        argc = count;
+        argv[argc++] = "-o";
+        argv[argc++] = object_path;
+        argv[argc++] = "-x";
+        argv[argc++] = "c";
+        argv[argc++] = source_path;
+        argv[argc] = NULL;
+    }
+
+    const int compiled = written && argc > 0 && FIS_JIT_Run(argv)
+                      && chmod(object_path, S_IRWXU) == 0 && rename(object_path, path) == 0;
+
+    remove(source_path);
+    if (!compiled)
+        remove(object_path);
+    return compiled;
+}
+#endif
+
+/* Public functions ----------------------------------------------------------*/
+FIS_JIT* FIS_JIT_Create(FIS_System* fis, const char* cache_dir, FIS_Arena* arena)
+{
+    FIS_JIT* jit = FIS_Arena_Alloc(arena, sizeof(FIS_JIT), FIS_ARENA_ALIGN);
+    if (jit == NULL)
+        return NULL;
+
+    *jit = (FIS_JIT){ .fis = fis, .function = NULL, .handle = NULL, .hash = 0, .cache_hit = 0 };
+
+#if FIS_JIT_SUPPORTED
+    size_t length = FIS_Codegen_Emit(fis, FIS_JIT_SYMBOL, NULL, 0);
+    char* source = (length > 0) ? malloc(length + 1) : NULL;
+    if (source == NULL)
+        return jit;
+    FIS_Codegen_Emit(fis, FIS_JIT_SYMBOL, source, length + 1);
+
+    const char* cc = getenv("FIS_JIT_CC");
+    if (cc == NULL || cc[0] == '\0')
+        cc = FIS_JIT_CC;
+
+    // Content hash: same FIS and compiler share one shared object
+    jit->hash = FIS_JIT_Hash(FIS_JIT_Hash(FIS_JIT_Hash(0xcbf29ce484222325ull, source), cc), FIS_JIT_CFLAGS);
+
+    // Only a private cache directory and shared objects owned by the caller are used
+    char dir[FIS_JIT_PATH_MAX];
+    char path[FIS_JIT_PATH_MAX + 32];
+    const int have_dir = (cache_dir != NULL) ? (snprintf(dir, sizeof(dir), "%s", cache_dir) < (int)sizeof(dir))
+                                             : FIS_JIT_DefaultCacheDir(dir, sizeof(dir));
+    if (have_dir && FIS_JIT_IsPrivate(dir, 1))
+    {
+        snprintf(path, sizeof(path), "%s/fis_%016llx.so", dir, (unsigned long long)jit->hash);
+
+        jit->cache_hit = FIS_JIT_IsPrivate(path, 0);
+        if ((jit->cache_hit || FIS_JIT_Compile(source, cc, path)) && FIS_JIT_IsPrivate(path, 0))
+            jit->handle = dlopen(path, RTLD_NOW | RTLD_LOCAL);
+    }
+    free(source);
+
+    if (jit->handle != NULL)
+    {
+        // POSIX: object pointers returned by dlsym() may be converted to function pointers
+        *(void**)&jit->function = dlsym(jit->handle, FIS_JIT_SYMBOL);
+        if (jit->function == NULL)
+            FIS_JIT_Release(jit);
+    }
+#else
+    (void)cache_dir;
+#endif
+
+    return jit;
+}
+
+void FIS_JIT_Release(FIS_JIT* jit)
+{
+    jit->function = NULL;
+#if FIS_JIT_SUPPORTED
+    if (jit->handle != NULL)
+        dlclose(jit->handle);
+#endif
+    jit->handle = NULL;
+}
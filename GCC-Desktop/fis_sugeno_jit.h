@@ -0,0 +1,96 @@
+/**
+  ******************************************************************************
+  * @file		: fis_sugeno_jit.h
+  * @author  	: AW		Adrian.Wojcik@put.poznan.pl
+  * @version 	: 1.0.0
+  * @date    	: Oct 17, 2026
+  * @brief   	: Takagi-Sugeno-Kang (Sugeno) Fuzzy Inference System for
+  *               embedded control systems
+  *               JIT backend (host only): generated C compiled by the local
+  *               compiler into a shared object and loaded with dlopen()
+  *
+  ******************************************************************************
+  */
+
+#ifndef INC_FIS_SUGENO_JIT_H_
+#define INC_FIS_SUGENO_JIT_H_
+
+/* Public includes -----------------------------------------------------------*/
+#include <stdint.h>
+#include "fis_sugeno.h"
+
+/* Public define -------------------------------------------------------------*/
+#if defined(__unix__) || defined(__APPLE__)
+#define FIS_JIT_SUPPORTED   1       // dlopen() available; otherwise always interpreted
+#else
+#define FIS_JIT_SUPPORTED   0
+#endif
+
+#ifndef FIS_JIT_CC
+#define FIS_JIT_CC          "cc"    // Compiler command (overridden by the FIS_JIT_CC environment variable)
+#endif
+
+#ifndef FIS_JIT_CFLAGS
+#define FIS_JIT_CFLAGS      "-O2 -fPIC -shared -ffp-contract=off"
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Public typedef ------------------------------------------------------------*/
+typedef float (*FIS_JIT_Function)(const float* inputs);
+
+typedef struct
+{
+    FIS_System* fis;            // interpreter fallback
+    FIS_JIT_Function function;  // native code (NULL: FIS_Evaluate())
+    void* handle;               // dlopen() handle
+    uint64_t hash;              // FNV-1a of the generated source and the compiler command
+    int cache_hit;              // shared object loaded from the cache without compiling
+} FIS_JIT;
+
+/* Public function prototypes ------------------------------------------------*/
+/**
+ * @brief Generates C code for the FIS (FIS_Codegen_Emit()), compiles it into
+ *        `<cache_dir>/fis_<hash>.so` unless already cached, and loads it. The compiler
+ *        runs without a shell (FIS_JIT_CC and FIS_JIT_CFLAGS are split at blanks).
+ *        The cache directory and the shared object must be owned by the caller and
+ *        not writable by group or others. Without a working compiler or a private
+ *        cache, or for FIS not supported by the code generator, the JIT falls back
+ *        to FIS_Evaluate().
+ *
+ * @param[in]     fis         Pointer to the FIS system definition (kept for the fallback).
+ * @param[in]     cache_dir   Directory of compiled shared objects (NULL: $XDG_CACHE_HOME/fis_sugeno
+ *                            or $HOME/.cache/fis_sugeno, created with mode 0700).
+ * @param[in,out] arena       Arena for the FIS_JIT object.
+ * @return                    Pointer to the JIT or NULL if the arena is exhausted.
+ */
+FIS_JIT* FIS_JIT_Create(FIS_System* fis, const char* cache_dir, FIS_Arena* arena);
+
+/**
+ * @brief Evaluates the FIS with native code (or FIS_Evaluate() as fallback).
+ *
+ * @param[in] jit       Pointer to the JIT.
+ * @param[in] inputs    Array of crisp input values.
+ * @return              Crisp output, identical to FIS_Evaluate() for finite inputs.
+ */
+static inline float FIS_JIT_Evaluate(const FIS_JIT* jit, float* inputs)
+{
+    if (jit->function != NULL)
+        return jit->function(inputs);
+    return FIS_Evaluate(jit->fis, inputs);
+}
+
+/**
+ * @brief Unloads the shared object (the cached file is kept).
+ *
+ * @param[in,out] jit   Pointer to the JIT; falls back to FIS_Evaluate() afterwards.
+ */
+void FIS_JIT_Release(FIS_JIT* jit);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* INC_FIS_SUGENO_JIT_H_ */
@@ -0,0 +1,548 @@
+/**
+  ******************************************************************************
+  * @file		: fis_sugeno_loader.c
+  * @author  	: AW		Adrian.Wojcik@put.poznan.pl
+  * @version 	: 1.0.0
+  * @date    	: Oct 17, 2026
+  * @brief   	: Takagi-Sugeno-Kang (Sugeno) Fuzzy Inference System for
+  *               embedded control systems
+  *               MATLAB Fuzzy Logic Toolbox '.fis' file loader: single-pass
+  *               parser building a FIS_System inside an arena
+  *
+  ******************************************************************************
+  */
+
+/* Private includes ----------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "fis_sugeno_loader.h"
+
+/* Private typedef -----------------------------------------------------------*/
+typedef enum
+{
+    FIS_SECTION_NONE,
+    FIS_SECTION_SYSTEM,
+    FIS_SECTION_INPUT,
+    FIS_SECTION_OUTPUT,
+    FIS_SECTION_RULES,
+    FIS_SECTION_OTHER           // ignored (e.g. [Output2] is rejected by NumOutputs)
+} FIS_LoaderSection;
+
+/**
+ * @brief Parser state. Tables are allocated from the arena as soon as their size
+ *        is known (NumInputs, NumRules, NumMFs), so no intermediate copies are made.
+ */
+typedef struct
+{
+    FIS_Arena* arena;
+    FIS_System* fis;
+    FIS_LoaderSection section;
+    int input;                          // current [Input<k>] section, 0-based
+    int* mf_indices;                    // [num_rules][num_inputs], rule antecedents
+    FIS_MembershipFunction** null_mf;   // shared MF array of inputs without MFs
+    int num_output_mfs;
+    const float** outputs;              // coefficients {p1, ..., pn, p0} of output MFs
+    int num_rules_read;
+    FIS_LogicType and_method;
+    FIS_LogicType or_method;
+    int out_of_memory;                  // sticky: an allocation failed (error line 0)
+} FIS_Loader;
+
+/* Private functions - lexing ------------------------------------------------*/
+static const char* FIS_Loader_SkipBlank(const char* p, const char* end)
+{
+    while (p < end && (*p == ' ' || *p == '\t' || *p == '\r'))
+        ++p;
+    return p;
+}
+
+static int FIS_Loader_IsNumberStart(char c)
+{
+    return (c >= '0' && c <= '9') || c == '-' || c == '+' || c == '.';
+}
+
+/**
+ * @brief Parses a number on the current line (strtof() would skip line breaks).
+ */
+static const char* FIS_Loader_Float(const char* p, const char* end, float* value)
+{
+    char* next;
+
+    p = FIS_Loader_SkipBlank(p, end);
+    if (p >= end || !FIS_Loader_IsNumberStart(*p))
+        return NULL;
+
+    *value = strtof(p, &next);
+    return (next == p || next > end) ? NULL : next;
+}
+
+static const char* FIS_Loader_Int(const char* p, const char* end, int* value)
+{
+    char* next;
+
+    p = FIS_Loader_SkipBlank(p, end);
+    if (p >= end || !FIS_Loader_IsNumberStart(*p))
+        return NULL;
+
+    *value = (int)strtol(p, &next, 10);
+    return (next == p || next > end) ? NULL : next;
+}
+
+/**
+ * @brief Consumes `c` (after blanks) or returns NULL.
+ */
+static const char* FIS_Loader_Expect(const char* p, const char* end, char c)
+{
+    p = FIS_Loader_SkipBlank(p, end);
+    return (p < end && *p == c) ? p + 1 : NULL;
+}
+
+/**
+ * @brief Parses a quoted string 'text'; returns its bounds in [*text, *text_end).
+ */
+static const char* FIS_Loader_String(const char* p, const char* end, const char** text, const char** text_end)
+{
+    p = FIS_Loader_Expect(p, end, '\'');
+    if (p == NULL)
+        return NULL;
+
+    *text = p;
+    while (p < end && *p != '\'')
+        ++p;
+    *text_end = p;
+    return (p < end) ? p + 1 : NULL;
+}
+
+static int FIS_Loader_Equals(const char* text, const char* text_end, const char* word)
+{
+    size_t n = strlen(word);
+    return (size_t)(text_end - text) == n && memcmp(text, word, n) == 0;
+}
+
+/**
+ * @brief Parses a quoted value and checks it against a list of accepted words.
+ * @return Index of the matching word, or -1.
+ */
+static int FIS_Loader_Choice(const char* p, const char* end, const char* const* words, int count)
+{
+    const char *text, *text_end;
+
+    if (FIS_Loader_String(p, end, &text, &text_end) == NULL)
+        return -1;
+    for (int k = 0; k < count; ++k)
+        if (FIS_Loader_Equals(text, text_end, words[k]))
+            return k;
+    return -1;
+}
+
+/**
+ * @brief Parses "[v1 v2 ... vn]" with exactly `count` values.
+ */
+static const char* FIS_Loader_Vector(const char* p, const char* end, float* values, int count)
+{
+    p = FIS_Loader_Expect(p, end, '[');
+    for (int k = 0; p != NULL && k < count; ++k)
+        p = FIS_Loader_Float(p, end, &values[k]);
+    return (p != NULL) ? FIS_Loader_Expect(p, end, ']') : NULL;
+}
+
+/* Private functions - sections ----------------------------------------------*/
+static void* FIS_Loader_Alloc(FIS_Loader* loader, size_t size)
+{
+    void* block = FIS_Arena_Alloc(loader->arena, size, FIS_ARENA_ALIGN);
+    if (block != NULL)
+        memset(block, 0, size);
+    else
+        loader->out_of_memory = 1;
+    return block;
+}
+
+/**
+ * @brief [System] keys. NumInputs and NumRules allocate the FIS tables.
+ */
+static int FIS_Loader_System(FIS_Loader* loader, const char* key, const char* key_end, const char* p, const char* end)
+{
+    static const char* const and_methods[] = { "min", "prod" };
+    static const char* const or_methods[] = { "max", "probor" };
+    static const char* const sugeno[] = { "sugeno" };
+    static const char* const wtaver[] = { "wtaver" };
+    FIS_System* fis = loader->fis;
+    int value;
+
+    if (FIS_Loader_Equals(key, key_end, "Type"))
+        return FIS_Loader_Choice(p, end, sugeno, 1) == 0;
+
+    if (FIS_Loader_Equals(key, key_end, "DefuzzMethod"))
+        return FIS_Loader_Choice(p, end, wtaver, 1) == 0;
+
+    if (FIS_Loader_Equals(key, key_end, "AndMethod"))
+    {
+        value = FIS_Loader_Choice(p, end, and_methods, 2);
+        loader->and_method = (value == 1) ? FIS_AND_PRODUCT : FIS_AND_MIN;
+        return value >= 0;
+    }
+
+    if (FIS_Loader_Equals(key, key_end, "OrMethod"))
+    {
+        value = FIS_Loader_Choice(p, end, or_methods, 2);
+        loader->or_method = (value == 1) ? FIS_OR_PROB_SUM : FIS_OR_MAX;
+        return value >= 0;
+    }
+
+    if (FIS_Loader_Equals(key, key_end, "NumOutputs"))
+        return FIS_Loader_Int(p, end, &value) != NULL && value == 1;
+
+    if (FIS_Loader_Equals(key, key_end, "NumInputs"))
+    {
+        if (FIS_Loader_Int(p, end, &value) == NULL || value < 1 || fis->num_inputs != 0)
+            return 0;
+
+        fis->num_inputs = value;
+        fis->num_mfs_per_input = FIS_Loader_Alloc(loader, sizeof(int) * value);
+        fis->input_mfs = FIS_Loader_Alloc(loader, sizeof(FIS_MembershipFunction**) * value);
+        loader->null_mf = FIS_Loader_Alloc(loader, sizeof(FIS_MembershipFunction*));
+        if (fis->num_mfs_per_input == NULL || fis->input_mfs == NULL || loader->null_mf == NULL)
+            return 0;
+
+        for (int i = 0; i < value; ++i)
+            fis->input_mfs[i] = loader->null_mf;
+        return 1;
+    }
+
+    if (FIS_Loader_Equals(key, key_end, "NumRules"))
+    {
+        // Antecedent storage needs NumInputs (written before NumRules)
+        if (FIS_Loader_Int(p, end, &value) == NULL || value < 0 || fis->num_inputs == 0 || fis->rules != NULL)
+            return 0;
+
+        fis->num_rules = value;
+        fis->rules = FIS_Loader_Alloc(loader, sizeof(FIS_Rule) * (value > 0 ? value : 1));
+        loader->mf_indices = FIS_Loader_Alloc(loader, sizeof(int) * fis->num_inputs * (value > 0 ? value : 1));
+        return fis->rules != NULL && loader->mf_indices != NULL;
+    }
+
+    return 1; // Name, Version, ImpMethod, AggMethod: no effect on a weighted average
+}
+
+/**
+ * @brief [Input<k>] keys: NumMFs, then MF<m>='name':'trimf'|'trapmf',[params].
+ */
+static int FIS_Loader_Input(FIS_Loader* loader, const char* key, const char* key_end, const char* p, const char* end)
+{
+    static const char* const mf_types[] = { "trimf", "trapmf" };
+    FIS_System* fis = loader->fis;
+    const int i = loader->input;
+    const char *text, *text_end;
+    int value;
+
+    if (FIS_Loader_Equals(key, key_end, "NumMFs"))
+    {
+        if (FIS_Loader_Int(p, end, &value) == NULL || value < 0 || fis->num_mfs_per_input[i] != 0)
+            return 0;
+        if (value == 0)
+            return 1;
+
+        fis->num_mfs_per_input[i] = value;
+        fis->input_mfs[i] = FIS_Loader_Alloc(loader, sizeof(FIS_MembershipFunction*) * value);
+        return fis->input_mfs[i] != NULL;
+    }
+
+    if (key_end - key > 2 && memcmp(key, "MF", 2) == 0)
+    {
+        const int m = atoi(key + 2) - 1;
+        if (m < 0 || m >= fis->num_mfs_per_input[i] || fis->input_mfs[i][m] != NULL)
+            return 0;
+
+        // 'name':'type',[params]
+        p = FIS_Loader_String(p, end, &text, &text_end);
+        p = (p != NULL) ? FIS_Loader_Expect(p, end, ':') : NULL;
+        const int type = (p != NULL) ? FIS_Loader_Choice(p, end, mf_types, 2) : -1;
+        if (type < 0)
+            return 0;
+        p = FIS_Loader_String(p, end, &text, &text_end);
+        p = FIS_Loader_Expect(p, end, ',');
+        if (p == NULL)
+            return 0;
+
+        FIS_MembershipFunction* mf = FIS_Loader_Alloc(loader, sizeof(FIS_MembershipFunction));
+        if (mf == NULL)
+            return 0;
+
+        if (type == 0)
+        {
+            FIS_MF_TriangularParams* params = FIS_Loader_Alloc(loader, sizeof(FIS_MF_TriangularParams));
+            float v[3];
+            if (params == NULL || FIS_Loader_Vector(p, end, v, 3) == NULL)
+                return 0;
+            *params = (FIS_MF_TriangularParams){ .a = v[0], .b = v[1], .c = v[2] };
+            *mf = (FIS_MembershipFunction){ .eval = FIS_MF_TriangularEval, .params = params };
+        }
+        else
+        {
+            FIS_MF_TrapezoidalParams* params = FIS_Loader_Alloc(loader, sizeof(FIS_MF_TrapezoidalParams));
+            float v[4];
+            if (params == NULL || FIS_Loader_Vector(p, end, v, 4) == NULL)
+                return 0;
+            *params = (FIS_MF_TrapezoidalParams){ .a = v[0], .b = v[1], .c = v[2], .d = v[3] };
+            *mf = (FIS_MembershipFunction){ .eval = FIS_MF_TrapezoidalEval, .params = params };
+        }
+
+        fis->input_mfs[i][m] = mf;
+        return 1;
+    }
+
+    return 1; // Name, Range
+}
+
+/**
+ * @brief [Output1] keys: NumMFs, then MF<m>='name':'linear'|'constant',[params].
+ *        Both are stored as linear coefficients {p1, ..., pn, p0}.
+ */
+static int FIS_Loader_Output(FIS_Loader* loader, const char* key, const char* key_end, const char* p, const char* end)
+{
+    static const char* const mf_types[] = { "linear", "constant" };
+    const int n = loader->fis->num_inputs;
+    const char *text, *text_end;
+    int value;
+
+    if (FIS_Loader_Equals(key, key_end, "NumMFs"))
+    {
+        if (FIS_Loader_Int(p, end, &value) == NULL || value < 1 || loader->outputs != NULL)
+            return 0;
+
+        loader->num_output_mfs = value;
+        loader->outputs = FIS_Loader_Alloc(loader, sizeof(const float*) * value);
+        return loader->outputs != NULL;
+    }
+
+    if (key_end - key > 2 && memcmp(key, "MF", 2) == 0)
+    {
+        const int m = atoi(key + 2) - 1;
+        if (m < 0 || m >= loader->num_output_mfs || loader->outputs[m] != NULL)
+            return 0;
+
+        p = FIS_Loader_String(p, end, &text, &text_end);
+        p = (p != NULL) ? FIS_Loader_Expect(p, end, ':') : NULL;
+        const int type = (p != NULL) ? FIS_Loader_Choice(p, end, mf_types, 2) : -1;
+        if (type < 0)
+            return 0;
+        p = FIS_Loader_String(p, end, &text, &text_end);
+        p = FIS_Loader_Expect(p, end, ',');
+
+        float* coefficients = FIS_Loader_Alloc(loader, sizeof(float) * (n + 1));
+        if (p == NULL || coefficients == NULL)
+            return 0;
+
+        // constant: only p0, all input coefficients stay zero
+        if (FIS_Loader_Vector(p, end, (type == 0) ? coefficients : &coefficients[n], (type == 0) ? n + 1 : 1) == NULL)
+            return 0;
+
+        loader->outputs[m] = coefficients;
+        return 1;
+    }
+
+    return 1; // Name, Range
+}
+
+/**
+ * @brief [Rules] line: "<mf of input 1> ... <mf of input n>, <output mf> (<weight>) : <1 AND | 2 OR>".
+ */
+static int FIS_Loader_Rule(FIS_Loader* loader, const char* p, const char* end)
+{
+    FIS_System* fis = loader->fis;
+    const int n = fis->num_inputs;
+    int output, connection;
+    float weight;
+
+    if (loader->outputs == NULL || loader->num_rules_read >= fis->num_rules)
+        return 0;
+
+    int* mf_indices = &loader->mf_indices[loader->num_rules_read * n];
+    for (int i = 0; i < n; ++i)
+    {
+        int value;
+        p = FIS_Loader_Int(p, end, &value);
+        if (p == NULL || value < 0 || value > fis->num_mfs_per_input[i])
+            return 0; // negated antecedents (value < 0) are not supported
+        mf_indices[i] = value - 1;
+    }
+
+    p = FIS_Loader_Expect(p, end, ',');
+    p = (p != NULL) ? FIS_Loader_Int(p, end, &output) : NULL;
+    p = (p != NULL) ? FIS_Loader_Expect(p, end, '(') : NULL;
+    p = (p != NULL) ? FIS_Loader_Float(p, end, &weight) : NULL;
+    p = (p != NULL) ? FIS_Loader_Expect(p, end, ')') : NULL;
+    p = (p != NULL) ? FIS_Loader_Expect(p, end, ':') : NULL;
+    p = (p != NULL) ? FIS_Loader_Int(p, end, &connection) : NULL;
+
+    if (p == NULL || output < 1 || output > loader->num_output_mfs || loader->outputs[output - 1] == NULL
+        || weight != 1.0f || (connection != 1 && connection != 2))
+        return 0;
+
+    fis->rules[loader->num_rules_read++] = (FIS_Rule){
+        .mf_indices = mf_indices,
+        .consequent = NULL,
+        .logic_type = (connection == 1) ? loader->and_method : loader->or_method,
+        .coefficients = loader->outputs[output - 1]
+    };
+    return 1;
+}
+
+/**
+ * @brief Section header "[System]", "[Input<k>]", "[Output1]", "[Rules]".
+ */
+static int FIS_Loader_Section(FIS_Loader* loader, const char* p, const char* end)
+{
+    const char* name = p + 1;
+    const char* name_end = memchr(name, ']', end - name);
+    if (name_end == NULL)
+        return 0;
+
+    if (FIS_Loader_Equals(name, name_end, "System"))
+    {
+        loader->section = FIS_SECTION_SYSTEM;
+        return 1;
+    }
+
+    // [System] must come first: all other sections need NumInputs
+    if (loader->fis->num_inputs == 0)
+        return 0;
+
+    if (name_end - name > 5 && memcmp(name, "Input", 5) == 0)
+    {
+        loader->section = FIS_SECTION_INPUT;
+        loader->input = atoi(name + 5) - 1;
+        return loader->input >= 0 && loader->input < loader->fis->num_inputs;
+    }
+    if (FIS_Loader_Equals(name, name_end, "Output1"))
+        loader->section = FIS_SECTION_OUTPUT;
+    else if (FIS_Loader_Equals(name, name_end, "Rules"))
+        loader->section = FIS_SECTION_RULES;
+    else
+        loader->section = FIS_SECTION_OTHER;
+    return 1;
+}
+
+static int FIS_Loader_Line(FIS_Loader* loader, const char* p, const char* end)
+{
+    if (*p == '[')
+        return FIS_Loader_Section(loader, p, end);
+
+    if (loader->section == FIS_SECTION_RULES)
+        return FIS_Loader_Rule(loader, p, end);
+
+    const char* value = memchr(p, '=', end - p);
+    if (value == NULL)
+        return 0;
+
+    const char* key_end = value++;
+    while (key_end > p && (key_end[-1] == ' ' || key_end[-1] == '\t'))
+        --key_end;
+
+    switch (loader->section)
+    {
+        case FIS_SECTION_SYSTEM:
+            return FIS_Loader_System(loader, p, key_end, value, end);
+        case FIS_SECTION_INPUT:
+            return FIS_Loader_Input(loader, p, key_end, value, end);
+        case FIS_SECTION_OUTPUT:
+            return FIS_Loader_Output(loader, p, key_end, value, end);
+        case FIS_SECTION_OTHER:
+            return 1;
+        default:
+            return 0;
+    }
+}
+
+/**
+ * @brief Checks that every declared MF, output MF and rule was defined.
+ */
+static int FIS_Loader_Complete(const FIS_Loader* loader)
+{
+    const FIS_System* fis = loader->fis;
+
+    if (fis->num_inputs == 0 || fis->rules == NULL || loader->num_rules_read != fis->num_rules)
+        return 0;
+
+    for (int i = 0; i < fis->num_inputs; ++i)
+        for (int m = 0; m < fis->num_mfs_per_input[i]; ++m)
+            if (fis->input_mfs[i][m] == NULL)
+                return 0;
+
+    return 1;
+}
+
+/* Public functions ----------------------------------------------------------*/
+FIS_System* FIS_Load(const char* text, FIS_Arena* arena, int* error_line)
+{
+    const size_t mark = arena->used;
+    int line = 0;
+    int ok = 0;
+
+    FIS_Loader loader = {
+        .arena = arena,
+        .fis = FIS_Arena_Alloc(arena, sizeof(FIS_System), FIS_ARENA_ALIGN),
+        .section = FIS_SECTION_NONE,
+        .and_method = FIS_AND_MIN,
+        .or_method = FIS_OR_MAX
+    };
+
+    if (loader.fis != NULL)
+    {
+        *loader.fis = (FIS_System){ .num_inputs = 0, .num_mfs_per_input = NULL, .input_mfs = NULL, .rules = NULL, .num_rules = 0 };
+        ok = 1;
+
+        // Single pass over the text, one line at a time
+        for (const char* p = text; ok && *p != '\0'; )
+        {
+            const char* end = p + strcspn(p, "\n");
+            const char* next = (*end == '\n') ? end + 1 : end;
+            ++line;
+
+            p = FIS_Loader_SkipBlank(p, end);
+            ok = (p == end) || FIS_Loader_Line(&loader, p, end);
+            p = next;
+        }
+    }
+
+    if (error_line != NULL)
+        *error_line = (ok || loader.out_of_memory) ? 0 : line;
+
+    if (ok && FIS_Loader_Complete(&loader))
+        return loader.fis;
+
+    arena->used = mark;
+    return NULL;
+}
+
+FIS_System* FIS_LoadFile(const char* path, FIS_Arena* arena, int* error_line)
+{
+    FILE* file = fopen(path, "rb");
+    char* text = NULL;
+    long size = -1;
+
+    if (file != NULL && fseek(file, 0, SEEK_END) == 0)
+        size = ftell(file);
+    if (size >= 0 && fseek(file, 0, SEEK_SET) == 0)
+        text = malloc(size + 1);
+    if (text != NULL && fread(text, 1, size, file) != (size_t)size)
+    {
+        free(text);
+        text = NULL;
+    }
+    if (file != NULL)
+        fclose(file);
+
+    if (text == NULL)
+    {
+        if (error_line != NULL)
+            *error_line = -1;
+        return NULL;
+    }
+
+    text[size] = '\0';
+    FIS_System* fis = FIS_Load(text, arena, error_line);
+    free(text);
+    return fis;
+}
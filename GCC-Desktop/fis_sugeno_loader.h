@@ -0,0 +1,56 @@
+/**
+  ******************************************************************************
+  * @file		: fis_sugeno_loader.h
+  * @author  	: AW		Adrian.Wojcik@put.poznan.pl
+  * @version 	: 1.0.0
+  * @date    	: Oct 17, 2026
+  * @brief   	: Takagi-Sugeno-Kang (Sugeno) Fuzzy Inference System for
+  *               embedded control systems
+  *               MATLAB Fuzzy Logic Toolbox '.fis' file loader: single-pass
+  *               parser building a FIS_System inside an arena
+  *
+  ******************************************************************************
+  */
+
+#ifndef INC_FIS_SUGENO_LOADER_H_
+#define INC_FIS_SUGENO_LOADER_H_
+
+/* Public includes -----------------------------------------------------------*/
+#include "fis_sugeno.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Public function prototypes ------------------------------------------------*/
+/**
+ * @brief Parses a Sugeno FIS in the MATLAB '.fis' text format (writeFIS()): [System],
+ *        [Input<k>] with trimf/trapmf MFs, one [Output1] with linear/constant MFs
+ *        and [Rules]. AndMethod min/prod, OrMethod max/probor and DefuzzMethod wtaver
+ *        are supported; rule weights must be 1 and negated antecedents are rejected.
+ *        Sections are read in file order: [System] first and [Rules] last.
+ *
+ * @param[in]     text         NUL-terminated file contents.
+ * @param[in,out] arena        Arena receiving the FIS_System and all its tables (one
+ *                             contiguous block); left unchanged on error.
+ * @param[out]    error_line   Line of the first error (0: arena exhausted or missing
+ *                             data at the end of the file). May be NULL.
+ * @return                     Pointer to the FIS or NULL on error.
+ */
+FIS_System* FIS_Load(const char* text, FIS_Arena* arena, int* error_line);
+
+/**
+ * @brief Reads a '.fis' file and parses it with FIS_Load().
+ *
+ * @param[in]     path         File path.
+ * @param[in,out] arena        Arena receiving the FIS (the file buffer is temporary).
+ * @param[out]    error_line   As in FIS_Load(); -1 if the file cannot be read. May be NULL.
+ * @return                     Pointer to the FIS or NULL on error.
+ */
+FIS_System* FIS_LoadFile(const char* path, FIS_Arena* arena, int* error_line);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* INC_FIS_SUGENO_LOADER_H_ */
@@ -0,0 +1,468 @@
+/**
+  ******************************************************************************
+  * @file		: fis_sugeno_lut.c
+  * @author  	: AW		Adrian.Wojcik@put.poznan.pl
+  * @version 	: 1.0.0
+  * @date    	: Oct 17, 2026
+  * @brief   	: Takagi-Sugeno-Kang (Sugeno) Fuzzy Inference System for
+  *               embedded control systems
+  *               Look-up table backend: normalized rule weights tabulated over
+  *               the antecedent inputs (one or two) and interpolated at run time
+  *
+  ******************************************************************************
+  */
+
+/* Private includes ----------------------------------------------------------*/
+#include <stddef.h>
+#include <string.h>
+#include "fis_sugeno_lut.h"
+
+/* Private define ------------------------------------------------------------*/
+#define FIS_LUT_PROBES_PER_CELL     3       // Interior probes per cell and axis (1/4, 1/2, 3/4)
+#define FIS_LUT_BREAKPOINT_OFFSET   1e-3f   // Probe offset from MF breakpoints (fraction of a cell)
+#define FIS_LUT_LIMIT_OFFSET        1e-6f   // Offset of one-sided limits (fraction of the axis range)
+
+/* Private macro -------------------------------------------------------------*/
+#define __FIS_LUT_ABS(x)            (((x) < 0.0f) ? -(x) : (x))
+
+/* Private typedef -----------------------------------------------------------*/
+/**
+ * @brief Temporary state of FIS_LUT_Create(): exact engine workspace and probe vector.
+ */
+typedef struct
+{
+    const FIS_Plan* plan;
+    FIS_PlanWorkspace* ws;
+    float* x;                   // [num_inputs], non-antecedent inputs stay 0
+    float* exact;               // [num_rules]
+} FIS_LUT_Builder;
+
+/* Private functions ---------------------------------------------------------*/
+/**
+ * @brief Input index owning a degree slot of the plan.
+ */
+static int FIS_LUT_SlotInput(const FIS_Plan* plan, int slot)
+{
+    const FIS_PlanInput* inputs = FIS_PLAN_INPUTS(plan);
+
+    for (int i = 0; i < plan->num_inputs; ++i)
+        if (slot >= inputs[i].first_mf && slot < inputs[i].first_mf + inputs[i].num_mfs)
+            return i;
+    return -1;
+}
+
+/**
+ * @brief Finds the inputs used by antecedents and the MF support of each of them.
+ *
+ * @return  1 on success, 0 if the plan cannot be tabulated.
+ */
+static int FIS_LUT_InitAxes(const FIS_Plan* plan, FIS_LUT* lut)
+{
+    const FIS_PlanRule* rules = FIS_PLAN_RULES(plan);
+    const int32_t* terms = FIS_PLAN_TERMS(plan);
+    const FIS_PlanInput* inputs = FIS_PLAN_INPUTS(plan);
+    const FIS_PlanMF* mfs = FIS_PLAN_MFS(plan);
+
+    lut->num_axes = 0;
+    for (int r = 0; r < plan->num_rules; ++r)
+    {
+        for (int t = rules[r].first_term; t < rules[r].first_term + rules[r].num_terms; ++t)
+        {
+            const int input = FIS_LUT_SlotInput(plan, terms[t]);
+            int a = 0;
+            while (a < lut->num_axes && lut->axes[a].input != input)
+                ++a;
+            if (a < lut->num_axes)
+                continue;
+            if (lut->num_axes == FIS_LUT_MAX_AXES)
+                return 0;
+            lut->axes[lut->num_axes++].input = input;
+        }
+    }
+
+    if (lut->num_axes == 0)
+        return 0;
+
+    for (int a = 0; a < lut->num_axes; ++a)
+    {
+        FIS_LUT_Axis* axis = &lut->axes[a];
+        const FIS_PlanInput* input = &inputs[axis->input];
+        int first = 1;
+
+        axis->num_breakpoints = 0;
+        for (int k = input->first_mf; k < input->first_mf + input->num_mfs; ++k)
+        {
+            float points[4];
+            int num_points;
+
+            switch (mfs[k].type)
+            {
+                case FIS_MF_TYPE_TRIANGULAR:
+                    points[0] = mfs[k].params.tri.a;
+                    points[1] = mfs[k].params.tri.b;
+                    points[2] = mfs[k].params.tri.c;
+                    num_points = 3;
+                    break;
+                case FIS_MF_TYPE_TRAPEZOIDAL:
+                    points[0] = mfs[k].params.trap.a;
+                    points[1] = mfs[k].params.trap.b;
+                    points[2] = mfs[k].params.trap.c;
+                    points[3] = mfs[k].params.trap.d;
+                    num_points = 4;
+                    break;
+                case FIS_MF_TYPE_NONE:
+                    num_points = 0;
+                    break;
+                default:
+                    return 0;   // custom MF: support and breakpoints unknown
+            }
+
+            for (int p = 0; p < num_points; ++p)
+            {
+                if (axis->num_breakpoints == FIS_LUT_MAX_BREAKPOINTS)
+                    return 0;
+                axis->breakpoints[axis->num_breakpoints++] = points[p];
+
+                if (first || points[p] < axis->lower)
+                    axis->lower = points[p];
+                if (first || points[p] > axis->upper)
+                    axis->upper = points[p];
+                first = 0;
+            }
+        }
+
+        if (first || !(axis->lower < axis->upper))
+            return 0;
+    }
+    return 1;
+}
+
+/**
+ * @brief Grid coordinate of a point on an axis.
+ */
+static inline float FIS_LUT_Node(const FIS_LUT_Axis* axis, int index)
+{
+    if (index == axis->num_points - 1)
+        return axis->upper;
+    return axis->lower + (axis->upper - axis->lower) * (float)index / (float)(axis->num_points - 1);
+}
+
+/**
+ * @brief Checks whether x is one of the MF breakpoints of the axis.
+ */
+static inline int FIS_LUT_IsBreakpoint(const FIS_LUT_Axis* axis, float x)
+{
+    for (int b = 0; b < axis->num_breakpoints; ++b)
+        if (x == axis->breakpoints[b])
+            return 1;
+    return 0;
+}
+
+/**
+ * @brief Grid cell and interpolation fraction of an input value.
+ *
+ * @return  1 if the value is covered by the table, 0 if it must be evaluated exactly
+ *          (outside the grid, at an MF breakpoint or NaN).
+ */
+static inline int FIS_LUT_Locate(const FIS_LUT_Axis* axis, float x, int* index, float* fraction)
+{
+    if (!(x >= axis->lower && x <= axis->upper) || FIS_LUT_IsBreakpoint(axis, x))
+        return 0;
+
+    const float t = (x - axis->lower) * axis->inv_step;
+    int i = (int)t;
+    if (i > axis->num_points - 2)
+        i = axis->num_points - 2;
+
+    *index = i;
+    *fraction = t - (float)i;
+    return 1;
+}
+
+/**
+ * @brief Interpolated normalized weight of rule r (linear or bilinear).
+ */
+static inline float FIS_LUT_Weight(const FIS_LUT* lut, const int* index, const float* fraction, int r)
+{
+    const int R = lut->num_rules;
+
+    if (lut->num_axes == 1)
+    {
+        const float* w = &lut->table[index[0] * R + r];
+        return w[0] + fraction[0] * (w[R] - w[0]);
+    }
+
+    const int row = lut->axes[1].num_points * R;
+    const float* w = &lut->table[(index[0] * lut->axes[1].num_points + index[1]) * R + r];
+    const float w0 = w[0] + fraction[1] * (w[R] - w[0]);
+    const float w1 = w[row] + fraction[1] * (w[row + R] - w[row]);
+    return w0 + fraction[0] * (w1 - w0);
+}
+
+/**
+ * @brief Exact normalized rule weights at the builder probe vector.
+ */
+static void FIS_LUT_ExactWeights(FIS_LUT_Builder* builder)
+{
+    const FIS_Plan* plan = builder->plan;
+    float denominator = 0.0f;
+
+    FIS_Plan_RuleWeights(plan, builder->x, builder->ws);
+    for (int r = 0; r < plan->num_rules; ++r)
+        denominator += builder->ws->rule_output[r].weight;
+
+    for (int r = 0; r < plan->num_rules; ++r)
+        builder->exact[r] = (denominator == 0.0f) ? 0.0f : builder->ws->rule_output[r].weight / denominator;
+}
+
+/**
+ * @brief Table entry of a grid node. Nodes on an MF breakpoint store the mean of the
+ *        one-sided limits, so isolated breakpoint values do not spread into the cells.
+ */
+static void FIS_LUT_TabulateNode(const FIS_LUT* lut, FIS_LUT_Builder* builder, const int* node, float* entry)
+{
+    float coordinate[FIS_LUT_MAX_AXES];
+    int on_breakpoint = -1;
+
+    for (int a = 0; a < lut->num_axes; ++a)
+    {
+        coordinate[a] = FIS_LUT_Node(&lut->axes[a], node[a]);
+        builder->x[lut->axes[a].input] = coordinate[a];
+        if (on_breakpoint < 0 && FIS_LUT_IsBreakpoint(&lut->axes[a], coordinate[a]))
+            on_breakpoint = a;
+    }
+
+    if (on_breakpoint < 0)
+    {
+        FIS_LUT_ExactWeights(builder);
+        memcpy(entry, builder->exact, sizeof(float) * lut->num_rules);
+        return;
+    }
+
+    const FIS_LUT_Axis* axis = &lut->axes[on_breakpoint];
+    const float offset = (axis->upper - axis->lower) * FIS_LUT_LIMIT_OFFSET;
+    int sides = 0;
+
+    memset(entry, 0, sizeof(float) * lut->num_rules);
+    for (int side = -1; side <= 1; side += 2)
+    {
+        const float x = coordinate[on_breakpoint] + side * offset;
+        if (x < axis->lower || x > axis->upper)
+            continue;
+
+        builder->x[axis->input] = x;
+        FIS_LUT_ExactWeights(builder);
+        for (int r = 0; r < lut->num_rules; ++r)
+            entry[r] += builder->exact[r];
+        ++sides;
+    }
+
+    for (int r = 0; r < lut->num_rules; ++r)
+        entry[r] /= (float)sides;
+}
+
+/**
+ * @brief Probe coordinates of an axis: interior points of every cell and points
+ *        on both sides of every MF breakpoint.
+ *
+ * @return  Number of probes written to `probes`.
+ */
+static int FIS_LUT_AxisProbes(const FIS_LUT_Axis* axis, float* probes)
+{
+    const float step = (axis->upper - axis->lower) / (float)(axis->num_points - 1);
+    int n = 0;
+
+    for (int i = 0; i < axis->num_points - 1; ++i)
+    {
+        for (int p = 1; p <= FIS_LUT_PROBES_PER_CELL; ++p)
+        {
+            const float x = axis->lower + step * ((float)i + (float)p / (FIS_LUT_PROBES_PER_CELL + 1));
+            if (!FIS_LUT_IsBreakpoint(axis, x))
+                probes[n++] = x;
+        }
+    }
+
+    for (int b = 0; b < axis->num_breakpoints; ++b)
+    {
+        for (int side = -1; side <= 1; side += 2)
+        {
+            const float x = axis->breakpoints[b] + side * step * FIS_LUT_BREAKPOINT_OFFSET;
+            if (x > axis->lower && x < axis->upper && !FIS_LUT_IsBreakpoint(axis, x))
+                probes[n++] = x;
+        }
+    }
+    return n;
+}
+
+/**
+ * @brief Max error of the interpolated normalized weights over all probes.
+ */
+static float FIS_LUT_GridError(const FIS_LUT* lut, FIS_LUT_Builder* builder, float* probes[FIS_LUT_MAX_AXES])
+{
+    int num_probes[FIS_LUT_MAX_AXES] = { 1, 1 };
+    int index[FIS_LUT_MAX_AXES] = { 0, 0 };
+    float fraction[FIS_LUT_MAX_AXES] = { 0.0f, 0.0f };
+    float max_error = 0.0f;
+
+    for (int a = 0; a < lut->num_axes; ++a)
+        num_probes[a] = FIS_LUT_AxisProbes(&lut->axes[a], probes[a]);
+
+    for (int p0 = 0; p0 < num_probes[0]; ++p0)
+    {
+        for (int p1 = 0; p1 < num_probes[1]; ++p1)
+        {
+            const int p[FIS_LUT_MAX_AXES] = { p0, p1 };
+            for (int a = 0; a < lut->num_axes; ++a)
+            {
+                builder->x[lut->axes[a].input] = probes[a][p[a]];
+                FIS_LUT_Locate(&lut->axes[a], probes[a][p[a]], &index[a], &fraction[a]);
+            }
+
+            FIS_LUT_ExactWeights(builder);
+            for (int r = 0; r < lut->num_rules; ++r)
+            {
+                const float error = __FIS_LUT_ABS(FIS_LUT_Weight(lut, index, fraction, r) - builder->exact[r]);
+                if (error > max_error)
+                    max_error = error;
+            }
+        }
+    }
+    return max_error;
+}
+
+/* Public functions ----------------------------------------------------------*/
+size_t FIS_LUT_MaxSize(const FIS_Plan* plan)
+{
+    return sizeof(FIS_LUT)
+         + sizeof(float) * FIS_LUT_MAX_POINTS * plan->num_rules
+         + FIS_Plan_WorkspaceSize(plan)
+         + sizeof(float) * (plan->num_inputs + plan->num_rules)
+         + sizeof(float) * FIS_LUT_MAX_AXES * (FIS_LUT_MAX_POINTS * FIS_LUT_PROBES_PER_CELL + 2 * FIS_LUT_MAX_BREAKPOINTS)
+         + (4 + FIS_LUT_MAX_AXES) * (FIS_PLAN_ALIGN - 1);
+}
+
+const FIS_LUT* FIS_LUT_Create(const FIS_Plan* plan, float max_error, FIS_Arena* arena)
+{
+    const size_t start = arena->used;
+    FIS_LUT* lut = FIS_Arena_Alloc(arena, sizeof(FIS_LUT), FIS_PLAN_ALIGN);
+    if (lut == NULL)
+        return NULL;
+
+    memset(lut, 0, sizeof(FIS_LUT));
+    lut->plan = plan;
+    lut->num_rules = plan->num_rules;
+    if (!FIS_LUT_InitAxes(plan, lut))
+    {
+        arena->used = start;
+        return NULL;
+    }
+
+    const size_t mark = arena->used;
+
+    // Grid refinement: 2, 3, 5, 9, ... points per axis
+    for (int intervals = 1; ; intervals *= 2)
+    {
+        int total = 1;
+        for (int a = 0; a < lut->num_axes; ++a)
+            total *= intervals + 1;
+        if (total > FIS_LUT_MAX_POINTS)
+            break;
+
+        arena->used = mark;
+        float* table = FIS_Arena_Alloc(arena, sizeof(float) * total * lut->num_rules, FIS_PLAN_ALIGN);
+        const size_t table_end = arena->used;
+
+        // Temporary memory, released before returning
+        FIS_LUT_Builder builder = { .plan = plan };
+        float* probes[FIS_LUT_MAX_AXES] = { NULL, NULL };
+        builder.ws = FIS_Plan_CreateWorkspace(plan, arena);
+        builder.x = FIS_Arena_Alloc(arena, sizeof(float) * plan->num_inputs, FIS_PLAN_ALIGN);
+        builder.exact = FIS_Arena_Alloc(arena, sizeof(float) * plan->num_rules, FIS_PLAN_ALIGN);
+        for (int a = 0; a < lut->num_axes; ++a)
+            probes[a] = FIS_Arena_Alloc(arena, sizeof(float) * (intervals * FIS_LUT_PROBES_PER_CELL + 2 * FIS_LUT_MAX_BREAKPOINTS), FIS_PLAN_ALIGN);
+
+        if (table == NULL || builder.ws == NULL || builder.x == NULL || builder.exact == NULL ||
+            probes[0] == NULL || (lut->num_axes > 1 && probes[1] == NULL))
+            break;
+
+        memset(builder.x, 0, sizeof(float) * plan->num_inputs);
+        for (int a = 0; a < lut->num_axes; ++a)
+        {
+            FIS_LUT_Axis* axis = &lut->axes[a];
+            axis->num_points = intervals + 1;
+            axis->inv_step = (float)intervals / (axis->upper - axis->lower);
+        }
+
+        int node[FIS_LUT_MAX_AXES] = { 0, 0 };
+        for (int n = 0; n < total; ++n)
+        {
+            node[0] = (lut->num_axes == 1) ? n : n / (intervals + 1);
+            node[1] = (lut->num_axes == 1) ? 0 : n % (intervals + 1);
+            FIS_LUT_TabulateNode(lut, &builder, node, &table[n * lut->num_rules]);
+        }
+
+        lut->table = table;
+        lut->max_error = FIS_LUT_GridError(lut, &builder, probes);
+        if (lut->max_error <= max_error)
+        {
+            arena->used = table_end;
+            return lut;
+        }
+    }
+
+    arena->used = start;
+    return NULL;
+}
+
+float FIS_LUT_Evaluate(const FIS_LUT* lut, const float* inputs, FIS_PlanWorkspace* ws)
+{
+    const FIS_Plan* plan = lut->plan;
+    const FIS_PlanRule* rules = FIS_PLAN_RULES(plan);
+    int index[FIS_LUT_MAX_AXES];
+    float fraction[FIS_LUT_MAX_AXES];
+
+    for (int a = 0; a < lut->num_axes; ++a)
+        if (!FIS_LUT_Locate(&lut->axes[a], inputs[lut->axes[a].input], &index[a], &fraction[a]))
+            return FIS_Plan_Evaluate(plan, inputs, ws);
+
+    if (plan->flags & FIS_PLAN_FLAG_GAIN_BLENDING)
+    {
+        for (int l = 0; l < plan->num_linear; ++l)
+            ws->linear_outputs[l] = 0.0f;
+        for (int r = 0; r < lut->num_rules; ++r)
+            ws->linear_outputs[rules[r].consequent] += FIS_LUT_Weight(lut, index, fraction, r);
+        return FIS_Plan_BlendedOutput(plan, inputs, ws->linear_outputs);
+    }
+
+    // Weights summed per distinct consequent: each is evaluated once
+    float* weights = ws->consequent_weights;
+    float output = 0.0f;
+
+    for (int c = 0; c < plan->num_consequents; ++c)
+        weights[c] = 0.0f;
+    for (int r = 0; r < lut->num_rules; ++r)
+        weights[rules[r].consequent] += FIS_LUT_Weight(lut, index, fraction, r);
+
+    for (int c = 0; c < plan->num_consequents; ++c)
+    {
+        if (weights[c] != 0.0f)
+            output += weights[c] * FIS_Plan_Consequent(plan, c, inputs);
+    }
+    return output;
+}
+
+float FIS_LUT_Validate(const FIS_LUT* lut, const float* inputs, int count, FIS_PlanWorkspace* ws)
+{
+    const int num_inputs = lut->plan->num_inputs;
+    float max_error = 0.0f;
+
+    for (int s = 0; s < count; ++s)
+    {
+        const float exact = FIS_Plan_Evaluate(lut->plan, &inputs[s * num_inputs], ws);
+        const float approx = FIS_LUT_Evaluate(lut, &inputs[s * num_inputs], ws);
+        const float error = __FIS_LUT_ABS(approx - exact);
+        if (error > max_error)
+            max_error = error;
+    }
+    return max_error;
+}
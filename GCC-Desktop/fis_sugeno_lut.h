@@ -0,0 +1,111 @@
+/**
+  ******************************************************************************
+  * @file		: fis_sugeno_lut.h
+  * @author  	: AW		Adrian.Wojcik@put.poznan.pl
+  * @version 	: 1.0.0
+  * @date    	: Oct 17, 2026
+  * @brief   	: Takagi-Sugeno-Kang (Sugeno) Fuzzy Inference System for
+  *               embedded control systems
+  *               Look-up table backend: normalized rule weights tabulated over
+  *               the antecedent inputs (one or two) and interpolated at run time
+  *
+  ******************************************************************************
+  */
+
+#ifndef INC_FIS_SUGENO_LUT_H_
+#define INC_FIS_SUGENO_LUT_H_
+
+/* Public includes -----------------------------------------------------------*/
+#include <stdint.h>
+#include "fis_sugeno_plan.h"
+
+/* Public define -------------------------------------------------------------*/
+#define FIS_LUT_MAX_AXES        2       // Max number of inputs used by antecedents
+#define FIS_LUT_MAX_POINTS      65536   // Max number of grid points (all axes)
+#define FIS_LUT_MAX_BREAKPOINTS 64      // Max number of MF breakpoints per axis
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Public typedef ------------------------------------------------------------*/
+/**
+ * @brief Uniform grid axis over the support of the MFs of one input.
+ *        Inputs outside [lower, upper] or equal to an MF breakpoint are
+ *        evaluated exactly.
+ */
+typedef struct
+{
+    int32_t input;              // input index
+    int32_t num_points;         // grid points, both ends included
+    float lower;
+    float upper;
+    float inv_step;             // (num_points - 1) / (upper - lower)
+    int32_t num_breakpoints;
+    float breakpoints[FIS_LUT_MAX_BREAKPOINTS];
+} FIS_LUT_Axis;
+
+typedef struct
+{
+    const FIS_Plan* plan;       // exact engine: consequents and fallback
+    int32_t num_axes;
+    int32_t num_rules;
+    FIS_LUT_Axis axes[FIS_LUT_MAX_AXES];
+    float max_error;            // achieved max error of the normalized weights (grid check)
+    const float* table;         // [axes[0].num_points][axes[1].num_points][num_rules]
+} FIS_LUT;
+
+/* Public function prototypes ------------------------------------------------*/
+/**
+ * @brief Computes the arena space sufficient for FIS_LUT_Create() (largest grid
+ *        plus a temporary evaluation workspace).
+ *
+ * @param[in] plan      Pointer to the compiled plan.
+ * @return              Size in bytes (including alignment padding).
+ */
+size_t FIS_LUT_MaxSize(const FIS_Plan* plan);
+
+/**
+ * @brief Tabulates the normalized rule weights of a compiled plan. The grid is
+ *        refined (points per axis doubled) until linear interpolation meets
+ *        `max_error` on probes inside every cell and next to every MF breakpoint.
+ *
+ * @param[in]     plan        Pointer to the compiled plan. Antecedents must use at most
+ *                            FIS_LUT_MAX_AXES inputs with triangular/trapezoidal MFs.
+ * @param[in]     max_error   Bound for the max absolute error of normalized weights.
+ * @param[in,out] arena       Arena with at least FIS_LUT_MaxSize() bytes available.
+ *                            Only the final table is kept allocated.
+ * @return                    Pointer to the LUT, or NULL if the plan is not supported,
+ *                            the bound is not met within FIS_LUT_MAX_POINTS or the
+ *                            arena is exhausted.
+ */
+const FIS_LUT* FIS_LUT_Create(const FIS_Plan* plan, float max_error, FIS_Arena* arena);
+
+/**
+ * @brief Evaluates the FIS with interpolated normalized weights (no MF evaluation,
+ *        no division). Falls back to FIS_Plan_Evaluate() outside the grid and at
+ *        MF breakpoints.
+ *
+ * @param[in]     lut       Pointer to the LUT.
+ * @param[in]     inputs    Array of crisp input values.
+ * @param[in,out] ws        Workspace created with FIS_Plan_CreateWorkspace() for lut->plan.
+ * @return                  Crisp output.
+ */
+float FIS_LUT_Evaluate(const FIS_LUT* lut, const float* inputs, FIS_PlanWorkspace* ws);
+
+/**
+ * @brief Validation mode: evaluates test vectors with the LUT and the exact engine.
+ *
+ * @param[in]     lut       Pointer to the LUT.
+ * @param[in]     inputs    Test vectors, `count` rows of lut->plan->num_inputs values.
+ * @param[in]     count     Number of test vectors.
+ * @param[in,out] ws        Workspace created with FIS_Plan_CreateWorkspace() for lut->plan.
+ * @return                  Max absolute output deviation from FIS_Plan_Evaluate().
+ */
+float FIS_LUT_Validate(const FIS_LUT* lut, const float* inputs, int count, FIS_PlanWorkspace* ws);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* INC_FIS_SUGENO_LUT_H_ */
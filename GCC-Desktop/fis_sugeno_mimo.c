@@ -0,0 +1,246 @@
+/**
+  ******************************************************************************
+  * @file		: fis_sugeno_mimo.c
+  * @author  	: AW		Adrian.Wojcik@put.poznan.pl
+  * @version 	: 1.0.0
+  * @date    	: Oct 17, 2026
+  * @brief   	: Takagi-Sugeno-Kang (Sugeno) Fuzzy Inference System for
+  *               embedded control systems
+  *               Multi-output FIS: systems sharing their antecedents are
+  *               evaluated with one fuzzification and one set of rule weights
+  *
+  ******************************************************************************
+  */
+
+/* Private includes ----------------------------------------------------------*/
+#include <string.h>
+#include "fis_sugeno_mimo.h"
+
+/* Private functions ---------------------------------------------------------*/
+/**
+ * @brief Number of padded matrix rows of a multi-output plan.
+ */
+static int FIS_Mimo_Stride(int num_outputs, int num_rules)
+{
+    return (num_outputs * num_rules + FIS_SIMD_MAX_LANES - 1) / FIS_SIMD_MAX_LANES * FIS_SIMD_MAX_LANES;
+}
+
+/**
+ * @brief Membership functions with the same function and parameters.
+ */
+static int FIS_Mimo_SameMF(const FIS_MembershipFunction* a, const FIS_MembershipFunction* b)
+{
+    if (a == b)
+        return 1;
+    if (a == NULL || b == NULL || a->eval != b->eval)
+        return 0;
+    if (a->params == b->params)
+        return 1;
+    if (a->eval == FIS_MF_TriangularEval)
+        return memcmp(a->params, b->params, sizeof(FIS_MF_TriangularParams)) == 0;
+    if (a->eval == FIS_MF_TrapezoidalEval)
+        return memcmp(a->params, b->params, sizeof(FIS_MF_TrapezoidalParams)) == 0;
+    return 0;
+}
+
+/**
+ * @brief Systems with the same inputs, MFs, rules and connectives.
+ */
+static int FIS_Mimo_SameAntecedents(const FIS_System* a, const FIS_System* b)
+{
+    if (a->num_inputs != b->num_inputs || a->num_rules != b->num_rules)
+        return 0;
+
+    for (int i = 0; i < a->num_inputs; ++i)
+    {
+        if (a->num_mfs_per_input[i] != b->num_mfs_per_input[i])
+            return 0;
+        for (int m = 0; m < a->num_mfs_per_input[i]; ++m)
+        {
+            if (!FIS_Mimo_SameMF(a->input_mfs[i][m], b->input_mfs[i][m]))
+                return 0;
+        }
+    }
+
+    for (int r = 0; r < a->num_rules; ++r)
+    {
+        if (a->rules[r].logic_type != b->rules[r].logic_type
+            || memcmp(a->rules[r].mf_indices, b->rules[r].mf_indices, sizeof(int) * a->num_inputs) != 0)
+            return 0;
+    }
+    return 1;
+}
+
+/**
+ * @brief Checks if matrix column `column` (input index, num_inputs: constant) has a
+ *        non-zero coefficient in any linear consequent of any output.
+ */
+static int FIS_Mimo_ColumnUsed(const FIS_System* const* systems, int num_outputs, int column)
+{
+    for (int k = 0; k < num_outputs; ++k)
+    {
+        for (int r = 0; r < systems[k]->num_rules; ++r)
+        {
+            const float* coefficients = systems[k]->rules[r].coefficients;
+            if (coefficients != NULL && coefficients[column] != 0.0f)
+                return 1;
+        }
+    }
+    return 0;
+}
+
+/* Public functions ----------------------------------------------------------*/
+size_t FIS_Mimo_Size(const FIS_System* const* systems, int num_outputs)
+{
+    const FIS_System* fis = systems[0];
+
+    // Every allocation may need up to (alignment - 1) bytes of padding
+    return sizeof(FIS_MimoPlan)
+         + FIS_Plan_Size(fis)
+         + sizeof(int32_t) * (fis->num_inputs + 1)
+         + sizeof(float) * (fis->num_inputs + 1) * FIS_Mimo_Stride(num_outputs, fis->num_rules)
+         + sizeof(FIS_ConsequentFunction) * num_outputs * fis->num_rules
+         + 3 * (FIS_ARENA_ALIGN - 1) + (FIS_PLAN_ALIGN - 1);
+}
+
+const FIS_MimoPlan* FIS_Mimo_Compile(const FIS_System* const* systems, int num_outputs, FIS_Arena* arena)
+{
+    const FIS_System* fis = systems[0];
+    const size_t mark = arena->used;
+
+    for (int k = 1; k < num_outputs; ++k)
+    {
+        if (!FIS_Mimo_SameAntecedents(fis, systems[k]))
+            return NULL;
+    }
+
+    int num_columns = 0;
+    for (int c = 0; c <= fis->num_inputs; ++c)
+        num_columns += FIS_Mimo_ColumnUsed(systems, num_outputs, c);
+
+    const int num_rows = num_outputs * fis->num_rules;
+    const int stride = FIS_Mimo_Stride(num_outputs, fis->num_rules);
+    FIS_MimoPlan* mimo = FIS_Arena_Alloc(arena, sizeof(FIS_MimoPlan), FIS_ARENA_ALIGN);
+    const FIS_Plan* plan = FIS_Compile(fis, arena);
+    int32_t* columns = FIS_Arena_Alloc(arena, sizeof(int32_t) * (fis->num_inputs + 1), FIS_ARENA_ALIGN);
+    float* matrix = FIS_Arena_Alloc(arena, sizeof(float) * num_columns * stride, FIS_PLAN_ALIGN);
+    FIS_ConsequentFunction* functions = FIS_Arena_Alloc(arena, sizeof(FIS_ConsequentFunction) * num_rows, FIS_ARENA_ALIGN);
+
+    if (mimo == NULL || plan == NULL || columns == NULL || (matrix == NULL && num_columns > 0)
+        || (functions == NULL && num_rows > 0))
+    {
+        arena->used = mark;
+        return NULL;
+    }
+
+    num_columns = 0;
+    for (int c = 0; c <= fis->num_inputs; ++c)
+    {
+        if (FIS_Mimo_ColumnUsed(systems, num_outputs, c))
+            columns[num_columns++] = c;
+    }
+
+    // Row k * num_rules + r: consequent of rule r for output k (padding rows zero)
+    memset(matrix, 0, sizeof(float) * num_columns * stride);
+    int num_functions = 0;
+    for (int k = 0; k < num_outputs; ++k)
+    {
+        for (int r = 0; r < fis->num_rules; ++r)
+        {
+            const FIS_Rule* rule = &systems[k]->rules[r];
+            const int row = k * fis->num_rules + r;
+
+            functions[row] = (rule->coefficients == NULL) ? rule->consequent : NULL;
+            num_functions += (rule->coefficients == NULL);
+            if (rule->coefficients == NULL)
+                continue;
+
+            for (int c = 0; c < num_columns; ++c)
+                matrix[c * stride + row] = rule->coefficients[columns[c]];
+        }
+    }
+
+    mimo->plan = plan;
+    mimo->num_inputs = fis->num_inputs;
+    mimo->num_outputs = num_outputs;
+    mimo->num_rules = fis->num_rules;
+    mimo->num_columns = num_columns;
+    mimo->stride = stride;
+    mimo->num_functions = num_functions;
+    mimo->columns = columns;
+    mimo->matrix = matrix;
+    mimo->functions = functions;
+    return mimo;
+}
+
+size_t FIS_Mimo_WorkspaceSize(const FIS_MimoPlan* mimo)
+{
+    return sizeof(FIS_MimoWorkspace)
+         + FIS_Plan_WorkspaceSize(mimo->plan)
+         + sizeof(float) * mimo->num_columns
+         + sizeof(float) * mimo->stride
+         + (FIS_ARENA_ALIGN - 1) + 2 * (FIS_PLAN_ALIGN - 1);
+}
+
+FIS_MimoWorkspace* FIS_Mimo_CreateWorkspace(const FIS_MimoPlan* mimo, FIS_Arena* arena)
+{
+    const size_t mark = arena->used;
+    FIS_MimoWorkspace* ws = FIS_Arena_Alloc(arena, sizeof(FIS_MimoWorkspace), FIS_ARENA_ALIGN);
+    FIS_PlanWorkspace* plan_ws = FIS_Plan_CreateWorkspace(mimo->plan, arena);
+    float* linear_inputs = FIS_Arena_Alloc(arena, sizeof(float) * mimo->num_columns, FIS_PLAN_ALIGN);
+    float* consequents = FIS_Arena_Alloc(arena, sizeof(float) * mimo->stride, FIS_PLAN_ALIGN);
+
+    if (ws == NULL || plan_ws == NULL || (linear_inputs == NULL && mimo->num_columns > 0)
+        || (consequents == NULL && mimo->stride > 0))
+    {
+        arena->used = mark;
+        return NULL;
+    }
+
+    ws->ws = plan_ws;
+    ws->linear_inputs = linear_inputs;
+    ws->consequents = consequents;
+    return ws;
+}
+
+void FIS_Mimo_Evaluate(const FIS_MimoPlan* mimo, const float* inputs, float* outputs, FIS_MimoWorkspace* ws)
+{
+    const FIS_RuleOutput* rule_output = ws->ws->rule_output;
+
+    // Shared stages: fuzzification and rule weights
+    FIS_Plan_RuleWeights(mimo->plan, inputs, ws->ws);
+
+    float denominator = 0.0f;
+    for (int r = 0; r < mimo->num_rules; ++r)
+        denominator += rule_output[r].weight;
+
+    if (denominator == 0.0f)
+    {
+        for (int k = 0; k < mimo->num_outputs; ++k)
+            outputs[k] = 0.0f;
+        return;
+    }
+
+    // Linear consequents of all outputs as one matrix-vector product
+    for (int c = 0; c < mimo->num_columns; ++c)
+        ws->linear_inputs[c] = (mimo->columns[c] < mimo->num_inputs) ? inputs[mimo->columns[c]] : 1.0f;
+    FIS_SIMD_Gemv(mimo->matrix, mimo->stride, ws->linear_inputs, mimo->num_columns, ws->consequents);
+
+    // Weighted average per output; consequents of non-firing rules are skipped
+    for (int k = 0; k < mimo->num_outputs; ++k)
+    {
+        const float* consequents = &ws->consequents[k * mimo->num_rules];
+        const FIS_ConsequentFunction* functions = &mimo->functions[k * mimo->num_rules];
+        float numerator = 0.0f;
+
+        for (int r = 0; r < mimo->num_rules; ++r)
+        {
+            const float weight = rule_output[r].weight;
+            if (weight == 0.0f)
+                continue;
+
+            numerator += weight * ((functions[r] != NULL) ? functions[r](inputs) : consequents[r]);
+        }
+        outputs[k] = numerator / denominator;
+    }
+}
@@ -0,0 +1,111 @@
+/**
+  ******************************************************************************
+  * @file		: fis_sugeno_mimo.h
+  * @author  	: AW		Adrian.Wojcik@put.poznan.pl
+  * @version 	: 1.0.0
+  * @date    	: Oct 17, 2026
+  * @brief   	: Takagi-Sugeno-Kang (Sugeno) Fuzzy Inference System for
+  *               embedded control systems
+  *               Multi-output FIS: systems sharing their antecedents are
+  *               evaluated with one fuzzification and one set of rule weights
+  *
+  ******************************************************************************
+  */
+
+#ifndef INC_FIS_SUGENO_MIMO_H_
+#define INC_FIS_SUGENO_MIMO_H_
+
+/* Public includes -----------------------------------------------------------*/
+#include <stddef.h>
+#include <stdint.h>
+#include "fis_sugeno_plan.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Public typedef ------------------------------------------------------------*/
+/**
+ * @brief Compiled multi-output FIS. Consequent k of rule r is matrix row
+ *        k * num_rules + r, so one matrix-vector product gives the linear
+ *        consequents of all outputs.
+ */
+typedef struct
+{
+    const FIS_Plan* plan;                   // antecedents (compiled from the first output)
+    int32_t num_inputs;
+    int32_t num_outputs;
+    int32_t num_rules;
+    int32_t num_columns;                    // columns with a non-zero coefficient in any output
+    int32_t stride;                         // padded number of matrix rows (multiple of FIS_SIMD_MAX_LANES)
+    int32_t num_functions;                  // consequent functions (not in the matrix)
+    const int32_t* columns;                 // [num_columns]: input of each column (num_inputs: constant p0)
+    const float* matrix;                    // [num_columns][stride]: column-major coefficient matrix
+    const FIS_ConsequentFunction* functions;// [num_outputs * num_rules]: consequent functions, NULL if linear
+} FIS_MimoPlan;
+
+/**
+ * @brief Caller-owned scratch memory of FIS_Mimo_Evaluate().
+ */
+typedef struct
+{
+    FIS_PlanWorkspace* ws;                      // plan workspace: degrees and rule weights
+    float* linear_inputs;                   // [num_columns]
+    float* consequents;                     // [stride]: consequent outputs, row by row
+} FIS_MimoWorkspace;
+
+/* Public function prototypes ------------------------------------------------*/
+/**
+ * @brief Computes the arena space needed by FIS_Mimo_Compile().
+ *
+ * @param[in] systems       Array of num_outputs FIS definitions, one per output.
+ * @param[in] num_outputs   Number of outputs.
+ * @return                  Size in bytes (including alignment padding).
+ */
+size_t FIS_Mimo_Size(const FIS_System* const* systems, int num_outputs);
+
+/**
+ * @brief Compiles FIS definitions that differ only in their consequents (same
+ *        inputs, MFs with the same function and parameters, same rules and
+ *        connectives) into one multi-output plan.
+ *
+ * @param[in]     systems       Array of num_outputs FIS definitions, one per output.
+ * @param[in]     num_outputs   Number of outputs.
+ * @param[in,out] arena         Arena with at least FIS_Mimo_Size() bytes available.
+ * @return                      Pointer to the plan, or NULL if the antecedents differ,
+ *                              the first system cannot be compiled or the arena is exhausted.
+ */
+const FIS_MimoPlan* FIS_Mimo_Compile(const FIS_System* const* systems, int num_outputs, FIS_Arena* arena);
+
+/**
+ * @brief Computes the arena space needed by FIS_Mimo_CreateWorkspace().
+ */
+size_t FIS_Mimo_WorkspaceSize(const FIS_MimoPlan* mimo);
+
+/**
+ * @brief Allocates a workspace for FIS_Mimo_Evaluate() (one per thread).
+ *
+ * @param[in]     mimo      Pointer to the multi-output plan.
+ * @param[in,out] arena     Arena receiving the workspace.
+ * @return                  Pointer to the workspace or NULL if the arena is exhausted.
+ */
+FIS_MimoWorkspace* FIS_Mimo_CreateWorkspace(const FIS_MimoPlan* mimo, FIS_Arena* arena);
+
+/**
+ * @brief Evaluates all outputs: the inputs are fuzzified and the rule weights
+ *        computed once, the linear consequents of all outputs are one matrix-vector
+ *        product, and each output is the weighted average of its consequents.
+ *        Results match FIS_Evaluate() of each system to float rounding.
+ *
+ * @param[in]     mimo      Pointer to the multi-output plan.
+ * @param[in]     inputs    Array of crisp input values.
+ * @param[out]    outputs   Array of num_outputs crisp outputs.
+ * @param[in,out] ws        Workspace created with FIS_Mimo_CreateWorkspace().
+ */
+void FIS_Mimo_Evaluate(const FIS_MimoPlan* mimo, const float* inputs, float* outputs, FIS_MimoWorkspace* ws);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* INC_FIS_SUGENO_MIMO_H_ */
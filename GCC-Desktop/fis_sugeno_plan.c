@@ -0,0 +1,1467 @@
+/**
+  ******************************************************************************
+  * @file		: fis_sugeno_plan.c
+  * @author  	: AW		Adrian.Wojcik@put.poznan.pl
+  * @version 	: 1.0.0
+  * @date    	: Oct 17, 2026
+  * @brief   	: Takagi-Sugeno-Kang (Sugeno) Fuzzy Inference System for
+  *               embedded control systems
+  *               Compiled execution plan: FIS_System flattened into a single
+  *               immutable, cache-line-aligned memory block
+  *
+  ******************************************************************************
+  */
+
+/* Private includes ----------------------------------------------------------*/
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include "fis_sugeno_plan.h"
+
+/* Private macro -------------------------------------------------------------*/
+#define __FIS_PLAN_ALIGN_UP(x)      (((x) + FIS_PLAN_ALIGN - 1) & ~(size_t)(FIS_PLAN_ALIGN - 1))
+#define __FIS_PLAN_TABLE_RW(plan, type, offset) \
+    ((type*)((unsigned char*)(plan) + (plan)->offset))
+#define __FIS_PLAN_SEGMENT_MAX_FILL 4       // Segment search only if segments hold at most 4 MFs on average
+
+/* Private functions ---------------------------------------------------------*/
+/**
+ * @brief Membership function shape tag for a FIS_MembershipFunction.
+ */
+static FIS_MF_Type FIS_Plan_MFType(const FIS_MembershipFunction* mf)
+{
+    if (mf == NULL)
+        return FIS_MF_TYPE_NONE;
+    else if (mf->eval == FIS_MF_TriangularEval)
+        return FIS_MF_TYPE_TRIANGULAR;
+    else if (mf->eval == FIS_MF_TrapezoidalEval)
+        return FIS_MF_TYPE_TRAPEZOIDAL;
+    else
+        return FIS_MF_TYPE_CUSTOM;
+}
+
+/**
+ * @brief Checks whether any linear consequent has a non-zero coefficient for
+ *        input `column` (column == num_inputs: constant term).
+ */
+static int FIS_Plan_ColumnUsed(const FIS_System* fis, int column)
+{
+    for (int r = 0; r < fis->num_rules; ++r)
+        if (fis->rules[r].coefficients != NULL && fis->rules[r].coefficients[column] != 0.0f)
+            return 1;
+    return 0;
+}
+
+/**
+ * @brief Checks whether two rules have the same consequent: the same function, or
+ *        linear coefficients with the same bit patterns.
+ */
+static int FIS_Plan_SameConsequent(const FIS_System* fis, const FIS_Rule* a, const FIS_Rule* b)
+{
+    if (a->coefficients == NULL || b->coefficients == NULL)
+        return a->coefficients == b->coefficients && a->consequent == b->consequent;
+
+    return a->coefficients == b->coefficients
+        || memcmp(a->coefficients, b->coefficients, sizeof(float) * (fis->num_inputs + 1)) == 0;
+}
+
+/**
+ * @brief FNV-1a hash of the consequent of a rule (coefficient bits or function pointer).
+ */
+static uint32_t FIS_Plan_ConsequentHash(const FIS_System* fis, const FIS_Rule* rule)
+{
+    const unsigned char* bytes = (const unsigned char*)rule->coefficients;
+    size_t size = sizeof(float) * (fis->num_inputs + 1);
+    uint32_t hash = 2166136261u;
+
+    if (rule->coefficients == NULL)
+    {
+        bytes = (const unsigned char*)&rule->consequent;
+        size = sizeof(rule->consequent);
+    }
+
+    for (size_t k = 0; k < size; ++k)
+        hash = (hash ^ bytes[k]) * 16777619u;
+    return hash;
+}
+
+/**
+ * @brief Number of slots of the consequent hash table of FIS_Compile() (power of
+ *        two, at most half full).
+ */
+static size_t FIS_Plan_HashSize(int num_rules)
+{
+    size_t size = 1;
+    while (size < 2 * (size_t)num_rules)
+        size <<= 1;
+    return size;
+}
+
+/**
+ * @brief Checks whether two packed MFs of a plan have the same shape and parameters.
+ */
+static int FIS_Plan_SameMF(const FIS_Plan* plan, const FIS_PlanMF* a, const FIS_PlanMF* b)
+{
+    if (a->type != b->type)
+        return 0;
+
+    switch (a->type)
+    {
+        case FIS_MF_TYPE_TRIANGULAR:
+            return memcmp(&a->params.tri, &b->params.tri, sizeof(FIS_MF_TriangularParams)) == 0;
+        case FIS_MF_TYPE_TRAPEZOIDAL:
+            return memcmp(&a->params.trap, &b->params.trap, sizeof(FIS_MF_TrapezoidalParams)) == 0;
+        case FIS_MF_TYPE_CUSTOM:
+        {
+            const FIS_PlanCustomMF* custom = __FIS_PLAN_TABLE_RW(plan, FIS_PlanCustomMF, custom_mfs_offset);
+            return custom[a->custom].eval == custom[b->custom].eval && custom[a->custom].params == custom[b->custom].params;
+        }
+        default:
+            return 1;
+    }
+}
+
+/**
+ * @brief Support [lo, hi] of a triangular or trapezoidal MF: the degree is exactly
+ *        zero outside of it.
+ *
+ * @return  1 if the support is known, 0 for other MFs or NaN support ends.
+ */
+static int FIS_Plan_MFSupport(const FIS_MembershipFunction* mf, float* lo, float* hi)
+{
+    switch (FIS_Plan_MFType(mf))
+    {
+        case FIS_MF_TYPE_TRIANGULAR:
+            *lo = ((const FIS_MF_TriangularParams*)mf->params)->a;
+            *hi = ((const FIS_MF_TriangularParams*)mf->params)->c;
+            break;
+        case FIS_MF_TYPE_TRAPEZOIDAL:
+            *lo = ((const FIS_MF_TrapezoidalParams*)mf->params)->a;
+            *hi = ((const FIS_MF_TrapezoidalParams*)mf->params)->d;
+            break;
+        default:
+            return 0;
+    }
+    return *lo == *lo && *hi == *hi;
+}
+
+/**
+ * @brief Number of support ends of the MFs of input `i` below `value`.
+ */
+static int FIS_Plan_SupportRank(const FIS_System* fis, int i, float value)
+{
+    int rank = 0;
+    float lo = 0.0f, hi = 0.0f;
+
+    for (int m = 0; m < fis->num_mfs_per_input[i]; ++m)
+    {
+        FIS_Plan_MFSupport(fis->input_mfs[i][m], &lo, &hi);
+        rank += (lo < value) + (hi < value);
+    }
+    return rank;
+}
+
+/**
+ * @brief Length of the segment MF lists of input `i`: MF m is listed in segments
+ *        2 * rank(lo) + 1 ... 2 * rank(hi) + 1.
+ *
+ * @return  Number of entries, 0 if the input evaluates all MFs (too few MFs, an MF
+ *          without a known support or too many overlapping MFs).
+ */
+static int FIS_Plan_SegmentMFCount(const FIS_System* fis, int i)
+{
+    const int num_mfs = fis->num_mfs_per_input[i];
+    long long count = 0;
+    float lo, hi;
+
+    if (num_mfs < FIS_PLAN_SEGMENT_MIN_MFS)
+        return 0;
+
+    for (int m = 0; m < num_mfs; ++m)
+        if (!FIS_Plan_MFSupport(fis->input_mfs[i][m], &lo, &hi))
+            return 0;
+
+    for (int m = 0; m < num_mfs; ++m)
+    {
+        FIS_Plan_MFSupport(fis->input_mfs[i][m], &lo, &hi);
+        const int lo_rank = FIS_Plan_SupportRank(fis, i, lo);
+        const int hi_rank = FIS_Plan_SupportRank(fis, i, hi);
+        if (hi_rank >= lo_rank)
+            count += 2 * (hi_rank - lo_rank) + 1;
+    }
+
+    if (count > (long long)__FIS_PLAN_SEGMENT_MAX_FILL * (4 * num_mfs + 1))
+        return 0;
+    return (int)count;
+}
+
+/**
+ * @brief Number of breakpoints below `x` (index of the first breakpoint >= x);
+ *        branch-free halving, the loop count depends on `count` only.
+ */
+static inline int FIS_Plan_LowerBound(const float* points, int count, float x)
+{
+    const float* base = points;
+
+    if (count == 0)
+        return 0;
+
+    while (count > 1)
+    {
+        const int half = count >> 1;
+        base = (base[half] < x) ? base + half : base;
+        count -= half;
+    }
+    return (int)(base - points) + (*base < x);
+}
+
+static int FIS_Plan_CompareFloat(const void* a, const void* b)
+{
+    const float x = *(const float*)a;
+    const float y = *(const float*)b;
+    return (x > y) - (x < y);
+}
+
+/**
+ * @brief Rising start, top start, top end and falling end of a triangular or
+ *        trapezoidal MF (triangles: top start == top end).
+ *
+ * @return  1 for triangular and trapezoidal MFs, 0 otherwise.
+ */
+static int FIS_Plan_MFShape(const FIS_MembershipFunction* mf, float shape[4])
+{
+    switch (FIS_Plan_MFType(mf))
+    {
+        case FIS_MF_TYPE_TRIANGULAR:
+        {
+            const FIS_MF_TriangularParams* p = mf->params;
+            shape[0] = p->a;
+            shape[1] = p->b;
+            shape[2] = p->b;
+            shape[3] = p->c;
+            return 1;
+        }
+        case FIS_MF_TYPE_TRAPEZOIDAL:
+        {
+            const FIS_MF_TrapezoidalParams* p = mf->params;
+            shape[0] = p->a;
+            shape[1] = p->b;
+            shape[2] = p->c;
+            shape[3] = p->d;
+            return 1;
+        }
+        default:
+            return 0;
+    }
+}
+
+/**
+ * @brief Rule whose only antecedent is MF `mf` of `input`.
+ *
+ * @return  Rule index, -1 if there is no such rule or more than one.
+ */
+static int FIS_Plan_PartitionRule(const FIS_System* fis, int input, int mf)
+{
+    int found = -1;
+
+    for (int r = 0; r < fis->num_rules; ++r)
+    {
+        if (fis->rules[r].mf_indices[input] != mf)
+            continue;
+        if (found >= 0)
+            return -1;
+        found = r;
+    }
+    return found;
+}
+
+/**
+ * @brief Partition-of-unity check of the scheduling input. Proof obligations:
+ *        - every rule has a single antecedent (its weight is the degree) and every
+ *          MF of the input is the antecedent of exactly one rule;
+ *        - the MFs chain by shared edges: the falling edge of each MF starts and ends
+ *          where the rising edge of the next one does, so on the edge the degrees are
+ *          (e - x) / (e - s) and (x - s) / (e - s), which sum to 1, and elsewhere
+ *          between the first top start and the last top end one degree is 1 and the
+ *          others are 0.
+ *        The weights then sum to 1 (up to rounding), at most two adjacent rules fire
+ *        and the weighted average needs no division.
+ *
+ * @param[out] knots      Tops and edge ends, ascending (NULL: count only).
+ * @param[out] segments   Interval after each knot but the last (NULL: count only).
+ * @return                Number of knots, 0 if the input is not a partition.
+ */
+static int FIS_Plan_PartitionKnots(const FIS_System* fis, int input, float* knots, FIS_PlanPartitionSegment* segments)
+{
+    float shape[4], next[4];
+    int num_knots = 0, mf = -1;
+
+    if (input < 0 || fis->num_mfs_per_input[input] < 2 || fis->num_rules != fis->num_mfs_per_input[input])
+        return 0;
+
+    // The scheduling input is the only one with antecedents: one term per rule
+    for (int r = 0; r < fis->num_rules; ++r)
+        if (fis->rules[r].mf_indices[input] < 0)
+            return 0;
+
+    // Chain starts at the MF with the lowest top
+    float first_top = 0.0f;
+    for (int m = 0; m < fis->num_mfs_per_input[input]; ++m)
+    {
+        if (!FIS_Plan_MFShape(fis->input_mfs[input][m], shape))
+            return 0;
+        if (mf < 0 || shape[1] < first_top)
+        {
+            mf = m;
+            first_top = shape[1];
+        }
+    }
+
+    for (int k = 0; k < fis->num_mfs_per_input[input]; ++k)
+    {
+        const int rule = FIS_Plan_PartitionRule(fis, input, mf);
+        FIS_Plan_MFShape(fis->input_mfs[input][mf], shape);
+        if (rule < 0 || !(shape[1] <= shape[2]))
+            return 0;
+
+        if (k == 0 && knots != NULL)
+            knots[0] = shape[1];
+        if (k == 0)
+            num_knots = 1;
+
+        // Plateau of the MF
+        if (shape[2] > shape[1])
+        {
+            if (segments != NULL)
+                segments[num_knots - 1] = (FIS_PlanPartitionSegment){ 0.0f, rule, rule, 0 };
+            if (knots != NULL)
+                knots[num_knots] = shape[2];
+            ++num_knots;
+        }
+
+        if (k == fis->num_mfs_per_input[input] - 1)
+            break;
+
+        // Next MF: rising edge == falling edge of this one
+        int next_mf = -1;
+        for (int m = 0; m < fis->num_mfs_per_input[input] && next_mf < 0; ++m)
+        {
+            FIS_Plan_MFShape(fis->input_mfs[input][m], next);
+            if (next[0] == shape[2] && next[1] == shape[3] && next[0] < next[1])
+                next_mf = m;
+        }
+        if (next_mf < 0)
+            return 0;
+
+        const int next_rule = FIS_Plan_PartitionRule(fis, input, next_mf);
+        if (segments != NULL)
+            segments[num_knots - 1] = (FIS_PlanPartitionSegment){ 1.0f / (shape[3] - shape[2]), rule, next_rule, 0 };
+        if (knots != NULL)
+            knots[num_knots] = shape[3];
+        ++num_knots;
+        mf = next_mf;
+    }
+    return num_knots;
+}
+
+/**
+ * @brief Checks whether the rules form a complete grid of AND_PRODUCT rules over the
+ *        inputs with MFs, in mixed-radix order (last input fastest): rule r has the
+ *        MF indices of the digits of r. Rule weights are then the outer product of
+ *        the degree vectors.
+ */
+static int FIS_Plan_IsProductGrid(const FIS_System* fis)
+{
+    long long cells = 1;
+    int grid_inputs = 0;
+
+    for (int i = 0; i < fis->num_inputs; ++i)
+    {
+        if (fis->num_mfs_per_input[i] == 0)
+            continue;
+        cells *= fis->num_mfs_per_input[i];
+        ++grid_inputs;
+        if (cells > fis->num_rules)
+            return 0;
+    }
+    if (grid_inputs == 0 || cells != fis->num_rules)
+        return 0;
+
+    for (int r = 0; r < fis->num_rules; ++r)
+    {
+        const FIS_Rule* rule = &fis->rules[r];
+        long long code = 0;
+
+        if (rule->logic_type != FIS_AND_PRODUCT)
+            return 0;
+
+        for (int i = 0; i < fis->num_inputs; ++i)
+        {
+            if (fis->num_mfs_per_input[i] == 0)
+                continue;
+            if (rule->mf_indices[i] < 0)
+                return 0;
+            code = code * fis->num_mfs_per_input[i] + rule->mf_indices[i];
+        }
+        if (code != r)
+            return 0;
+    }
+    return 1;
+}
+
+/**
+ * @brief Counts plan elements and assigns table offsets.
+ *
+ * @return  1 on success, 0 if a rule references a non-existent membership function
+ *          or the plan does not fit the 32-bit table offsets.
+ */
+static int FIS_Plan_Layout(const FIS_System* fis, FIS_Plan* header)
+{
+    memset(header, 0, sizeof(FIS_Plan));
+    header->magic = FIS_PLAN_MAGIC;
+    header->version = FIS_PLAN_VERSION;
+    header->num_inputs = fis->num_inputs;
+    header->num_rules = fis->num_rules;
+    header->num_consequents = fis->num_rules;
+
+    for (int i = 0; i < fis->num_inputs; ++i)
+    {
+        for (int m = 0; m < fis->num_mfs_per_input[i]; ++m)
+            if (FIS_Plan_MFType(fis->input_mfs[i][m]) == FIS_MF_TYPE_CUSTOM)
+                ++header->num_custom_mfs;
+        header->num_degrees += fis->num_mfs_per_input[i];
+
+        const int segment_mfs = FIS_Plan_SegmentMFCount(fis, i);
+        if (segment_mfs > 0)
+        {
+            header->num_breakpoints += 2 * fis->num_mfs_per_input[i];
+            header->num_segments += 4 * fis->num_mfs_per_input[i] + 1;
+            header->num_segment_mfs += segment_mfs;
+        }
+    }
+
+    for (int r = 0; r < fis->num_rules; ++r)
+    {
+        for (int i = 0; i < fis->num_inputs; ++i)
+        {
+            int mf_index = fis->rules[r].mf_indices[i];
+            if (mf_index >= fis->num_mfs_per_input[i])
+                return 0;
+            if (mf_index >= 0)
+                ++header->num_terms;
+        }
+        if (fis->rules[r].coefficients != NULL)
+            ++header->num_linear;
+    }
+
+    // Scheduling-variable structure: all antecedents on a single input
+    int scheduling_input = -1, single_input = 1;
+    for (int r = 0; r < fis->num_rules; ++r)
+    {
+        for (int i = 0; i < fis->num_inputs; ++i)
+        {
+            if (fis->rules[r].mf_indices[i] < 0)
+                continue;
+            if (scheduling_input < 0)
+                scheduling_input = i;
+            else if (scheduling_input != i)
+                single_input = 0;
+        }
+    }
+    header->scheduling_input = single_input ? scheduling_input : -1;
+
+    // Partition of unity on the scheduling input: division-free interpolation between rules
+    header->num_knots = FIS_Plan_PartitionKnots(fis, header->scheduling_input, NULL, NULL);
+    if (header->num_knots > 0)
+        header->flags |= FIS_PLAN_FLAG_PARTITION;
+
+    // All consequents linear and antecedents on the scheduling input only: output is a
+    // blend of the few gain vectors (larger rule bases skip consequents of idle rules)
+    const int all_linear = (fis->num_rules > 0 && header->num_linear == fis->num_rules);
+    if (all_linear && header->scheduling_input >= 0)
+        header->flags |= FIS_PLAN_FLAG_GAIN_BLENDING;
+
+    // Complete AND_PRODUCT grid: the consequent matrix rows form a tensor over the MF indices
+    if (all_linear && FIS_Plan_IsProductGrid(fis))
+        header->flags |= FIS_PLAN_FLAG_TENSOR;
+
+    // Linear matrix: rows padded to full vectors, columns with a non-zero coefficient only
+    header->linear_stride = (header->num_linear + FIS_SIMD_MAX_LANES - 1) / FIS_SIMD_MAX_LANES * FIS_SIMD_MAX_LANES;
+    for (int c = 0; c <= fis->num_inputs; ++c)
+        if (FIS_Plan_ColumnUsed(fis, c))
+            ++header->num_columns;
+
+    size_t offset = __FIS_PLAN_ALIGN_UP(sizeof(FIS_Plan));
+    header->inputs_offset = offset;
+    offset = __FIS_PLAN_ALIGN_UP(offset + sizeof(FIS_PlanInput) * header->num_inputs);
+    header->mfs_offset = offset;
+    offset = __FIS_PLAN_ALIGN_UP(offset + sizeof(FIS_PlanMF) * header->num_degrees);
+    header->rules_offset = offset;
+    offset = __FIS_PLAN_ALIGN_UP(offset + sizeof(FIS_PlanRule) * header->num_rules);
+    header->terms_offset = offset;
+    offset = __FIS_PLAN_ALIGN_UP(offset + sizeof(int32_t) * header->num_terms);
+    header->custom_mfs_offset = offset;
+    offset = __FIS_PLAN_ALIGN_UP(offset + sizeof(FIS_PlanCustomMF) * header->num_custom_mfs);
+    header->columns_offset = offset;
+    offset = __FIS_PLAN_ALIGN_UP(offset + sizeof(int32_t) * header->num_columns);
+    header->matrix_offset = offset;
+    offset = __FIS_PLAN_ALIGN_UP(offset + sizeof(float) * header->num_columns * header->linear_stride);
+    header->consequents_offset = offset;
+    offset = __FIS_PLAN_ALIGN_UP(offset + sizeof(FIS_ConsequentFunction) * (header->num_consequents - header->num_linear));
+    header->breakpoints_offset = offset;
+    offset = __FIS_PLAN_ALIGN_UP(offset + sizeof(float) * header->num_breakpoints);
+    header->segments_offset = offset;
+    offset = __FIS_PLAN_ALIGN_UP(offset + sizeof(int32_t) * (header->num_segments + 1));
+    header->segment_mfs_offset = offset;
+    offset = __FIS_PLAN_ALIGN_UP(offset + sizeof(int32_t) * header->num_segment_mfs);
+    header->knots_offset = offset;
+    offset = __FIS_PLAN_ALIGN_UP(offset + sizeof(float) * header->num_knots);
+    header->partition_offset = offset;
+    offset = __FIS_PLAN_ALIGN_UP(offset + sizeof(FIS_PlanPartitionSegment) * (header->num_knots > 0 ? header->num_knots - 1 : 0));
+
+    // Offsets only grow: the plan end bounds every 32-bit table offset
+    if (offset > UINT32_MAX)
+        return 0;
+    header->size = offset;
+
+    return 1;
+}
+
+/**
+ * @brief Evaluates a packed membership function.
+ */
+static inline float FIS_Plan_EvaluateMF(const FIS_Plan* plan, const FIS_PlanMF* mf, float input)
+{
+    switch (mf->type)
+    {
+        case FIS_MF_TYPE_TRIANGULAR:
+            return FIS_MF_Triangular(input, &mf->params.tri);
+        case FIS_MF_TYPE_TRAPEZOIDAL:
+            return FIS_MF_Trapezoidal(input, &mf->params.trap);
+        case FIS_MF_TYPE_CUSTOM:
+        {
+            const FIS_PlanCustomMF* custom = &FIS_PLAN_CUSTOM_MFS(plan)[mf->custom];
+            return custom->eval(input, custom->params);
+        }
+        default:
+            return -1.0f;
+    }
+}
+
+/**
+ * @brief Degrees of the MFs of one input. With breakpoints, the segment of `x` is
+ *        found from the hint (previous segment or a neighbour, for time series) or
+ *        by binary search, and only its MFs are evaluated; the other degrees are
+ *        zero (identical to evaluating all MFs). The hint is set to the segment, or to -1 when all MFs were evaluated
+ *        (no breakpoints, NaN input: NaN degrees, as FIS_Evaluate()).
+ *
+ * @return  Sum of the degrees of the input, in MF order.
+ */
+static inline float FIS_Plan_FuzzifyInput(const FIS_Plan* plan, const FIS_PlanInput* input, float x, float* degrees, int* hint)
+{
+    const FIS_PlanMF* mfs = &FIS_PLAN_MFS(plan)[input->first_mf];
+    float* degree = &degrees[input->first_mf];
+    const int num_points = input->num_breakpoints;
+    float sum = 0.0f;
+
+    if (num_points == 0 || x != x)
+    {
+        for (int m = 0; m < input->num_mfs; ++m)
+        {
+            degree[m] = (mfs[m].alias == m) ? FIS_Plan_EvaluateMF(plan, &mfs[m], x) : degree[mfs[m].alias];
+            sum += degree[m];
+        }
+        *hint = -1;
+        return sum;
+    }
+
+    // j: number of breakpoints below x, valid if points[j - 1] < x <= points[j]
+    const float* points = &FIS_PLAN_BREAKPOINTS(plan)[input->first_breakpoint];
+    int j = (*hint >= 0 && *hint <= 2 * num_points) ? *hint >> 1 : -1;
+    if (j < 0 || (j > 0 && !(points[j - 1] < x)) || (j < num_points && !(points[j] >= x)))
+    {
+        if (j >= 0 && j < num_points && points[j] < x && (j + 1 == num_points || points[j + 1] >= x))
+            j = j + 1;
+        else if (j > 0 && !(points[j - 1] < x) && (j == 1 || points[j - 2] < x))
+            j = j - 1;
+        else
+            j = FIS_Plan_LowerBound(points, num_points, x);
+    }
+
+    const int s = 2 * j + (j < num_points && points[j] == x);
+    const int32_t* segments = &FIS_PLAN_SEGMENTS(plan)[input->first_segment];
+    const int32_t* segment_mfs = FIS_PLAN_SEGMENT_MFS(plan);
+    *hint = s;
+
+    for (int m = 0; m < input->num_mfs; ++m)
+        degree[m] = 0.0f;
+
+    for (int e = segments[s]; e < segments[s + 1]; ++e)
+    {
+        const int m = segment_mfs[e];
+        degree[m] = (mfs[m].alias == m) ? FIS_Plan_EvaluateMF(plan, &mfs[m], x) : degree[mfs[m].alias];
+        sum += degree[m];
+    }
+    return sum;
+}
+
+/**
+ * @brief Fuzzification step: degrees of all membership functions, input by input.
+ */
+static void FIS_Plan_Fuzzify(const FIS_Plan* plan, const float* inputs, float* degrees, int* hints)
+{
+    const FIS_PlanInput* plan_inputs = FIS_PLAN_INPUTS(plan);
+
+    for (int i = 0; i < plan->num_inputs; ++i)
+        FIS_Plan_FuzzifyInput(plan, &plan_inputs[i], inputs[i], degrees, &hints[i]);
+}
+
+/**
+ * @brief Firing strength of a rule; AND rules stop at the first zero degree.
+ */
+static inline float FIS_Plan_RuleWeight(const FIS_Plan* plan, const FIS_PlanRule* rule, const float* degrees)
+{
+    const int32_t* term = &FIS_PLAN_TERMS(plan)[rule->first_term];
+    const FIS_LogicType logic_type = (FIS_LogicType)rule->logic_type;
+    const int conjunction = FIS_IsConjunction(logic_type);
+    float weight = FIS_InitialWeight(logic_type);
+
+    for (int t = 0; t < rule->num_terms; ++t)
+    {
+        weight = FIS_CombineDegree(logic_type, weight, degrees[term[t]]);
+        if (conjunction && weight == 0.0f)
+            break;
+    }
+    return weight;
+}
+
+/**
+ * @brief Outputs of all linear consequents as one matrix-vector product.
+ */
+static void FIS_Plan_LinearConsequents(const FIS_Plan* plan, const float* inputs, float* linear_inputs, float* linear_outputs)
+{
+    const int32_t* columns = FIS_PLAN_COLUMNS(plan);
+
+    for (int c = 0; c < plan->num_columns; ++c)
+        linear_inputs[c] = (columns[c] < plan->num_inputs) ? inputs[columns[c]] : 1.0f;
+
+    FIS_SIMD_Gemv(FIS_PLAN_MATRIX(plan), plan->linear_stride, linear_inputs, plan->num_columns, linear_outputs);
+}
+
+/**
+ * @brief Output of a distinct consequent (not weighted).
+ */
+static inline float FIS_Plan_ConsequentValue(const FIS_Plan* plan, int consequent, const float* inputs)
+{
+    if (consequent >= plan->num_linear)
+        return FIS_PLAN_CONSEQUENTS(plan)[consequent - plan->num_linear](inputs);
+
+    const int32_t* columns = FIS_PLAN_COLUMNS(plan);
+    const float* matrix = FIS_PLAN_MATRIX(plan);
+    float output = 0.0f;
+    for (int c = 0; c < plan->num_columns; ++c)
+        output += matrix[c * plan->linear_stride + consequent] * ((columns[c] < plan->num_inputs) ? inputs[columns[c]] : 1.0f);
+    return output;
+}
+
+/**
+ * @brief Output of the consequent of a rule (not weighted).
+ */
+static inline float FIS_Plan_ConsequentOutput(const FIS_Plan* plan, int rule, const float* inputs)
+{
+    return FIS_Plan_ConsequentValue(plan, FIS_PLAN_RULES(plan)[rule].consequent, inputs);
+}
+
+/**
+ * @brief Gain blending from the degrees in ws->degrees: normalized weights blend
+ *        the gain vectors, followed by a single dot product with the inputs.
+ */
+static float FIS_Plan_BlendDegrees(const FIS_Plan* plan, const float* inputs, FIS_PlanWorkspace* ws)
+{
+    const FIS_PlanRule* rules = FIS_PLAN_RULES(plan);
+    FIS_RuleOutput* rule_output = ws->rule_output;
+    float* normalized = ws->linear_outputs;
+
+    float denominator = 0.0f;
+    for (int r = 0; r < plan->num_rules; ++r)
+    {
+        rule_output[r].weight = FIS_Plan_RuleWeight(plan, &rules[r], ws->degrees);
+        rule_output[r].output = 0.0f;
+        denominator += rule_output[r].weight;
+    }
+
+    if (denominator == 0.0f)
+        return 0.0f;
+
+    // Normalized weights summed per distinct consequent
+    const float scale = 1.0f / denominator;
+    for (int l = 0; l < plan->num_linear; ++l)
+        normalized[l] = 0.0f;
+    for (int r = 0; r < plan->num_rules; ++r)
+        normalized[rules[r].consequent] += rule_output[r].weight * scale;
+
+    return FIS_Plan_BlendedOutput(plan, inputs, normalized);
+}
+
+/**
+ * @brief Evaluation by gain blending (FIS_PLAN_FLAG_GAIN_BLENDING); only the rule
+ *        weights are stored in ws->rule_output.
+ */
+static float FIS_Plan_EvaluateBlended(const FIS_Plan* plan, const float* inputs, FIS_PlanWorkspace* ws)
+{
+    if (plan->scheduling_input >= 0)
+    {
+        // Only the scheduling input is referenced by the antecedents
+        const int i = plan->scheduling_input;
+        FIS_Plan_FuzzifyInput(plan, &FIS_PLAN_INPUTS(plan)[i], inputs[i], ws->degrees, &ws->segment_hints[i]);
+    }
+    else
+    {
+        FIS_Plan_Fuzzify(plan, inputs, ws->degrees, ws->segment_hints);
+    }
+
+    return FIS_Plan_BlendDegrees(plan, inputs, ws);
+}
+
+/**
+ * @brief Contracts the consequent tensor with the degree vectors of the inputs from
+ *        `input` on, skipping zero degrees. `offset` is the rule index prefix of the
+ *        MF indices chosen for the previous inputs. Inputs fuzzified by segment search
+ *        visit the MFs of their segment only (ascending, as the full loop).
+ */
+static float FIS_Plan_TensorContract(const FIS_Plan* plan, const float* degrees, const int* segment_hints,
+                                     const float* linear_inputs, int input, int offset)
+{
+    const FIS_PlanInput* plan_inputs = FIS_PLAN_INPUTS(plan);
+
+    while (input < plan->num_inputs && plan_inputs[input].num_mfs == 0)
+        ++input;
+
+    // All MF indices chosen: linear consequent of rule `offset`
+    if (input == plan->num_inputs)
+    {
+        const float* matrix = FIS_PLAN_MATRIX(plan);
+        float output = 0.0f;
+        for (int c = 0; c < plan->num_columns; ++c)
+            output += matrix[c * plan->linear_stride + offset] * linear_inputs[c];
+        return output;
+    }
+
+    const FIS_PlanInput* in = &plan_inputs[input];
+    const float* degree = &degrees[in->first_mf];
+    float sum = 0.0f;
+
+    if (segment_hints[input] >= 0)
+    {
+        const int32_t* segments = &FIS_PLAN_SEGMENTS(plan)[in->first_segment + segment_hints[input]];
+        const int32_t* segment_mfs = FIS_PLAN_SEGMENT_MFS(plan);
+        for (int e = segments[0]; e < segments[1]; ++e)
+        {
+            const int m = segment_mfs[e];
+            if (degree[m] != 0.0f)
+                sum += degree[m] * FIS_Plan_TensorContract(plan, degrees, segment_hints, linear_inputs, input + 1,
+                                                           offset * in->num_mfs + m);
+        }
+        return sum;
+    }
+
+    for (int m = 0; m < in->num_mfs; ++m)
+    {
+        if (degree[m] != 0.0f)
+            sum += degree[m] * FIS_Plan_TensorContract(plan, degrees, segment_hints, linear_inputs, input + 1,
+                                                       offset * in->num_mfs + m);
+    }
+    return sum;
+}
+
+/**
+ * @brief Evaluation of a complete AND_PRODUCT grid: the numerator is the contraction
+ *        of the consequent tensor with the degree vectors, the denominator the product
+ *        of the per-input degree sums. Only combinations of non-zero degrees are visited;
+ *        ws->rule_output is not written.
+ */
+static float FIS_Plan_EvaluateTensor(const FIS_Plan* plan, const float* inputs, FIS_PlanWorkspace* ws)
+{
+    const FIS_PlanInput* plan_inputs = FIS_PLAN_INPUTS(plan);
+    const int32_t* columns = FIS_PLAN_COLUMNS(plan);
+
+    // Degree sums in MF order (zero degrees of skipped MFs do not change them)
+    float denominator = 1.0f;
+    for (int i = 0; i < plan->num_inputs; ++i)
+    {
+        const float sum = FIS_Plan_FuzzifyInput(plan, &plan_inputs[i], inputs[i], ws->degrees, &ws->segment_hints[i]);
+        if (plan_inputs[i].num_mfs > 0)
+            denominator *= sum;
+    }
+
+    if (denominator == 0.0f)
+        return 0.0f;
+
+    for (int c = 0; c < plan->num_columns; ++c)
+        ws->linear_inputs[c] = (columns[c] < plan->num_inputs) ? inputs[columns[c]] : 1.0f;
+
+    return FIS_Plan_TensorContract(plan, ws->degrees, ws->segment_hints, ws->linear_inputs, 0, 0) / denominator;
+}
+
+/**
+ * @brief Tensor contraction from the degrees in ws->degrees (all MFs evaluated).
+ */
+static float FIS_Plan_ContractDegrees(const FIS_Plan* plan, const float* inputs, FIS_PlanWorkspace* ws)
+{
+    const FIS_PlanInput* plan_inputs = FIS_PLAN_INPUTS(plan);
+    const int32_t* columns = FIS_PLAN_COLUMNS(plan);
+
+    // Degree sums in MF order, as FIS_Plan_FuzzifyInput() (zero degrees add nothing)
+    float denominator = 1.0f;
+    for (int i = 0; i < plan->num_inputs; ++i)
+    {
+        const float* degree = &ws->degrees[plan_inputs[i].first_mf];
+        float sum = 0.0f;
+        for (int m = 0; m < plan_inputs[i].num_mfs; ++m)
+            sum += degree[m];
+        if (plan_inputs[i].num_mfs > 0)
+            denominator *= sum;
+        ws->segment_hints[i] = -1;
+    }
+
+    if (denominator == 0.0f)
+        return 0.0f;
+
+    for (int c = 0; c < plan->num_columns; ++c)
+        ws->linear_inputs[c] = (columns[c] < plan->num_inputs) ? inputs[columns[c]] : 1.0f;
+
+    return FIS_Plan_TensorContract(plan, ws->degrees, ws->segment_hints, ws->linear_inputs, 0, 0) / denominator;
+}
+
+/* Public functions ----------------------------------------------------------*/
+size_t FIS_Plan_Size(const FIS_System* fis)
+{
+    FIS_Plan header;
+
+    if (!FIS_Plan_Layout(fis, &header))
+        return 0;
+
+    // Plan, then the consequent hash table (scratch space, released by FIS_Compile())
+    return header.size + FIS_PLAN_ALIGN - 1
+         + sizeof(int32_t) * FIS_Plan_HashSize(fis->num_rules) + FIS_ARENA_ALIGN - 1;
+}
+
+const FIS_Plan* FIS_Compile(const FIS_System* fis, FIS_Arena* arena)
+{
+    FIS_Plan header;
+
+    if (!FIS_Plan_Layout(fis, &header))
+        return NULL;
+
+    const size_t start = arena->used;
+    FIS_Plan* plan = FIS_Arena_Alloc(arena, header.size, FIS_PLAN_ALIGN);
+    if (plan == NULL)
+        return NULL;
+
+    // Scratch hash table of distinct consequents after the plan, released before
+    // returning (counted in FIS_Plan_Size(); tensor plans keep a matrix row per
+    // grid cell and need none)
+    const size_t mark = arena->used;
+    const size_t table_size = FIS_Plan_HashSize(fis->num_rules);
+    int32_t* table = NULL;
+    if (!(header.flags & FIS_PLAN_FLAG_TENSOR))
+    {
+        table = FIS_Arena_Alloc(arena, sizeof(int32_t) * table_size, FIS_ARENA_ALIGN);
+        if (table == NULL)
+        {
+            arena->used = start;
+            return NULL;
+        }
+    }
+
+    memset(plan, 0, header.size);
+    *plan = header;
+
+    FIS_PlanInput* inputs = __FIS_PLAN_TABLE_RW(plan, FIS_PlanInput, inputs_offset);
+    FIS_PlanMF* mfs = __FIS_PLAN_TABLE_RW(plan, FIS_PlanMF, mfs_offset);
+    FIS_PlanRule* rules = __FIS_PLAN_TABLE_RW(plan, FIS_PlanRule, rules_offset);
+    int32_t* terms = __FIS_PLAN_TABLE_RW(plan, int32_t, terms_offset);
+    FIS_PlanCustomMF* custom_mfs = __FIS_PLAN_TABLE_RW(plan, FIS_PlanCustomMF, custom_mfs_offset);
+    FIS_ConsequentFunction* consequents = __FIS_PLAN_TABLE_RW(plan, FIS_ConsequentFunction, consequents_offset);
+
+    // Packed membership functions, input by input
+    int k = 0, num_custom = 0;
+    for (int i = 0; i < fis->num_inputs; ++i)
+    {
+        inputs[i].first_mf = k;
+        inputs[i].num_mfs = fis->num_mfs_per_input[i];
+
+        for (int m = 0; m < fis->num_mfs_per_input[i]; ++m, ++k)
+        {
+            const FIS_MembershipFunction* mf = fis->input_mfs[i][m];
+            mfs[k].type = FIS_Plan_MFType(mf);
+            mfs[k].alias = m;
+
+            switch (mfs[k].type)
+            {
+                case FIS_MF_TYPE_TRIANGULAR:
+                    mfs[k].params.tri = *(const FIS_MF_TriangularParams*)mf->params;
+                    break;
+                case FIS_MF_TYPE_TRAPEZOIDAL:
+                    mfs[k].params.trap = *(const FIS_MF_TrapezoidalParams*)mf->params;
+                    break;
+                case FIS_MF_TYPE_CUSTOM:
+                    custom_mfs[num_custom].eval = mf->eval;
+                    custom_mfs[num_custom].params = mf->params;
+                    mfs[k].custom = num_custom++;
+                    break;
+                default:
+                    break;
+            }
+
+            // Identical MFs of the input share the degree of the first one
+            for (int a = 0; a < m; ++a)
+            {
+                if (mfs[inputs[i].first_mf + a].alias == a && FIS_Plan_SameMF(plan, &mfs[inputs[i].first_mf + a], &mfs[k]))
+                {
+                    mfs[k].alias = a;
+                    break;
+                }
+            }
+        }
+    }
+
+    // Segment search: sorted support ends, MF lists of the segments (CSR, counted,
+    // then filled in MF order)
+    float* breakpoints = __FIS_PLAN_TABLE_RW(plan, float, breakpoints_offset);
+    int32_t* segments = __FIS_PLAN_TABLE_RW(plan, int32_t, segments_offset);
+    int32_t* segment_mfs = __FIS_PLAN_TABLE_RW(plan, int32_t, segment_mfs_offset);
+    int num_points = 0, num_segments = 0, num_segment_mfs = 0;
+    for (int i = 0; i < fis->num_inputs; ++i)
+    {
+        const int num_mfs = fis->num_mfs_per_input[i];
+        inputs[i].first_breakpoint = num_points;
+        inputs[i].first_segment = num_segments;
+        if (FIS_Plan_SegmentMFCount(fis, i) == 0)
+            continue;
+
+        float* points = &breakpoints[num_points];
+        int32_t* segment = &segments[num_segments];
+        const int count = 2 * num_mfs;
+        float lo, hi;
+
+        for (int m = 0; m < num_mfs; ++m)
+            FIS_Plan_MFSupport(fis->input_mfs[i][m], &points[2 * m], &points[2 * m + 1]);
+        qsort(points, count, sizeof(float), FIS_Plan_CompareFloat);
+
+        for (int s = 0; s <= 2 * count + 1; ++s)
+            segment[s] = 0;
+        for (int m = 0; m < num_mfs; ++m)
+        {
+            FIS_Plan_MFSupport(fis->input_mfs[i][m], &lo, &hi);
+            const int last = 2 * FIS_Plan_LowerBound(points, count, hi) + 1;
+            for (int s = 2 * FIS_Plan_LowerBound(points, count, lo) + 1; s <= last; ++s)
+                ++segment[s + 1];
+        }
+
+        segment[0] = num_segment_mfs;
+        for (int s = 1; s <= 2 * count + 1; ++s)
+            segment[s] += segment[s - 1];
+
+        for (int m = 0; m < num_mfs; ++m)
+        {
+            FIS_Plan_MFSupport(fis->input_mfs[i][m], &lo, &hi);
+            const int last = 2 * FIS_Plan_LowerBound(points, count, hi) + 1;
+            for (int s = 2 * FIS_Plan_LowerBound(points, count, lo) + 1; s <= last; ++s)
+                segment_mfs[segment[s]++] = m;
+        }
+
+        for (int s = 2 * count; s > 0; --s)
+            segment[s] = segment[s - 1];
+        segment[0] = num_segment_mfs;
+
+        inputs[i].num_breakpoints = count;
+        num_points += count;
+        num_segments += 2 * count + 1;
+        num_segment_mfs = segment[2 * count + 1];
+    }
+    segments[num_segments] = num_segment_mfs;
+
+    if (plan->flags & FIS_PLAN_FLAG_PARTITION)
+        FIS_Plan_PartitionKnots(fis, plan->scheduling_input, __FIS_PLAN_TABLE_RW(plan, float, knots_offset),
+                                __FIS_PLAN_TABLE_RW(plan, FIS_PlanPartitionSegment, partition_offset));
+
+    // Linear consequents: column-major coefficient matrix
+    int32_t* columns = __FIS_PLAN_TABLE_RW(plan, int32_t, columns_offset);
+    float* matrix = __FIS_PLAN_TABLE_RW(plan, float, matrix_offset);
+    for (int c = 0, column = 0; c <= fis->num_inputs; ++c)
+        if (FIS_Plan_ColumnUsed(fis, c))
+            columns[column++] = c;
+
+    // Distinct consequents: rule r temporarily holds the first rule with the same
+    // consequent, found through the scratch hash table
+    int num_linear = 0, num_functions = 0;
+
+    if (table != NULL)
+        memset(table, 0xFF, sizeof(int32_t) * table_size);
+
+    for (int r = 0; r < fis->num_rules; ++r)
+    {
+        const FIS_Rule* rule = &fis->rules[r];
+        rules[r].consequent = r;
+
+        if (table != NULL)
+        {
+            size_t slot = FIS_Plan_ConsequentHash(fis, rule) & (table_size - 1);
+            while (table[slot] >= 0 && !FIS_Plan_SameConsequent(fis, &fis->rules[table[slot]], rule))
+                slot = (slot + 1) & (table_size - 1);
+
+            if (table[slot] >= 0)
+                rules[r].consequent = table[slot];
+            else
+                table[slot] = r;
+        }
+
+        if (rules[r].consequent == r)
+        {
+            num_linear += (rule->coefficients != NULL);
+            num_functions += (rule->coefficients == NULL);
+        }
+    }
+    arena->used = mark;
+
+    plan->num_linear = num_linear;
+    plan->num_consequents = num_linear + num_functions;
+    plan->linear_stride = (num_linear + FIS_SIMD_MAX_LANES - 1) / FIS_SIMD_MAX_LANES * FIS_SIMD_MAX_LANES;
+
+    // Rules: active antecedents only, addressed by the degree slot of the first
+    // identical MF
+    int t = 0;
+    num_linear = 0;
+    num_functions = 0;
+    for (int r = 0; r < fis->num_rules; ++r)
+    {
+        const FIS_Rule* rule = &fis->rules[r];
+        rules[r].first_term = t;
+        rules[r].logic_type = rule->logic_type;
+
+        if (rules[r].consequent < r)
+            rules[r].consequent = rules[rules[r].consequent].consequent;
+        else if (rule->coefficients != NULL)
+        {
+            for (int c = 0; c < plan->num_columns; ++c)
+                matrix[c * plan->linear_stride + num_linear] = rule->coefficients[columns[c]];
+            rules[r].consequent = num_linear++;
+        }
+        else
+        {
+            consequents[num_functions] = rule->consequent;
+            rules[r].consequent = plan->num_linear + num_functions++;
+        }
+
+        for (int i = 0; i < fis->num_inputs; ++i)
+            if (rule->mf_indices[i] >= 0)
+                terms[t++] = inputs[i].first_mf + mfs[inputs[i].first_mf + rule->mf_indices[i]].alias;
+
+        rules[r].num_terms = t - rules[r].first_term;
+    }
+
+    return plan;
+}
+
+size_t FIS_Plan_WorkspaceSize(const FIS_Plan* plan)
+{
+    return sizeof(FIS_PlanWorkspace)
+         + sizeof(float) * plan->num_degrees
+         + sizeof(FIS_RuleOutput) * plan->num_rules
+         + sizeof(float) * plan->num_columns
+         + sizeof(float) * plan->linear_stride
+         + sizeof(int) * plan->num_inputs
+         + sizeof(float) * plan->num_consequents
+         + 5 * (FIS_ARENA_ALIGN - 1) + 2 * (FIS_PLAN_ALIGN - 1);
+}
+
+FIS_PlanWorkspace* FIS_Plan_CreateWorkspace(const FIS_Plan* plan, FIS_Arena* arena)
+{
+    FIS_PlanWorkspace* ws = FIS_Arena_Alloc(arena, sizeof(FIS_PlanWorkspace), FIS_ARENA_ALIGN);
+    float* degrees = FIS_Arena_Alloc(arena, sizeof(float) * plan->num_degrees, FIS_ARENA_ALIGN);
+    FIS_RuleOutput* rule_output = FIS_Arena_Alloc(arena, sizeof(FIS_RuleOutput) * plan->num_rules, FIS_ARENA_ALIGN);
+    float* linear_inputs = FIS_Arena_Alloc(arena, sizeof(float) * plan->num_columns, FIS_PLAN_ALIGN);
+    float* linear_outputs = FIS_Arena_Alloc(arena, sizeof(float) * plan->linear_stride, FIS_PLAN_ALIGN);
+    int* segment_hints = FIS_Arena_Alloc(arena, sizeof(int) * plan->num_inputs, FIS_ARENA_ALIGN);
+    float* consequent_weights = FIS_Arena_Alloc(arena, sizeof(float) * plan->num_consequents, FIS_ARENA_ALIGN);
+
+    if (ws == NULL || degrees == NULL || rule_output == NULL ||
+        linear_inputs == NULL || linear_outputs == NULL || segment_hints == NULL || consequent_weights == NULL)
+        return NULL;
+
+    for (int i = 0; i < plan->num_inputs; ++i)
+        segment_hints[i] = -1;
+
+    ws->num_inputs = plan->num_inputs;
+    ws->num_rules = plan->num_rules;
+    ws->degrees = degrees;
+    ws->rule_output = rule_output;
+    ws->linear_inputs = linear_inputs;
+    ws->linear_outputs = linear_outputs;
+    ws->segment_hints = segment_hints;
+    ws->consequent_weights = consequent_weights;
+    return ws;
+}
+
+/**
+ * @brief Rule by rule from the degrees in ws->degrees: weights summed per distinct
+ *        consequent, consequents with a non-zero weight, weighted average.
+ */
+static float FIS_Plan_AverageDegrees(const FIS_Plan* plan, const float* inputs, FIS_PlanWorkspace* ws)
+{
+    const FIS_PlanRule* rules = FIS_PLAN_RULES(plan);
+    FIS_RuleOutput* rule_output = ws->rule_output;
+    float* weights = ws->consequent_weights;
+
+    for (int c = 0; c < plan->num_consequents; ++c)
+        weights[c] = 0.0f;
+
+    float denominator = 0.0f;
+    for (int r = 0; r < plan->num_rules; ++r)
+    {
+        const float weight = FIS_Plan_RuleWeight(plan, &rules[r], ws->degrees);
+        rule_output[r].weight = weight;
+        rule_output[r].output = 0.0f;
+        weights[rules[r].consequent] += weight;
+        denominator += weight;
+    }
+
+    // Linear consequents are needed if any linear rule fires
+    int linear_firing = 0;
+    for (int l = 0; l < plan->num_linear; ++l)
+        linear_firing |= (weights[l] != 0.0f);
+
+    if (linear_firing)
+        FIS_Plan_LinearConsequents(plan, inputs, ws->linear_inputs, ws->linear_outputs);
+
+    // Weighted average defuzzification; each distinct consequent is evaluated once,
+    // consequents of non-firing rules are skipped
+    const FIS_ConsequentFunction* consequents = FIS_PLAN_CONSEQUENTS(plan);
+    float numerator = 0.0f;
+
+    for (int l = 0; l < plan->num_linear; ++l)
+    {
+        if (weights[l] != 0.0f)
+            numerator += weights[l] * ws->linear_outputs[l];
+    }
+    for (int c = plan->num_linear; c < plan->num_consequents; ++c)
+    {
+        if (weights[c] != 0.0f)
+            numerator += weights[c] * consequents[c - plan->num_linear](inputs);
+    }
+
+    if (denominator == 0.0f)
+        return 0.0f;
+
+    return numerator / denominator;
+}
+
+/**
+ * @brief Evaluation rule by rule: linear consequents computed together as one
+ *        matrix-vector product (fused multiply-adds, removed zero terms).
+ */
+static float FIS_Plan_EvaluateRules(const FIS_Plan* plan, const float* inputs, FIS_PlanWorkspace* ws)
+{
+    FIS_Plan_Fuzzify(plan, inputs, ws->degrees, ws->segment_hints);
+    return FIS_Plan_AverageDegrees(plan, inputs, ws);
+}
+
+size_t FIS_Plan_BatchWorkspaceSize(const FIS_Plan* plan)
+{
+    return sizeof(FIS_PlanBatchWorkspace)
+         + sizeof(float) * FIS_BATCH_BLOCK * (plan->num_degrees + plan->num_rules + plan->num_linear + plan->num_consequents + 2)
+         + sizeof(float) * plan->num_inputs
+         + plan->num_linear
+         + 8 * (FIS_PLAN_ALIGN - 1);
+}
+
+FIS_PlanBatchWorkspace* FIS_Plan_CreateBatchWorkspace(const FIS_Plan* plan, FIS_Arena* arena)
+{
+    FIS_PlanBatchWorkspace* ws = FIS_Arena_Alloc(arena, sizeof(FIS_PlanBatchWorkspace), FIS_PLAN_ALIGN);
+    if (ws == NULL)
+        return NULL;
+
+    ws->degrees = FIS_Arena_Alloc(arena, sizeof(float) * FIS_BATCH_BLOCK * plan->num_degrees, FIS_PLAN_ALIGN);
+    ws->weights = FIS_Arena_Alloc(arena, sizeof(float) * FIS_BATCH_BLOCK * plan->num_rules, FIS_PLAN_ALIGN);
+    ws->linear_outputs = FIS_Arena_Alloc(arena, sizeof(float) * FIS_BATCH_BLOCK * plan->num_linear, FIS_PLAN_ALIGN);
+    ws->consequent_weights = FIS_Arena_Alloc(arena, sizeof(float) * FIS_BATCH_BLOCK * plan->num_consequents, FIS_PLAN_ALIGN);
+    ws->numerator = FIS_Arena_Alloc(arena, sizeof(float) * FIS_BATCH_BLOCK, FIS_PLAN_ALIGN);
+    ws->denominator = FIS_Arena_Alloc(arena, sizeof(float) * FIS_BATCH_BLOCK, FIS_PLAN_ALIGN);
+    ws->row = FIS_Arena_Alloc(arena, sizeof(float) * plan->num_inputs, FIS_PLAN_ALIGN);
+    ws->linear_needed = FIS_Arena_Alloc(arena, plan->num_linear, FIS_PLAN_ALIGN);
+
+    if (ws->degrees == NULL || ws->weights == NULL || ws->linear_outputs == NULL || ws->consequent_weights == NULL ||
+        ws->numerator == NULL || ws->denominator == NULL || ws->row == NULL || ws->linear_needed == NULL)
+        return NULL;
+
+    return ws;
+}
+
+void FIS_Plan_EvaluateBatch(const FIS_Plan* plan, const float* const* inputs, float* outputs, int count, FIS_PlanBatchWorkspace* ws)
+{
+    const FIS_PlanInput* plan_inputs = FIS_PLAN_INPUTS(plan);
+    const FIS_PlanMF* mfs = FIS_PLAN_MFS(plan);
+    const FIS_PlanRule* rules = FIS_PLAN_RULES(plan);
+    const int32_t* terms = FIS_PLAN_TERMS(plan);
+    const int32_t* columns = FIS_PLAN_COLUMNS(plan);
+    const float* matrix = FIS_PLAN_MATRIX(plan);
+    const FIS_ConsequentFunction* consequents = FIS_PLAN_CONSEQUENTS(plan);
+
+    for (int start = 0; start < count; start += FIS_BATCH_BLOCK)
+    {
+        int n = count - start;
+        if (n > FIS_BATCH_BLOCK)
+            n = FIS_BATCH_BLOCK;
+
+        // Fuzzification step: vectorized MF kernels over the block
+        for (int i = 0; i < plan->num_inputs; ++i)
+        {
+            const float* x = inputs[i] + start;
+            const int first = plan_inputs[i].first_mf;
+            for (int k = first; k < first + plan_inputs[i].num_mfs; ++k)
+            {
+                float* degree = &ws->degrees[k * FIS_BATCH_BLOCK];
+                if (mfs[k].alias != k - first)
+                {
+                    memcpy(degree, &ws->degrees[(first + mfs[k].alias) * FIS_BATCH_BLOCK], sizeof(float) * n);
+                    continue;
+                }
+
+                switch (mfs[k].type)
+                {
+                    case FIS_MF_TYPE_TRIANGULAR:
+                        FIS_MF_TriangularEvalArray(&mfs[k].params.tri, x, degree, n);
+                        break;
+                    case FIS_MF_TYPE_TRAPEZOIDAL:
+                        FIS_MF_TrapezoidalEvalArray(&mfs[k].params.trap, x, degree, n);
+                        break;
+                    default:
+                        for (int s = 0; s < n; ++s)
+                            degree[s] = FIS_Plan_EvaluateMF(plan, &mfs[k], x[s]);
+                        break;
+                }
+            }
+        }
+
+        // Rule weights over the block; mark linear rows used by firing rules
+        for (int l = 0; l < plan->num_linear; ++l)
+            ws->linear_needed[l] = 0;
+
+        for (int r = 0; r < plan->num_rules; ++r)
+        {
+            const FIS_PlanRule* rule = &rules[r];
+            const FIS_LogicType logic_type = (FIS_LogicType)rule->logic_type;
+            float* weight = &ws->weights[r * FIS_BATCH_BLOCK];
+            const float w0 = FIS_InitialWeight(logic_type);
+            int firing = 0;
+
+            for (int s = 0; s < n; ++s)
+                weight[s] = w0;
+
+            for (int t = 0; t < rule->num_terms; ++t)
+            {
+                const float* degree = &ws->degrees[terms[rule->first_term + t] * FIS_BATCH_BLOCK];
+                for (int s = 0; s < n; ++s)
+                    weight[s] = FIS_CombineDegree(logic_type, weight[s], degree[s]);
+            }
+
+            for (int s = 0; s < n; ++s)
+                firing |= (weight[s] != 0.0f);
+
+            if (firing && rule->consequent < plan->num_linear)
+                ws->linear_needed[rule->consequent] = 1;
+        }
+
+        // Linear consequents of the block: matrix-matrix product, one row of
+        // coefficients times the input columns
+        for (int l = 0; l < plan->num_linear; ++l)
+        {
+            if (!ws->linear_needed[l])
+                continue;
+
+            float* y = &ws->linear_outputs[l * FIS_BATCH_BLOCK];
+            for (int s = 0; s < n; ++s)
+                y[s] = 0.0f;
+
+            for (int c = 0; c < plan->num_columns; ++c)
+            {
+                const float coefficient = matrix[c * plan->linear_stride + l];
+                if (columns[c] < plan->num_inputs)
+                    FIS_SIMD_Axpy(coefficient, inputs[columns[c]] + start, y, n);
+                else
+                    for (int s = 0; s < n; ++s)
+                        y[s] += coefficient;
+            }
+        }
+
+        // Weighted average defuzzification: weights summed per distinct consequent (as
+        // in FIS_Plan_AverageDegrees()), each consequent evaluated once per sample
+        for (int s = 0; s < n; ++s)
+        {
+            ws->numerator[s] = 0.0f;
+            ws->denominator[s] = 0.0f;
+        }
+        for (int k = 0; k < plan->num_consequents * FIS_BATCH_BLOCK; ++k)
+            ws->consequent_weights[k] = 0.0f;
+
+        for (int r = 0; r < plan->num_rules; ++r)
+        {
+            const float* weight = &ws->weights[r * FIS_BATCH_BLOCK];
+            float* consequent_weight = &ws->consequent_weights[rules[r].consequent * FIS_BATCH_BLOCK];
+            for (int s = 0; s < n; ++s)
+            {
+                consequent_weight[s] += weight[s];
+                ws->denominator[s] += weight[s];
+            }
+        }
+
+        for (int l = 0; l < plan->num_linear; ++l)
+        {
+            if (!ws->linear_needed[l])
+                continue;
+
+            const float* weight = &ws->consequent_weights[l * FIS_BATCH_BLOCK];
+            const float* y = &ws->linear_outputs[l * FIS_BATCH_BLOCK];
+            for (int s = 0; s < n; ++s)
+                ws->numerator[s] += (weight[s] == 0.0f) ? 0.0f : weight[s] * y[s];
+        }
+
+        for (int c = plan->num_linear; c < plan->num_consequents; ++c)
+        {
+            const float* weight = &ws->consequent_weights[c * FIS_BATCH_BLOCK];
+            for (int s = 0; s < n; ++s)
+            {
+                if (weight[s] == 0.0f)
+                    continue;
+
+                for (int i = 0; i < plan->num_inputs; ++i)
+                    ws->row[i] = inputs[i][start + s];
+
+                ws->numerator[s] += weight[s] * consequents[c - plan->num_linear](ws->row);
+            }
+        }
+
+        for (int s = 0; s < n; ++s)
+            outputs[start + s] = (ws->denominator[s] == 0.0f) ? 0.0f : ws->numerator[s] / ws->denominator[s];
+    }
+}
+
+int FIS_Plan_EvaluatePartition(const FIS_Plan* plan, const float* inputs, float* output)
+{
+    const float* knots = FIS_PLAN_KNOTS(plan);
+    const float x = inputs[plan->scheduling_input];
+
+    if (!(x > knots[0] && x < knots[plan->num_knots - 1]))
+        return 0;
+
+    // knots[j - 1] < x <= knots[j], 1 <= j < num_knots
+    const int j = FIS_Plan_LowerBound(knots, plan->num_knots, x);
+    if (knots[j] == x)
+        return 0;
+
+    const FIS_PlanPartitionSegment* segment = &FIS_PLAN_PARTITION(plan)[j - 1];
+    const float lower = FIS_Plan_ConsequentOutput(plan, segment->lower_rule, inputs);
+    if (segment->slope == 0.0f)
+    {
+        *output = lower;
+        return 1;
+    }
+
+    const float t = (x - knots[j - 1]) * segment->slope;
+    *output = lower + t * (FIS_Plan_ConsequentOutput(plan, segment->upper_rule, inputs) - lower);
+    return 1;
+}
+
+float FIS_Plan_Evaluate(const FIS_Plan* plan, const float* inputs, FIS_PlanWorkspace* ws)
+{
+    float output;
+    if ((plan->flags & FIS_PLAN_FLAG_PARTITION) && FIS_Plan_EvaluatePartition(plan, inputs, &output))
+        return output;
+
+    if (plan->flags & FIS_PLAN_FLAG_TENSOR)
+        return FIS_Plan_EvaluateTensor(plan, inputs, ws);
+
+    if (plan->flags & FIS_PLAN_FLAG_GAIN_BLENDING)
+        return FIS_Plan_EvaluateBlended(plan, inputs, ws);
+
+    return FIS_Plan_EvaluateRules(plan, inputs, ws);
+}
+
+float FIS_Plan_EvaluateFuzzified(const FIS_Plan* plan, const float* inputs, FIS_PlanWorkspace* ws)
+{
+    if (plan->flags & FIS_PLAN_FLAG_TENSOR)
+        return FIS_Plan_ContractDegrees(plan, inputs, ws);
+
+    if (plan->flags & FIS_PLAN_FLAG_GAIN_BLENDING)
+        return FIS_Plan_BlendDegrees(plan, inputs, ws);
+
+    return FIS_Plan_AverageDegrees(plan, inputs, ws);
+}
+
+void FIS_Plan_RuleWeights(const FIS_Plan* plan, const float* inputs, FIS_PlanWorkspace* ws)
+{
+    const FIS_PlanRule* rules = FIS_PLAN_RULES(plan);
+
+    FIS_Plan_Fuzzify(plan, inputs, ws->degrees, ws->segment_hints);
+    for (int r = 0; r < plan->num_rules; ++r)
+        ws->rule_output[r].weight = FIS_Plan_RuleWeight(plan, &rules[r], ws->degrees);
+}
+
+float FIS_Plan_MembershipDegree(const FIS_Plan* plan, int slot, float x)
+{
+    return FIS_Plan_EvaluateMF(plan, &FIS_PLAN_MFS(plan)[slot], x);
+}
+
+void FIS_Plan_FuzzifySingle(const FIS_Plan* plan, int input, float x, FIS_PlanWorkspace* ws)
+{
+    FIS_Plan_FuzzifyInput(plan, &FIS_PLAN_INPUTS(plan)[input], x, ws->degrees, &ws->segment_hints[input]);
+}
+
+float FIS_Plan_RuleFiring(const FIS_Plan* plan, int rule, const float* degrees)
+{
+    return FIS_Plan_RuleWeight(plan, &FIS_PLAN_RULES(plan)[rule], degrees);
+}
+
+float FIS_Plan_Consequent(const FIS_Plan* plan, int consequent, const float* inputs)
+{
+    return FIS_Plan_ConsequentValue(plan, consequent, inputs);
+}
+
+void FIS_Plan_GetSharing(const FIS_Plan* plan, FIS_PlanSharing* sharing)
+{
+    const FIS_PlanInput* inputs = FIS_PLAN_INPUTS(plan);
+    const FIS_PlanMF* mfs = FIS_PLAN_MFS(plan);
+
+    sharing->num_rule_consequents = plan->num_rules;
+    sharing->num_consequents = plan->num_consequents;
+    sharing->num_mfs = plan->num_degrees;
+    sharing->num_distinct_mfs = 0;
+    for (int i = 0; i < plan->num_inputs; ++i)
+        for (int m = 0; m < inputs[i].num_mfs; ++m)
+            sharing->num_distinct_mfs += (mfs[inputs[i].first_mf + m].alias == m);
+}
+
+float FIS_Plan_RuleConsequent(const FIS_Plan* plan, int rule, const float* inputs)
+{
+    return FIS_Plan_ConsequentOutput(plan, rule, inputs);
+}
+
+float FIS_Plan_BlendedOutput(const FIS_Plan* plan, const float* inputs, const float* normalized_weights)
+{
+    const int32_t* columns = FIS_PLAN_COLUMNS(plan);
+    const float* matrix = FIS_PLAN_MATRIX(plan);
+    float output = 0.0f;
+
+    for (int c = 0; c < plan->num_columns; ++c)
+    {
+        const float* column = &matrix[c * plan->linear_stride];
+        float gain = 0.0f;
+
+        for (int l = 0; l < plan->num_linear; ++l)
+            gain += normalized_weights[l] * column[l];
+
+        output += gain * ((columns[c] < plan->num_inputs) ? inputs[columns[c]] : 1.0f);
+    }
+    return output;
+}
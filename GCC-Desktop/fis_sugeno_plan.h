@@ -0,0 +1,430 @@
+/**
+  ******************************************************************************
+  * @file		: fis_sugeno_plan.h
+  * @author  	: AW		Adrian.Wojcik@put.poznan.pl
+  * @version 	: 1.0.0
+  * @date    	: Oct 17, 2026
+  * @brief   	: Takagi-Sugeno-Kang (Sugeno) Fuzzy Inference System for
+  *               embedded control systems
+  *               Compiled execution plan: FIS_System flattened into a single
+  *               immutable, cache-line-aligned memory block
+  *
+  ******************************************************************************
+  */
+
+#ifndef INC_FIS_SUGENO_PLAN_H_
+#define INC_FIS_SUGENO_PLAN_H_
+
+/* Public includes -----------------------------------------------------------*/
+#include <stdint.h>
+#include "fis_sugeno.h"
+#include "fis_sugeno_simd.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Public typedef ------------------------------------------------------------*/
+/**
+ * @brief Membership function shape tag (replaces the FIS_MF_Eval pointer).
+ */
+typedef enum
+{
+    FIS_MF_TYPE_NONE,           // NULL membership function: degree -1.0f
+    FIS_MF_TYPE_TRIANGULAR,
+    FIS_MF_TYPE_TRAPEZOIDAL,
+    FIS_MF_TYPE_CUSTOM          // user FIS_MF_Eval, called through the plan function table
+} FIS_MF_Type;
+
+/**
+ * @brief Packed membership function (32 bytes, two per cache line).
+ */
+typedef struct
+{
+    int32_t type;               // FIS_MF_Type
+    union
+    {
+        FIS_MF_TriangularParams tri;
+        FIS_MF_TrapezoidalParams trap;
+    } params;
+    int32_t custom;             // index into custom MF table (FIS_MF_TYPE_CUSTOM)
+    int32_t alias;              // index (within the input) of the first identical MF, itself if none
+    int32_t reserved;
+} FIS_PlanMF;
+
+/**
+ * @brief Input of a plan. Inputs with breakpoints are fuzzified by segment search:
+ *        the sorted support ends split the axis into 2 * num_breakpoints + 1 segments
+ *        (below, at and between breakpoints) and only the MFs listed for the segment
+ *        of the input value are evaluated; all other degrees are exactly zero.
+ */
+typedef struct
+{
+    int32_t first_mf;           // index of the first MF (and degree slot) of the input
+    int32_t num_mfs;
+    int32_t first_breakpoint;   // index of the first support end of the input
+    int32_t num_breakpoints;    // 0: all MFs evaluated
+    int32_t first_segment;      // index of the first segment of the input
+} FIS_PlanInput;
+
+typedef struct
+{
+    int32_t first_term;         // index of the first antecedent term
+    int32_t num_terms;          // number of antecedents (-1 entries removed)
+    int32_t logic_type;         // FIS_LogicType
+    int32_t consequent;         // consequent index: linear matrix row or num_linear + function index
+                                // (shared by rules with identical consequents)
+} FIS_PlanRule;
+
+typedef struct
+{
+    FIS_MF_Eval eval;
+    void* params;
+} FIS_PlanCustomMF;
+
+/**
+ * @brief Interval between two knots of a partition-of-unity scheduling input: the
+ *        plateau of one MF (its rule fires with weight 1) or the edge shared by two
+ *        adjacent MFs (weights 1 - t and t).
+ */
+typedef struct
+{
+    float slope;                // 1 / edge width; 0 on a plateau
+    int32_t lower_rule;         // rule of the falling MF (plateau: of the MF)
+    int32_t upper_rule;         // rule of the rising MF (plateau: lower_rule)
+    int32_t reserved;
+} FIS_PlanPartitionSegment;
+
+/**
+ * @brief Compiled plan header. All tables follow the header in the same block and
+ *        are addressed with byte offsets from the header (no internal pointers).
+ *        Each table starts at a FIS_PLAN_ALIGN boundary.
+ */
+typedef struct
+{
+    uint32_t magic;             // FIS_PLAN_MAGIC
+    uint16_t version;           // FIS_PLAN_VERSION
+    uint16_t flags;             // FIS_PLAN_FLAG_x
+    uint32_t size;              // total size of the plan in bytes
+
+    int32_t num_inputs;
+    int32_t num_degrees;        // total number of MFs (degree slots)
+    int32_t num_rules;
+    int32_t num_terms;          // total number of antecedent terms
+    int32_t num_custom_mfs;
+    int32_t num_consequents;    // distinct consequents: linear rows first, then consequent functions
+    int32_t num_linear;         // consequents [0, num_linear) are rows of the linear matrix
+    int32_t linear_stride;      // padded number of matrix rows (multiple of FIS_SIMD_MAX_LANES)
+    int32_t num_columns;        // matrix columns left after removing all-zero columns
+    int32_t scheduling_input;   // the only input used by antecedents, -1 if several (or none)
+
+    uint32_t inputs_offset;     // FIS_PlanInput[num_inputs]
+    uint32_t mfs_offset;        // FIS_PlanMF[num_degrees]
+    uint32_t rules_offset;      // FIS_PlanRule[num_rules]
+    uint32_t terms_offset;      // int32_t[num_terms]: degree slot of each antecedent
+    uint32_t custom_mfs_offset; // FIS_PlanCustomMF[num_custom_mfs]
+    uint32_t columns_offset;    // int32_t[num_columns]: input of each column (num_inputs: constant p0)
+    uint32_t matrix_offset;     // float[num_columns][linear_stride]: column-major coefficient matrix
+    uint32_t consequents_offset;// FIS_ConsequentFunction[num_consequents - num_linear]
+
+    int32_t num_breakpoints;    // support ends of all segment-searched inputs
+    int32_t num_segments;
+    int32_t num_segment_mfs;    // total length of the segment MF lists
+    uint32_t breakpoints_offset;// float[num_breakpoints]: sorted support ends, input by input
+    uint32_t segments_offset;   // int32_t[num_segments + 1]: first entry of each segment in segment_mfs
+    uint32_t segment_mfs_offset;// int32_t[num_segment_mfs]: MFs (index within the input) of each segment
+
+    int32_t num_knots;          // FIS_PLAN_FLAG_PARTITION: tops and edge ends of the scheduling input
+    uint32_t knots_offset;      // float[num_knots]: ascending
+    uint32_t partition_offset;  // FIS_PlanPartitionSegment[num_knots - 1]: interval after each knot
+} FIS_Plan;
+
+/**
+ * @brief Work removed by the compiler: consequents and MFs of an input that are
+ *        identical are evaluated once per sample (FIS_Plan_GetSharing()).
+ */
+typedef struct
+{
+    int32_t num_rule_consequents;   // consequents as written in the rules
+    int32_t num_consequents;        // distinct consequents evaluated
+    int32_t num_mfs;                // MFs of all inputs
+    int32_t num_distinct_mfs;       // distinct MFs evaluated (the others copy a degree)
+} FIS_PlanSharing;
+
+/**
+ * @brief Caller-owned scratch memory for evaluating a compiled plan, sized from the plan.
+ *        Each thread evaluating a plan concurrently needs its own workspace.
+ */
+typedef struct
+{
+    int num_inputs;
+    int num_rules;
+    float* degrees;                 // [num_degrees]: degree of every MF slot (FIS_PlanInput::first_mf + m)
+    FIS_RuleOutput* rule_output;    // weight of every rule (last rule-by-rule evaluation)
+    float* linear_inputs;           // [num_columns]: inputs of the linear consequent matrix
+    float* linear_outputs;          // [linear_stride]: outputs of all linear consequents
+    int* segment_hints;             // [num_inputs]: segment of each input in the last evaluation (-1: all MFs evaluated)
+    float* consequent_weights;      // [num_consequents]: summed weight of each distinct consequent
+} FIS_PlanWorkspace;
+
+/**
+ * @brief Scratch memory for FIS_Plan_EvaluateBatch() (one block of FIS_BATCH_BLOCK samples).
+ */
+typedef struct
+{
+    float* degrees;             // [num_degrees][FIS_BATCH_BLOCK]
+    float* weights;             // [num_rules][FIS_BATCH_BLOCK]
+    float* linear_outputs;      // [num_linear][FIS_BATCH_BLOCK]
+    float* consequent_weights;  // [num_consequents][FIS_BATCH_BLOCK]: rule weights summed per distinct consequent
+    float* numerator;           // [FIS_BATCH_BLOCK]
+    float* denominator;         // [FIS_BATCH_BLOCK]
+    float* row;                 // [num_inputs]: sample gathered for consequent functions
+    unsigned char* linear_needed; // [num_linear]: linear row used by a firing rule
+} FIS_PlanBatchWorkspace;
+
+/* Public define -------------------------------------------------------------*/
+#define FIS_PLAN_MAGIC      0x4E4C5046u     // "FPLN"
+#define FIS_PLAN_VERSION    4
+#define FIS_PLAN_ALIGN      64              // Cache line size
+
+// All consequents linear, antecedents on one scheduling input: y = (sum of normalized
+// w_r * K_r) . x, one dot product; ws->rule_output holds the rule weights only
+#define FIS_PLAN_FLAG_GAIN_BLENDING 0x0001u
+// Complete grid of AND_PRODUCT rules over the inputs with MFs (rule r: MF indices of the
+// mixed-radix digits of r, last input fastest), all consequents linear: y = consequent
+// tensor contracted with the degree vectors / product of the per-input degree sums,
+// zero degrees skipped; ws->rule_output is not written
+#define FIS_PLAN_FLAG_TENSOR        0x0002u
+// MFs of the scheduling input chain into a partition of unity, one single-antecedent
+// rule per MF: strictly between two knots y = y_k + t * (y_k+1 - y_k), t = (x - knot) *
+// precomputed slope (plateau: t = 0), ws not used; knots, values outside them and NaN
+// take the other paths
+#define FIS_PLAN_FLAG_PARTITION     0x0004u
+
+#ifndef FIS_PLAN_SEGMENT_MIN_MFS
+#define FIS_PLAN_SEGMENT_MIN_MFS    8       // Inputs with fewer MFs evaluate all MFs (search costs more)
+#endif
+
+/* Public macro --------------------------------------------------------------*/
+#define __FIS_PLAN_TABLE(plan, type, offset) \
+    ((const type*)((const unsigned char*)(plan) + (plan)->offset))
+
+#define FIS_PLAN_INPUTS(plan)       __FIS_PLAN_TABLE(plan, FIS_PlanInput, inputs_offset)
+#define FIS_PLAN_MFS(plan)          __FIS_PLAN_TABLE(plan, FIS_PlanMF, mfs_offset)
+#define FIS_PLAN_RULES(plan)        __FIS_PLAN_TABLE(plan, FIS_PlanRule, rules_offset)
+#define FIS_PLAN_TERMS(plan)        __FIS_PLAN_TABLE(plan, int32_t, terms_offset)
+#define FIS_PLAN_CUSTOM_MFS(plan)   __FIS_PLAN_TABLE(plan, FIS_PlanCustomMF, custom_mfs_offset)
+#define FIS_PLAN_COLUMNS(plan)      __FIS_PLAN_TABLE(plan, int32_t, columns_offset)
+#define FIS_PLAN_MATRIX(plan)       __FIS_PLAN_TABLE(plan, float, matrix_offset)
+#define FIS_PLAN_CONSEQUENTS(plan)  __FIS_PLAN_TABLE(plan, FIS_ConsequentFunction, consequents_offset)
+#define FIS_PLAN_BREAKPOINTS(plan)  __FIS_PLAN_TABLE(plan, float, breakpoints_offset)
+#define FIS_PLAN_SEGMENTS(plan)     __FIS_PLAN_TABLE(plan, int32_t, segments_offset)
+#define FIS_PLAN_SEGMENT_MFS(plan)  __FIS_PLAN_TABLE(plan, int32_t, segment_mfs_offset)
+#define FIS_PLAN_KNOTS(plan)        __FIS_PLAN_TABLE(plan, float, knots_offset)
+#define FIS_PLAN_PARTITION(plan)    __FIS_PLAN_TABLE(plan, FIS_PlanPartitionSegment, partition_offset)
+
+/* Public function prototypes ------------------------------------------------*/
+/**
+ * @brief Computes the arena space needed by FIS_Compile() for a given FIS.
+ *
+ * @param[in] fis       Pointer to the FIS system definition.
+ * @return              Size in bytes (including alignment padding), or 0 if the FIS
+ *                      cannot be compiled (see FIS_Compile()).
+ */
+size_t FIS_Plan_Size(const FIS_System* fis);
+
+/**
+ * @brief Compiles a FIS into an execution plan: packed MF parameter table with
+ *        shape tags, per-rule lists of active antecedents, a column-major matrix
+ *        of linear consequent coefficients (all-zero columns removed) and a table
+ *        of consequent functions. The plan does not reference the FIS_System afterwards.
+ *        Inputs with at least FIS_PLAN_SEGMENT_MIN_MFS MFs, all triangular or
+ *        trapezoidal, get sorted support ends and per-segment MF lists (MF order,
+ *        and so rule references, is unchanged). A scheduling input whose MFs form
+ *        a partition of unity gets a knot table (FIS_PLAN_FLAG_PARTITION).
+ *        Rules with identical consequents (same coefficients or function) share
+ *        one (not in FIS_PLAN_FLAG_TENSOR plans, which keep a matrix row per rule),
+ *        and identical MFs of an input share one degree (FIS_Plan_GetSharing()).
+ *
+ * @param[in]     fis     Pointer to the FIS system definition.
+ * @param[in,out] arena   Arena with at least FIS_Plan_Size() bytes available.
+ * @return                Pointer to the plan, or NULL if the arena is exhausted,
+ *                        a rule references a non-existent membership function or
+ *                        the plan exceeds UINT32_MAX bytes (32-bit table offsets).
+ */
+const FIS_Plan* FIS_Compile(const FIS_System* fis, FIS_Arena* arena);
+
+/**
+ * @brief Computes the arena space needed by FIS_Plan_CreateWorkspace().
+ *
+ * @param[in] plan      Pointer to the compiled plan.
+ * @return              Size in bytes (including alignment padding).
+ */
+size_t FIS_Plan_WorkspaceSize(const FIS_Plan* plan);
+
+/**
+ * @brief Creates an evaluation workspace for a compiled plan.
+ *
+ * @param[in]     plan    Pointer to the compiled plan.
+ * @param[in,out] arena   Arena with at least FIS_Plan_WorkspaceSize() bytes available.
+ * @return                Pointer to the workspace or NULL if the arena is exhausted.
+ */
+FIS_PlanWorkspace* FIS_Plan_CreateWorkspace(const FIS_Plan* plan, FIS_Arena* arena);
+
+/**
+ * @brief Evaluates a compiled plan; results match FIS_Evaluate() to float rounding.
+ *        FIS_PLAN_FLAG_PARTITION: interpolation between adjacent rules, no division.
+ *        FIS_PLAN_FLAG_TENSOR: contraction of the consequent tensor with the degrees.
+ *        FIS_PLAN_FLAG_GAIN_BLENDING: one dot product with the blended gain vector.
+ *        Otherwise rule by rule, linear consequents as one matrix-vector product.
+ *
+ * @param[in]     plan      Pointer to the compiled plan.
+ * @param[in]     inputs    Array of crisp input values.
+ * @param[in,out] ws        Workspace created with FIS_Plan_CreateWorkspace().
+ * @return                  Final crisp output after inference and defuzzification.
+ */
+float FIS_Plan_Evaluate(const FIS_Plan* plan, const float* inputs, FIS_PlanWorkspace* ws);
+
+/**
+ * @brief Division-free evaluation of a plan with FIS_PLAN_FLAG_PARTITION: the knot
+ *        interval of the scheduling input selects one rule (plateau) or two adjacent
+ *        rules with weights 1 - t and t, y = y_lower + t * (y_upper - y_lower).
+ *
+ * @param[in]  plan      Pointer to the compiled plan (FIS_PLAN_FLAG_PARTITION set).
+ * @param[in]  inputs    Array of crisp input values.
+ * @param[out] output    Crisp output.
+ * @return               1 on success; 0 for a scheduling input outside the knots, on a
+ *                       knot or NaN (*output not written).
+ */
+int FIS_Plan_EvaluatePartition(const FIS_Plan* plan, const float* inputs, float* output);
+
+/**
+ * @brief Evaluates a compiled plan from degrees already in ws->degrees (e.g. shared
+ *        with other plans), with all MFs evaluated: the tensor contraction, gain
+ *        blending or the weighted average, as FIS_Plan_Evaluate(). The division-free
+ *        partition path is not taken (it needs no degrees); other results are
+ *        bit-identical to FIS_Plan_Evaluate().
+ *
+ * @param[in]     plan      Pointer to the compiled plan.
+ * @param[in]     inputs    Array of crisp input values (consequents).
+ * @param[in,out] ws        Workspace created with FIS_Plan_CreateWorkspace(), degrees filled.
+ * @return                  Final crisp output after inference and defuzzification.
+ */
+float FIS_Plan_EvaluateFuzzified(const FIS_Plan* plan, const float* inputs, FIS_PlanWorkspace* ws);
+
+/**
+ * @brief Rule weights of a compiled plan (fuzzification and antecedents only), in
+ *        ws->rule_output[r].weight; independent of the path FIS_Plan_Evaluate() takes.
+ *
+ * @param[in]     plan      Pointer to the compiled plan.
+ * @param[in]     inputs    Array of crisp input values.
+ * @param[in,out] ws        Workspace created with FIS_Plan_CreateWorkspace().
+ */
+void FIS_Plan_RuleWeights(const FIS_Plan* plan, const float* inputs, FIS_PlanWorkspace* ws);
+
+/**
+ * @brief Degree of one packed MF of a plan (no segment search).
+ *
+ * @param[in] plan      Pointer to the compiled plan.
+ * @param[in] slot      Degree slot of the MF (FIS_PlanInput::first_mf + MF index).
+ * @param[in] x         Crisp value of the input of the MF.
+ * @return              Degree of membership (-1.0f for a NULL MF).
+ */
+float FIS_Plan_MembershipDegree(const FIS_Plan* plan, int slot, float x);
+
+/**
+ * @brief Degrees of the MFs of one input, written to their slots of ws->degrees
+ *        (segment search from ws->segment_hints[input]); other slots are unchanged.
+ *
+ * @param[in]     plan      Pointer to the compiled plan.
+ * @param[in]     input     Index of the input.
+ * @param[in]     x         Crisp value of the input.
+ * @param[in,out] ws        Workspace created with FIS_Plan_CreateWorkspace().
+ */
+void FIS_Plan_FuzzifySingle(const FIS_Plan* plan, int input, float x, FIS_PlanWorkspace* ws);
+
+/**
+ * @brief Firing strength of one rule from the degrees of its antecedent MFs.
+ *
+ * @param[in] plan      Pointer to the compiled plan.
+ * @param[in] rule      Index of the rule.
+ * @param[in] degrees   Degrees of all MFs (e.g. ws->degrees).
+ * @return              Rule weight.
+ */
+float FIS_Plan_RuleFiring(const FIS_Plan* plan, int rule, const float* degrees);
+
+/**
+ * @brief Output of a distinct consequent of a plan (not weighted).
+ *
+ * @param[in] plan          Pointer to the compiled plan.
+ * @param[in] consequent    Index of the consequent (FIS_PlanRule::consequent).
+ * @param[in] inputs        Array of crisp input values.
+ * @return                  Consequent output.
+ */
+float FIS_Plan_Consequent(const FIS_Plan* plan, int consequent, const float* inputs);
+
+/**
+ * @brief Work removed by consequent and MF sharing in a compiled plan.
+ *
+ * @param[in]  plan      Pointer to the compiled plan.
+ * @param[out] sharing   Consequent and MF counts before and after sharing.
+ */
+void FIS_Plan_GetSharing(const FIS_Plan* plan, FIS_PlanSharing* sharing);
+
+/**
+ * @brief Output of the consequent of one rule (not weighted).
+ *
+ * @param[in] plan      Pointer to the compiled plan.
+ * @param[in] rule      Index of the rule.
+ * @param[in] inputs    Array of crisp input values.
+ * @return              Consequent output.
+ */
+float FIS_Plan_RuleConsequent(const FIS_Plan* plan, int rule, const float* inputs);
+
+/**
+ * @brief Output of a plan with FIS_PLAN_FLAG_GAIN_BLENDING for given normalized
+ *        rule weights: (sum_r w_r * K_r) . [x, 1].
+ *
+ * @param[in] plan                Pointer to the compiled plan.
+ * @param[in] inputs              Array of crisp input values.
+ * @param[in] normalized_weights  Rule weights divided by their sum, indexed by
+ *                                linear matrix row (rule order).
+ * @return                        Crisp output.
+ */
+float FIS_Plan_BlendedOutput(const FIS_Plan* plan, const float* inputs, const float* normalized_weights);
+
+/**
+ * @brief Computes the arena space needed by FIS_Plan_CreateBatchWorkspace().
+ *
+ * @param[in] plan      Pointer to the compiled plan.
+ * @return              Size in bytes (including alignment padding).
+ */
+size_t FIS_Plan_BatchWorkspaceSize(const FIS_Plan* plan);
+
+/**
+ * @brief Creates a batch evaluation workspace for a compiled plan.
+ *
+ * @param[in]     plan    Pointer to the compiled plan.
+ * @param[in,out] arena   Arena with at least FIS_Plan_BatchWorkspaceSize() bytes available.
+ * @return                Pointer to the workspace or NULL if the arena is exhausted.
+ */
+FIS_PlanBatchWorkspace* FIS_Plan_CreateBatchWorkspace(const FIS_Plan* plan, FIS_Arena* arena);
+
+/**
+ * @brief Evaluates a compiled plan for a batch of samples (structure-of-arrays inputs,
+ *        see FIS_EvaluateBatch()). Linear consequents of a block are computed as one
+ *        matrix-matrix product.
+ *
+ * @param[in]     plan      Pointer to the compiled plan.
+ * @param[in]     inputs    Array of plan->num_inputs pointers to input columns.
+ * @param[out]    outputs   Array of `count` crisp output values.
+ * @param[in]     count     Number of samples.
+ * @param[in,out] ws        Workspace created with FIS_Plan_CreateBatchWorkspace().
+ */
+void FIS_Plan_EvaluateBatch(const FIS_Plan* plan, const float* const* inputs, float* outputs, int count, FIS_PlanBatchWorkspace* ws);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* INC_FIS_SUGENO_PLAN_H_ */
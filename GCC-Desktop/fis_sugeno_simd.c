@@ -0,0 +1,428 @@
+/**
+  ******************************************************************************
+  * @file		: fis_sugeno_simd.c
+  * @author  	: AW		Adrian.Wojcik@put.poznan.pl
+  * @version 	: 1.0.0
+  * @date    	: Oct 17, 2026
+  * @brief   	: Takagi-Sugeno-Kang (Sugeno) Fuzzy Inference System for
+  *               embedded control systems
+  *               Vectorized kernels (SSE2/AVX2/AVX-512) for membership functions
+  *               and linear consequents, with runtime CPU dispatch and scalar
+  *               fallbacks
+  *
+  ******************************************************************************
+  */
+
+/* Private includes ----------------------------------------------------------*/
+#include <stddef.h>
+#include "fis_sugeno_simd.h"
+
+#ifdef FIS_SIMD_X86
+#include <immintrin.h>
+#endif
+
+/* Private variables ---------------------------------------------------------*/
+static FIS_SIMD_Level fis_simd_limit = FIS_SIMD_AVX512;
+
+/* Private functions ---------------------------------------------------------*/
+/*
+ * All kernels follow the branch order of the scalar implementations:
+ * the piecewise-linear segment is selected with compare masks (lowest priority
+ * first) and clamped with min/max, so every lane rounds exactly like
+ * FIS_MF_TriangularEval()/FIS_MF_TrapezoidalEval(). Constant operand of
+ * min/max comes first, which keeps NaN inputs and signed zeros identical too.
+ */
+static void FIS_MF_TriangularEvalArray_Scalar(const FIS_MF_TriangularParams* p, const float* input, float* output, int count)
+{
+    for (int s = 0; s < count; ++s)
+        output[s] = FIS_MF_TriangularEval(input[s], (void*)p);
+}
+
+static void FIS_MF_TrapezoidalEvalArray_Scalar(const FIS_MF_TrapezoidalParams* p, const float* input, float* output, int count)
+{
+    for (int s = 0; s < count; ++s)
+        output[s] = FIS_MF_TrapezoidalEval(input[s], (void*)p);
+}
+
+#ifdef FIS_SIMD_X86
+
+/* SSE2 (4 lanes) ------------------------------------------------------------*/
+__attribute__((target("sse2")))
+static inline __m128 FIS_SSE2_Select(__m128 mask, __m128 if_true, __m128 if_false)
+{
+    return _mm_or_ps(_mm_and_ps(mask, if_true), _mm_andnot_ps(mask, if_false));
+}
+
+__attribute__((target("sse2")))
+static void FIS_MF_TriangularEvalArray_SSE2(const FIS_MF_TriangularParams* p, const float* input, float* output, int count)
+{
+    const __m128 a = _mm_set1_ps(p->a);
+    const __m128 b = _mm_set1_ps(p->b);
+    const __m128 c = _mm_set1_ps(p->c);
+    const __m128 ba = _mm_set1_ps(p->b - p->a);
+    const __m128 cb = _mm_set1_ps(p->c - p->b);
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 one = _mm_set1_ps(1.0f);
+    int s = 0;
+
+    for (; s + 4 <= count; s += 4)
+    {
+        __m128 x = _mm_loadu_ps(input + s);
+        __m128 y = _mm_div_ps(_mm_sub_ps(c, x), cb);
+        y = FIS_SSE2_Select(_mm_cmplt_ps(x, b), _mm_div_ps(_mm_sub_ps(x, a), ba), y);
+        y = FIS_SSE2_Select(_mm_cmpeq_ps(x, b), one, y);
+        y = _mm_andnot_ps(_mm_or_ps(_mm_cmplt_ps(x, a), _mm_cmpgt_ps(x, c)), y);
+        y = _mm_max_ps(zero, _mm_min_ps(one, y));
+        _mm_storeu_ps(output + s, y);
+    }
+    FIS_MF_TriangularEvalArray_Scalar(p, input + s, output + s, count - s);
+}
+
+__attribute__((target("sse2")))
+static void FIS_MF_TrapezoidalEvalArray_SSE2(const FIS_MF_TrapezoidalParams* p, const float* input, float* output, int count)
+{
+    const __m128 a = _mm_set1_ps(p->a);
+    const __m128 b = _mm_set1_ps(p->b);
+    const __m128 c = _mm_set1_ps(p->c);
+    const __m128 d = _mm_set1_ps(p->d);
+    const __m128 ba = _mm_set1_ps(p->b - p->a);
+    const __m128 dc = _mm_set1_ps(p->d - p->c);
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 one = _mm_set1_ps(1.0f);
+    int s = 0;
+
+    for (; s + 4 <= count; s += 4)
+    {
+        __m128 x = _mm_loadu_ps(input + s);
+        __m128 y = _mm_div_ps(_mm_sub_ps(d, x), dc);
+        y = FIS_SSE2_Select(_mm_and_ps(_mm_cmpgt_ps(x, a), _mm_cmplt_ps(x, b)), _mm_div_ps(_mm_sub_ps(x, a), ba), y);
+        y = FIS_SSE2_Select(_mm_and_ps(_mm_cmpge_ps(x, b), _mm_cmple_ps(x, c)), one, y);
+        y = _mm_andnot_ps(_mm_or_ps(_mm_cmplt_ps(x, a), _mm_cmpgt_ps(x, d)), y);
+        y = _mm_max_ps(zero, _mm_min_ps(one, y));
+        _mm_storeu_ps(output + s, y);
+    }
+    FIS_MF_TrapezoidalEvalArray_Scalar(p, input + s, output + s, count - s);
+}
+
+/* AVX2 (8 lanes) ------------------------------------------------------------*/
+__attribute__((target("avx2")))
+static void FIS_MF_TriangularEvalArray_AVX2(const FIS_MF_TriangularParams* p, const float* input, float* output, int count)
+{
+    const __m256 a = _mm256_set1_ps(p->a);
+    const __m256 b = _mm256_set1_ps(p->b);
+    const __m256 c = _mm256_set1_ps(p->c);
+    const __m256 ba = _mm256_set1_ps(p->b - p->a);
+    const __m256 cb = _mm256_set1_ps(p->c - p->b);
+    const __m256 zero = _mm256_setzero_ps();
+    const __m256 one = _mm256_set1_ps(1.0f);
+    int s = 0;
+
+    for (; s + 8 <= count; s += 8)
+    {
+        __m256 x = _mm256_loadu_ps(input + s);
+        __m256 y = _mm256_div_ps(_mm256_sub_ps(c, x), cb);
+        y = _mm256_blendv_ps(y, _mm256_div_ps(_mm256_sub_ps(x, a), ba), _mm256_cmp_ps(x, b, _CMP_LT_OQ));
+        y = _mm256_blendv_ps(y, one, _mm256_cmp_ps(x, b, _CMP_EQ_OQ));
+        y = _mm256_andnot_ps(_mm256_or_ps(_mm256_cmp_ps(x, a, _CMP_LT_OQ), _mm256_cmp_ps(x, c, _CMP_GT_OQ)), y);
+        y = _mm256_max_ps(zero, _mm256_min_ps(one, y));
+        _mm256_storeu_ps(output + s, y);
+    }
+    FIS_MF_TriangularEvalArray_SSE2(p, input + s, output + s, count - s);
+}
+
+__attribute__((target("avx2")))
+static void FIS_MF_TrapezoidalEvalArray_AVX2(const FIS_MF_TrapezoidalParams* p, const float* input, float* output, int count)
+{
+    const __m256 a = _mm256_set1_ps(p->a);
+    const __m256 b = _mm256_set1_ps(p->b);
+    const __m256 c = _mm256_set1_ps(p->c);
+    const __m256 d = _mm256_set1_ps(p->d);
+    const __m256 ba = _mm256_set1_ps(p->b - p->a);
+    const __m256 dc = _mm256_set1_ps(p->d - p->c);
+    const __m256 zero = _mm256_setzero_ps();
+    const __m256 one = _mm256_set1_ps(1.0f);
+    int s = 0;
+
+    for (; s + 8 <= count; s += 8)
+    {
+        __m256 x = _mm256_loadu_ps(input + s);
+        __m256 y = _mm256_div_ps(_mm256_sub_ps(d, x), dc);
+        __m256 rising = _mm256_and_ps(_mm256_cmp_ps(x, a, _CMP_GT_OQ), _mm256_cmp_ps(x, b, _CMP_LT_OQ));
+        __m256 top = _mm256_and_ps(_mm256_cmp_ps(x, b, _CMP_GE_OQ), _mm256_cmp_ps(x, c, _CMP_LE_OQ));
+        y = _mm256_blendv_ps(y, _mm256_div_ps(_mm256_sub_ps(x, a), ba), rising);
+        y = _mm256_blendv_ps(y, one, top);
+        y = _mm256_andnot_ps(_mm256_or_ps(_mm256_cmp_ps(x, a, _CMP_LT_OQ), _mm256_cmp_ps(x, d, _CMP_GT_OQ)), y);
+        y = _mm256_max_ps(zero, _mm256_min_ps(one, y));
+        _mm256_storeu_ps(output + s, y);
+    }
+    FIS_MF_TrapezoidalEvalArray_SSE2(p, input + s, output + s, count - s);
+}
+
+/* AVX-512 (16 lanes) --------------------------------------------------------*/
+__attribute__((target("avx512f")))
+static void FIS_MF_TriangularEvalArray_AVX512(const FIS_MF_TriangularParams* p, const float* input, float* output, int count)
+{
+    const __m512 a = _mm512_set1_ps(p->a);
+    const __m512 b = _mm512_set1_ps(p->b);
+    const __m512 c = _mm512_set1_ps(p->c);
+    const __m512 ba = _mm512_set1_ps(p->b - p->a);
+    const __m512 cb = _mm512_set1_ps(p->c - p->b);
+    const __m512 zero = _mm512_setzero_ps();
+    const __m512 one = _mm512_set1_ps(1.0f);
+    int s = 0;
+
+    for (; s + 16 <= count; s += 16)
+    {
+        __m512 x = _mm512_loadu_ps(input + s);
+        __m512 y = _mm512_div_ps(_mm512_sub_ps(c, x), cb);
+        y = _mm512_mask_blend_ps(_mm512_cmp_ps_mask(x, b, _CMP_LT_OQ), y, _mm512_div_ps(_mm512_sub_ps(x, a), ba));
+        y = _mm512_mask_blend_ps(_mm512_cmp_ps_mask(x, b, _CMP_EQ_OQ), y, one);
+        __mmask16 inside = _mm512_cmp_ps_mask(x, a, _CMP_NLT_UQ) & _mm512_cmp_ps_mask(x, c, _CMP_NGT_UQ);
+        y = _mm512_maskz_mov_ps(inside, y);
+        y = _mm512_max_ps(zero, _mm512_min_ps(one, y));
+        _mm512_storeu_ps(output + s, y);
+    }
+    FIS_MF_TriangularEvalArray_AVX2(p, input + s, output + s, count - s);
+}
+
+__attribute__((target("avx512f")))
+static void FIS_MF_TrapezoidalEvalArray_AVX512(const FIS_MF_TrapezoidalParams* p, const float* input, float* output, int count)
+{
+    const __m512 a = _mm512_set1_ps(p->a);
+    const __m512 b = _mm512_set1_ps(p->b);
+    const __m512 c = _mm512_set1_ps(p->c);
+    const __m512 d = _mm512_set1_ps(p->d);
+    const __m512 ba = _mm512_set1_ps(p->b - p->a);
+    const __m512 dc = _mm512_set1_ps(p->d - p->c);
+    const __m512 zero = _mm512_setzero_ps();
+    const __m512 one = _mm512_set1_ps(1.0f);
+    int s = 0;
+
+    for (; s + 16 <= count; s += 16)
+    {
+        __m512 x = _mm512_loadu_ps(input + s);
+        __m512 y = _mm512_div_ps(_mm512_sub_ps(d, x), dc);
+        __mmask16 rising = _mm512_cmp_ps_mask(x, a, _CMP_GT_OQ) & _mm512_cmp_ps_mask(x, b, _CMP_LT_OQ);
+        __mmask16 top = _mm512_cmp_ps_mask(x, b, _CMP_GE_OQ) & _mm512_cmp_ps_mask(x, c, _CMP_LE_OQ);
+        __mmask16 inside = _mm512_cmp_ps_mask(x, a, _CMP_NLT_UQ) & _mm512_cmp_ps_mask(x, d, _CMP_NGT_UQ);
+        y = _mm512_mask_blend_ps(rising, y, _mm512_div_ps(_mm512_sub_ps(x, a), ba));
+        y = _mm512_mask_blend_ps(top, y, one);
+        y = _mm512_maskz_mov_ps(inside, y);
+        y = _mm512_max_ps(zero, _mm512_min_ps(one, y));
+        _mm512_storeu_ps(output + s, y);
+    }
+    FIS_MF_TrapezoidalEvalArray_AVX2(p, input + s, output + s, count - s);
+}
+
+/* Linear algebra kernels ----------------------------------------------------*/
+__attribute__((target("sse2")))
+static void FIS_SIMD_Gemv_SSE2(const float* matrix, int stride, const float* x, int num_columns, float* y)
+{
+    for (int r = 0; r < stride; r += 4)
+    {
+        __m128 acc = _mm_setzero_ps();
+        for (int c = 0; c < num_columns; ++c)
+            acc = _mm_add_ps(acc, _mm_mul_ps(_mm_loadu_ps(&matrix[c * stride + r]), _mm_set1_ps(x[c])));
+        _mm_storeu_ps(&y[r], acc);
+    }
+}
+
+__attribute__((target("avx2,fma")))
+static void FIS_SIMD_Gemv_AVX2(const float* matrix, int stride, const float* x, int num_columns, float* y)
+{
+    for (int r = 0; r < stride; r += 8)
+    {
+        __m256 acc = _mm256_setzero_ps();
+        for (int c = 0; c < num_columns; ++c)
+            acc = _mm256_fmadd_ps(_mm256_loadu_ps(&matrix[c * stride + r]), _mm256_set1_ps(x[c]), acc);
+        _mm256_storeu_ps(&y[r], acc);
+    }
+}
+
+__attribute__((target("avx512f")))
+static void FIS_SIMD_Gemv_AVX512(const float* matrix, int stride, const float* x, int num_columns, float* y)
+{
+    for (int r = 0; r < stride; r += 16)
+    {
+        __m512 acc = _mm512_setzero_ps();
+        for (int c = 0; c < num_columns; ++c)
+            acc = _mm512_fmadd_ps(_mm512_loadu_ps(&matrix[c * stride + r]), _mm512_set1_ps(x[c]), acc);
+        _mm512_storeu_ps(&y[r], acc);
+    }
+}
+
+__attribute__((target("sse2")))
+static void FIS_SIMD_Axpy_SSE2(float alpha, const float* x, float* y, int count)
+{
+    const __m128 a = _mm_set1_ps(alpha);
+    int s = 0;
+
+    for (; s + 4 <= count; s += 4)
+        _mm_storeu_ps(&y[s], _mm_add_ps(_mm_loadu_ps(&y[s]), _mm_mul_ps(a, _mm_loadu_ps(&x[s]))));
+    for (; s < count; ++s)
+        y[s] += alpha * x[s];
+}
+
+__attribute__((target("avx2,fma")))
+static void FIS_SIMD_Axpy_AVX2(float alpha, const float* x, float* y, int count)
+{
+    const __m256 a = _mm256_set1_ps(alpha);
+    int s = 0;
+
+    for (; s + 8 <= count; s += 8)
+        _mm256_storeu_ps(&y[s], _mm256_fmadd_ps(a, _mm256_loadu_ps(&x[s]), _mm256_loadu_ps(&y[s])));
+    for (; s < count; ++s)
+        y[s] = __builtin_fmaf(alpha, x[s], y[s]);
+}
+
+__attribute__((target("avx512f")))
+static void FIS_SIMD_Axpy_AVX512(float alpha, const float* x, float* y, int count)
+{
+    const __m512 a = _mm512_set1_ps(alpha);
+    int s = 0;
+
+    for (; s + 16 <= count; s += 16)
+        _mm512_storeu_ps(&y[s], _mm512_fmadd_ps(a, _mm512_loadu_ps(&x[s]), _mm512_loadu_ps(&y[s])));
+    FIS_SIMD_Axpy_AVX2(alpha, x + s, y + s, count - s);
+}
+
+#endif /* FIS_SIMD_X86 */
+
+/**
+ * @brief Best SIMD level supported by the CPU (and the OS register state).
+ */
+static FIS_SIMD_Level FIS_SIMD_Detect(void)
+{
+#ifdef FIS_SIMD_X86
+    if (__builtin_cpu_supports("avx512f"))
+        return FIS_SIMD_AVX512;
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma"))
+        return FIS_SIMD_AVX2;
+    if (__builtin_cpu_supports("sse2"))
+        return FIS_SIMD_SSE2;
+#endif
+    return FIS_SIMD_SCALAR;
+}
+
+/* Public functions ----------------------------------------------------------*/
+FIS_SIMD_Level FIS_SIMD_GetLevel(void)
+{
+    FIS_SIMD_Level level = FIS_SIMD_Detect();
+    return (level < fis_simd_limit) ? level : fis_simd_limit;
+}
+
+void FIS_SIMD_SetLevel(FIS_SIMD_Level level)
+{
+    fis_simd_limit = level;
+}
+
+void FIS_MF_TriangularEvalArray(const FIS_MF_TriangularParams* params, const float* input, float* output, int count)
+{
+    switch (FIS_SIMD_GetLevel())
+    {
+#ifdef FIS_SIMD_X86
+        case FIS_SIMD_AVX512:
+            FIS_MF_TriangularEvalArray_AVX512(params, input, output, count);
+            return;
+        case FIS_SIMD_AVX2:
+            FIS_MF_TriangularEvalArray_AVX2(params, input, output, count);
+            return;
+        case FIS_SIMD_SSE2:
+            FIS_MF_TriangularEvalArray_SSE2(params, input, output, count);
+            return;
+#endif
+        default:
+            FIS_MF_TriangularEvalArray_Scalar(params, input, output, count);
+            return;
+    }
+}
+
+void FIS_MF_TrapezoidalEvalArray(const FIS_MF_TrapezoidalParams* params, const float* input, float* output, int count)
+{
+    switch (FIS_SIMD_GetLevel())
+    {
+#ifdef FIS_SIMD_X86
+        case FIS_SIMD_AVX512:
+            FIS_MF_TrapezoidalEvalArray_AVX512(params, input, output, count);
+            return;
+        case FIS_SIMD_AVX2:
+            FIS_MF_TrapezoidalEvalArray_AVX2(params, input, output, count);
+            return;
+        case FIS_SIMD_SSE2:
+            FIS_MF_TrapezoidalEvalArray_SSE2(params, input, output, count);
+            return;
+#endif
+        default:
+            FIS_MF_TrapezoidalEvalArray_Scalar(params, input, output, count);
+            return;
+    }
+}
+
+void FIS_MF_EvalArray(const FIS_MembershipFunction* mf, const float* input, float* output, int count)
+{
+    if (mf == NULL)
+    {
+        for (int s = 0; s < count; ++s)
+            output[s] = -1.0f;
+    }
+    else if (mf->eval == FIS_MF_TriangularEval)
+    {
+        FIS_MF_TriangularEvalArray((const FIS_MF_TriangularParams*)mf->params, input, output, count);
+    }
+    else if (mf->eval == FIS_MF_TrapezoidalEval)
+    {
+        FIS_MF_TrapezoidalEvalArray((const FIS_MF_TrapezoidalParams*)mf->params, input, output, count);
+    }
+    else
+    {
+        for (int s = 0; s < count; ++s)
+            output[s] = mf->eval(input[s], mf->params);
+    }
+}
+
+void FIS_SIMD_Gemv(const float* matrix, int stride, const float* x, int num_columns, float* y)
+{
+    switch (FIS_SIMD_GetLevel())
+    {
+#ifdef FIS_SIMD_X86
+        case FIS_SIMD_AVX512:
+            FIS_SIMD_Gemv_AVX512(matrix, stride, x, num_columns, y);
+            return;
+        case FIS_SIMD_AVX2:
+            FIS_SIMD_Gemv_AVX2(matrix, stride, x, num_columns, y);
+            return;
+        case FIS_SIMD_SSE2:
+            FIS_SIMD_Gemv_SSE2(matrix, stride, x, num_columns, y);
+            return;
+#endif
+        default:
+            for (int r = 0; r < stride; ++r)
+                y[r] = 0.0f;
+            for (int c = 0; c < num_columns; ++c)
+                for (int r = 0; r < stride; ++r)
+                    y[r] += matrix[c * stride + r] * x[c];
+            return;
+    }
+}
+
+void FIS_SIMD_Axpy(float alpha, const float* x, float* y, int count)
+{
+    switch (FIS_SIMD_GetLevel())
+    {
+#ifdef FIS_SIMD_X86
+        case FIS_SIMD_AVX512:
+            FIS_SIMD_Axpy_AVX512(alpha, x, y, count);
+            return;
+        case FIS_SIMD_AVX2:
+            FIS_SIMD_Axpy_AVX2(alpha, x, y, count);
+            return;
+        case FIS_SIMD_SSE2:
+            FIS_SIMD_Axpy_SSE2(alpha, x, y, count);
+            return;
+#endif
+        default:
+            for (int s = 0; s < count; ++s)
+                y[s] += alpha * x[s];
+            return;
+    }
+}
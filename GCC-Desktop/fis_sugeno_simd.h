@@ -0,0 +1,121 @@
+/**
+  ******************************************************************************
+  * @file		: fis_sugeno_simd.h
+  * @author  	: AW		Adrian.Wojcik@put.poznan.pl
+  * @version 	: 1.0.0
+  * @date    	: Oct 17, 2026
+  * @brief   	: Takagi-Sugeno-Kang (Sugeno) Fuzzy Inference System for
+  *               embedded control systems
+  *               Vectorized kernels (SSE2/AVX2/AVX-512) for membership functions
+  *               and linear consequents, with runtime CPU dispatch and scalar
+  *               fallbacks
+  *
+  ******************************************************************************
+  */
+
+#ifndef INC_FIS_SUGENO_SIMD_H_
+#define INC_FIS_SUGENO_SIMD_H_
+
+/* Public includes -----------------------------------------------------------*/
+#include "fis_sugeno.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Public typedef ------------------------------------------------------------*/
+typedef enum
+{
+    FIS_SIMD_SCALAR,
+    FIS_SIMD_SSE2,      // 4 lanes
+    FIS_SIMD_AVX2,      // 8 lanes, with FMA
+    FIS_SIMD_AVX512     // 16 lanes
+} FIS_SIMD_Level;
+
+/* Public define -------------------------------------------------------------*/
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define FIS_SIMD_X86
+#endif
+
+#define FIS_SIMD_MAX_LANES  16  // Padding granularity of vectorized row blocks
+
+/* Public function prototypes ------------------------------------------------*/
+/**
+ * @brief Returns the instruction set used by the array kernels: the best one
+ *        supported by the running CPU, unless lowered with FIS_SIMD_SetLevel().
+ *
+ * @return              Active SIMD level.
+ */
+FIS_SIMD_Level FIS_SIMD_GetLevel(void);
+
+/**
+ * @brief Limits the instruction set used by the array kernels (e.g. for testing
+ *        or benchmarking). Levels above the CPU capabilities are ignored.
+ *        Not thread-safe: call before evaluation starts.
+ *
+ * @param[in] level     Highest SIMD level to be used.
+ */
+void FIS_SIMD_SetLevel(FIS_SIMD_Level level);
+
+/**
+ * @brief Evaluates a triangular membership function for an array of inputs.
+ *        Results are bit-identical to FIS_MF_TriangularEval().
+ *
+ * @param[in]  params   Triangle parameters.
+ * @param[in]  input    Array of input values.
+ * @param[out] output   Array of degrees of membership.
+ * @param[in]  count    Number of values.
+ */
+void FIS_MF_TriangularEvalArray(const FIS_MF_TriangularParams* params, const float* input, float* output, int count);
+
+/**
+ * @brief Evaluates a trapezoidal membership function for an array of inputs.
+ *        Results are bit-identical to FIS_MF_TrapezoidalEval().
+ *
+ * @param[in]  params   Trapezoid parameters.
+ * @param[in]  input    Array of input values.
+ * @param[out] output   Array of degrees of membership.
+ * @param[in]  count    Number of values.
+ */
+void FIS_MF_TrapezoidalEvalArray(const FIS_MF_TrapezoidalParams* params, const float* input, float* output, int count);
+
+/**
+ * @brief Evaluates any membership function for an array of inputs. Built-in
+ *        shapes use the vectorized kernels, other MFs are called per element.
+ *
+ * @param[in]  mf       Pointer to the membership function (NULL yields -1.0f,
+ *                      as in FIS_EvaluateMemberFunction()).
+ * @param[in]  input    Array of input values.
+ * @param[out] output   Array of degrees of membership.
+ * @param[in]  count    Number of values.
+ */
+void FIS_MF_EvalArray(const FIS_MembershipFunction* mf, const float* input, float* output, int count);
+
+/**
+ * @brief Matrix-vector product with a column-major matrix: y = M * x.
+ *        Vectorized across rows, multiply-adds are fused on AVX2/AVX-512.
+ *
+ * @param[in]  matrix       Column-major matrix: matrix[c * stride + r].
+ * @param[in]  stride       Number of (padded) rows, multiple of FIS_SIMD_MAX_LANES.
+ * @param[in]  x            Vector of num_columns values.
+ * @param[in]  num_columns  Number of matrix columns.
+ * @param[out] y            Vector of `stride` results.
+ */
+void FIS_SIMD_Gemv(const float* matrix, int stride, const float* x, int num_columns, float* y);
+
+/**
+ * @brief Scaled vector accumulation: y += alpha * x.
+ *        Multiply-adds are fused on AVX2/AVX-512.
+ *
+ * @param[in]     alpha   Scale factor.
+ * @param[in]     x       Input vector.
+ * @param[in,out] y       Accumulated vector.
+ * @param[in]     count   Number of elements.
+ */
+void FIS_SIMD_Axpy(float alpha, const float* x, float* y, int count);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* INC_FIS_SUGENO_SIMD_H_ */
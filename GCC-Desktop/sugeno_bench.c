@@ -0,0 +1,1127 @@
+#include "fis_sugeno_config.h"
+#include "fis_sugeno_simd.h"
+#include "fis_sugeno_plan.h"
+#include "fis_sugeno_lut.h"
+#include "fis_sugeno_fixed.h"
+#include "fis_sugeno_generated.h"
+#include "fis_sugeno_jit.h"
+#include "fis_sugeno_loader.h"
+#include "fis_sugeno_image.h"
+#include "fis_sugeno_builder.h"
+#include "fis_sugeno_index.h"
+#include "fis_sugeno_incremental.h"
+#include "fis_sugeno_event.h"
+#include "fis_sugeno_mimo.h"
+#include "fis_sugeno_group.h"
+
+#include "test1_input_array.c"
+#include "test1_output_array.c"
+
+#include "test2_input_array.c"
+#include "test2_output_array.c"
+
+#include "test_systems.c"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <string.h>
+#include <time.h>
+
+#define BENCH_SAMPLES   200001  // Length of the offline replay traces
+#define BENCH_REPEAT    10      // Passes over the trace per measurement
+
+typedef struct
+{
+    const char* name;
+    FIS_System* fis;
+    int num_inputs;
+    float* rows;        // BENCH_SAMPLES x num_inputs (array-of-structures)
+    float* columns;     // num_inputs x BENCH_SAMPLES (structure-of-arrays)
+    const float* column_ptrs[FIS_MAX_INPUTS];
+    float* reference;   // FIS_Evaluate() outputs
+    float* outputs;
+    unsigned char memory[32768];
+    FIS_Arena arena;
+    FIS_Workspace* ws;
+    const FIS_Plan* plan;
+    FIS_PlanWorkspace* plan_ws;
+    FIS_PlanBatchWorkspace* plan_batch_ws;
+    float (*generated)(const float* inputs);   // sugeno_codegen output for this FIS
+} BenchCase;
+
+static double bench_seconds(void)
+{
+    return (double)clock() / CLOCKS_PER_SEC;
+}
+
+static void bench_report(const char* name, double seconds)
+{
+    double rate = (double)BENCH_SAMPLES * BENCH_REPEAT / seconds;
+    printf("  %-28s %10.3f Msamples/s  (%.1f ns/sample)\n", name, rate * 1e-6, 1e9 / rate);
+}
+
+static float bench_max_deviation(const float* a, const float* b, int count)
+{
+    float max_dev = 0.0f;
+    for (int s = 0; s < count; ++s)
+    {
+        float dev = fabsf(a[s] - b[s]);
+        if (dev > max_dev)
+            max_dev = dev;
+    }
+    return max_dev;
+}
+
+/**
+ * @brief Builds a BENCH_SAMPLES long trace by repeating a test vector set.
+ */
+static void bench_case_init(BenchCase* bc, const char* name, FIS_System* fis, const float* test_inputs, int test_count)
+{
+    bc->name = name;
+    bc->fis = fis;
+    bc->num_inputs = fis->num_inputs;
+    bc->rows = malloc(sizeof(float) * BENCH_SAMPLES * bc->num_inputs);
+    bc->columns = malloc(sizeof(float) * BENCH_SAMPLES * bc->num_inputs);
+    bc->reference = malloc(sizeof(float) * BENCH_SAMPLES);
+    bc->outputs = malloc(sizeof(float) * BENCH_SAMPLES);
+
+    for (int s = 0; s < BENCH_SAMPLES; ++s)
+    {
+        const float* src = &test_inputs[(s % test_count) * bc->num_inputs];
+        for (int i = 0; i < bc->num_inputs; ++i)
+        {
+            bc->rows[s * bc->num_inputs + i] = src[i];
+            bc->columns[i * BENCH_SAMPLES + s] = src[i];
+        }
+    }
+    for (int i = 0; i < bc->num_inputs; ++i)
+        bc->column_ptrs[i] = &bc->columns[i * BENCH_SAMPLES];
+
+    for (int s = 0; s < BENCH_SAMPLES; ++s)
+        bc->reference[s] = FIS_Evaluate(fis, &bc->rows[s * bc->num_inputs]);
+
+    FIS_Arena_Init(&bc->arena, bc->memory, sizeof(bc->memory));
+    bc->ws = FIS_Workspace_Create(fis, &bc->arena);
+    bc->plan = FIS_Compile(fis, &bc->arena);
+    bc->plan_ws = FIS_Plan_CreateWorkspace(bc->plan, &bc->arena);
+    bc->plan_batch_ws = FIS_Plan_CreateBatchWorkspace(bc->plan, &bc->arena);
+}
+
+static void bench_case_free(BenchCase* bc)
+{
+    free(bc->rows);
+    free(bc->columns);
+    free(bc->reference);
+    free(bc->outputs);
+}
+
+static void bench_evaluate(BenchCase* bc)
+{
+    double t0 = bench_seconds();
+    for (int k = 0; k < BENCH_REPEAT; ++k)
+        for (int s = 0; s < BENCH_SAMPLES; ++s)
+            bc->outputs[s] = FIS_Evaluate(bc->fis, &bc->rows[s * bc->num_inputs]);
+    bench_report("FIS_Evaluate", bench_seconds() - t0);
+}
+
+static void bench_evaluate_batch(BenchCase* bc)
+{
+    double t0 = bench_seconds();
+    for (int k = 0; k < BENCH_REPEAT; ++k)
+        FIS_EvaluateBatch(bc->fis, bc->column_ptrs, bc->outputs, BENCH_SAMPLES);
+    bench_report("FIS_EvaluateBatch", bench_seconds() - t0);
+    printf("  %-28s %g\n", "max deviation", bench_max_deviation(bc->outputs, bc->reference, BENCH_SAMPLES));
+
+    t0 = bench_seconds();
+    for (int k = 0; k < BENCH_REPEAT; ++k)
+        FIS_Plan_EvaluateBatch(bc->plan, bc->column_ptrs, bc->outputs, BENCH_SAMPLES, bc->plan_batch_ws);
+    bench_report("FIS_Plan_EvaluateBatch", bench_seconds() - t0);
+    printf("  %-28s %g\n", "max deviation", bench_max_deviation(bc->outputs, bc->reference, BENCH_SAMPLES));
+}
+
+static double bench_plan(const FIS_Plan* plan, BenchCase* bc)
+{
+    double t0 = bench_seconds();
+    for (int k = 0; k < BENCH_REPEAT; ++k)
+        for (int s = 0; s < BENCH_SAMPLES; ++s)
+            bc->outputs[s] = FIS_Plan_Evaluate(plan, &bc->rows[s * bc->num_inputs], bc->plan_ws);
+    return bench_seconds() - t0;
+}
+
+/**
+ * @brief Gain blending vs rule-by-rule consequents (same plan with the flag cleared).
+ */
+static void bench_gain_blending(BenchCase* bc)
+{
+    if (!(bc->plan->flags & FIS_PLAN_FLAG_GAIN_BLENDING))
+    {
+        printf("  %-28s not applicable\n", "gain blending");
+        return;
+    }
+
+    // Partition-of-unity path disabled in both (see bench_partition())
+    FIS_Plan* rules_plan = FIS_Arena_Alloc(&bc->arena, bc->plan->size, FIS_PLAN_ALIGN);
+    FIS_Plan* blended_plan = FIS_Arena_Alloc(&bc->arena, bc->plan->size, FIS_PLAN_ALIGN);
+    memcpy(rules_plan, bc->plan, bc->plan->size);
+    memcpy(blended_plan, bc->plan, bc->plan->size);
+    rules_plan->flags &= ~(FIS_PLAN_FLAG_GAIN_BLENDING | FIS_PLAN_FLAG_PARTITION);
+    blended_plan->flags &= ~FIS_PLAN_FLAG_PARTITION;
+
+    double t_rules = bench_plan(rules_plan, bc);
+    bench_report("FIS_Plan_Evaluate (rules)", t_rules);
+    float max_dev = bench_max_deviation(bc->outputs, bc->reference, BENCH_SAMPLES);
+
+    double t_blended = bench_plan(blended_plan, bc);
+    bench_report("FIS_Plan_Evaluate (blended)", t_blended);
+    printf("  %-28s %g / %g (scheduling input: %d)\n", "max deviation", max_dev,
+           bench_max_deviation(bc->outputs, bc->reference, BENCH_SAMPLES), bc->plan->scheduling_input);
+    printf("  %-28s %.2fx\n", "gain blending speedup", t_rules / t_blended);
+}
+
+/**
+ * @brief LUT backend (normalized weights tabulated to 1e-3) vs the exact plan.
+ */
+static void bench_lut(BenchCase* bc)
+{
+    FIS_Arena lut_arena;
+    size_t lut_size = FIS_LUT_MaxSize(bc->plan);
+    void* lut_memory = malloc(lut_size);
+    FIS_Arena_Init(&lut_arena, lut_memory, lut_size);
+
+    const FIS_LUT* lut = FIS_LUT_Create(bc->plan, 1e-3f, &lut_arena);
+    if (lut == NULL)
+    {
+        printf("  %-28s not applicable\n", "FIS_LUT_Evaluate");
+        free(lut_memory);
+        return;
+    }
+
+    double t0 = bench_seconds();
+    for (int k = 0; k < BENCH_REPEAT; ++k)
+        for (int s = 0; s < BENCH_SAMPLES; ++s)
+            bc->outputs[s] = FIS_LUT_Evaluate(lut, &bc->rows[s * bc->num_inputs], bc->plan_ws);
+    bench_report("FIS_LUT_Evaluate", bench_seconds() - t0);
+    printf("  %-28s %g (%d points)\n", "max deviation", bench_max_deviation(bc->outputs, bc->reference, BENCH_SAMPLES), (int)lut->axes[0].num_points);
+    free(lut_memory);
+}
+
+/**
+ * @brief Fixed-point engine (Q15/Q31), per sample and batch.
+ */
+static void bench_fixed(BenchCase* bc)
+{
+    unsigned char memory[4096];
+    float ranges[FIS_MAX_INPUTS] = { 0.0f };
+    FIS_Arena arena;
+    FIS_Arena_Init(&arena, memory, sizeof(memory));
+
+    for (int s = 0; s < BENCH_SAMPLES; ++s)
+        for (int i = 0; i < bc->num_inputs; ++i)
+            if (fabsf(bc->rows[s * bc->num_inputs + i]) > ranges[i])
+                ranges[i] = fabsf(bc->rows[s * bc->num_inputs + i]);
+
+    const FIS_FixedSystem* fixed = FIS_Fixed_Convert(bc->fis, ranges, &arena);
+    if (fixed == NULL)
+    {
+        printf("  %-28s not applicable\n", "FIS_Fixed_Evaluate");
+        return;
+    }
+
+    FIS_Q31* rows = malloc(sizeof(FIS_Q31) * BENCH_SAMPLES * bc->num_inputs);
+    FIS_Q31* columns = malloc(sizeof(FIS_Q31) * BENCH_SAMPLES * bc->num_inputs);
+    FIS_Q31* outputs = malloc(sizeof(FIS_Q31) * BENCH_SAMPLES);
+    const FIS_Q31* column_ptrs[FIS_MAX_INPUTS];
+
+    for (int s = 0; s < BENCH_SAMPLES; ++s)
+    {
+        for (int i = 0; i < bc->num_inputs; ++i)
+        {
+            rows[s * bc->num_inputs + i] = FIS_Fixed_FromFloat(bc->rows[s * bc->num_inputs + i], fixed->input_exponents[i]);
+            columns[i * BENCH_SAMPLES + s] = rows[s * bc->num_inputs + i];
+        }
+    }
+    for (int i = 0; i < bc->num_inputs; ++i)
+        column_ptrs[i] = &columns[i * BENCH_SAMPLES];
+
+    double t0 = bench_seconds();
+    for (int k = 0; k < BENCH_REPEAT; ++k)
+        for (int s = 0; s < BENCH_SAMPLES; ++s)
+            outputs[s] = FIS_Fixed_Evaluate(fixed, &rows[s * bc->num_inputs]);
+    bench_report("FIS_Fixed_Evaluate", bench_seconds() - t0);
+
+    t0 = bench_seconds();
+    for (int k = 0; k < BENCH_REPEAT; ++k)
+        FIS_Fixed_EvaluateBatch(fixed, column_ptrs, outputs, BENCH_SAMPLES);
+    bench_report("FIS_Fixed_EvaluateBatch", bench_seconds() - t0);
+
+    for (int s = 0; s < BENCH_SAMPLES; ++s)
+        bc->outputs[s] = FIS_Fixed_ToFloat(outputs[s], fixed->output_exponent);
+    printf("  %-28s %g\n", "max deviation", bench_max_deviation(bc->outputs, bc->reference, BENCH_SAMPLES));
+
+    free(rows);
+    free(columns);
+    free(outputs);
+}
+
+static void bench_evaluate_plan(BenchCase* bc)
+{
+    double t0 = bench_seconds();
+    for (int k = 0; k < BENCH_REPEAT; ++k)
+        for (int s = 0; s < BENCH_SAMPLES; ++s)
+            bc->outputs[s] = FIS_EvaluateReentrant(bc->fis, &bc->rows[s * bc->num_inputs], bc->ws);
+    bench_report("FIS_EvaluateReentrant", bench_seconds() - t0);
+
+    t0 = bench_seconds();
+    for (int k = 0; k < BENCH_REPEAT; ++k)
+        for (int s = 0; s < BENCH_SAMPLES; ++s)
+            bc->outputs[s] = FIS_Plan_Evaluate(bc->plan, &bc->rows[s * bc->num_inputs], bc->plan_ws);
+    bench_report("FIS_Plan_Evaluate", bench_seconds() - t0);
+    printf("  %-28s %g (plan: %u bytes)\n", "max deviation", bench_max_deviation(bc->outputs, bc->reference, BENCH_SAMPLES), (unsigned)bc->plan->size);
+}
+
+/**
+ * @brief Reports how many consequent evaluations are skipped on the trace
+ *        (rules with zero firing strength).
+ */
+static void bench_generated(BenchCase* bc)
+{
+    double t0 = bench_seconds();
+    for (int k = 0; k < BENCH_REPEAT; ++k)
+        for (int s = 0; s < BENCH_SAMPLES; ++s)
+            bc->outputs[s] = bc->generated(&bc->rows[s * bc->num_inputs]);
+    bench_report("generated code", bench_seconds() - t0);
+    printf("  %-28s %g\n", "max deviation", bench_max_deviation(bc->outputs, bc->reference, BENCH_SAMPLES));
+}
+
+static double bench_wall_seconds(void)
+{
+    struct timespec ts;
+    timespec_get(&ts, TIME_UTC);
+    return (double)ts.tv_sec + 1e-9 * ts.tv_nsec;
+}
+
+/**
+ * @brief JIT: first call latency with an empty cache (compiler run) and with the shared
+ *        object cached, then steady-state throughput. Latencies are wall-clock time.
+ */
+static void bench_jit(BenchCase* bc)
+{
+    char cache_dir[] = "/tmp/fis_jit_XXXXXX";
+    unsigned char memory[256];
+    FIS_Arena arena;
+    FIS_Arena_Init(&arena, memory, sizeof(memory));
+
+#if FIS_JIT_SUPPORTED
+    if (mkdtemp(cache_dir) == NULL)
+        return;
+#endif
+
+    double t0 = bench_wall_seconds();
+    FIS_JIT* jit = FIS_JIT_Create(bc->fis, cache_dir, &arena);
+    volatile float first = FIS_JIT_Evaluate(jit, bc->rows);
+    const double t_compile = bench_wall_seconds() - t0;
+    FIS_JIT_Release(jit);
+
+    t0 = bench_wall_seconds();
+    jit = FIS_JIT_Create(bc->fis, cache_dir, &arena);
+    first = FIS_JIT_Evaluate(jit, bc->rows);
+    const double t_cached = bench_wall_seconds() - t0;
+    (void)first;
+
+    printf("  %-28s %.1f ms (compile), %.3f ms (cached)%s\n", "JIT first call", 1e3 * t_compile, 1e3 * t_cached,
+           (jit->function == NULL) ? ", no compiler: interpreter fallback" : "");
+
+    t0 = bench_seconds();
+    for (int k = 0; k < BENCH_REPEAT; ++k)
+        for (int s = 0; s < BENCH_SAMPLES; ++s)
+            bc->outputs[s] = FIS_JIT_Evaluate(jit, &bc->rows[s * bc->num_inputs]);
+    bench_report("FIS_JIT_Evaluate", bench_seconds() - t0);
+    printf("  %-28s %g\n", "max deviation", bench_max_deviation(bc->outputs, bc->reference, BENCH_SAMPLES));
+    FIS_JIT_Release(jit);
+
+#if FIS_JIT_SUPPORTED
+    char path[64];
+    snprintf(path, sizeof(path), "%s/fis_%016llx.so", cache_dir, (unsigned long long)jit->hash);
+    remove(path);
+    remove(cache_dir);
+#endif
+}
+
+/**
+ * @brief '.fis' parsing time (file read once, FIS_Load() repeated over a reset arena).
+ */
+static void bench_load(const char* path)
+{
+    enum { LOADS = 10000 };
+    static unsigned char memory[4096];
+    static char text[8192];
+    FIS_Arena arena;
+    FIS_Arena_Init(&arena, memory, sizeof(memory));
+
+    FILE* file = fopen(path, "rb");
+    size_t length = (file != NULL) ? fread(text, 1, sizeof(text) - 1, file) : 0;
+    if (file != NULL)
+        fclose(file);
+    text[length] = '\0';
+
+    int loaded = 0;
+    double t0 = bench_wall_seconds();
+    for (int k = 0; k < LOADS; ++k)
+    {
+        FIS_Arena_Reset(&arena);
+        loaded += (FIS_Load(text, &arena, NULL) != NULL);
+    }
+    const double seconds = bench_wall_seconds() - t0;
+    printf("  %-28s %.2f us/load (%d of %d loaded, %u bytes)\n", path, 1e6 * seconds / LOADS, loaded, LOADS, (unsigned)arena.used);
+}
+
+/**
+ * @brief Construction rate of the builder API: every build records the whole FIS
+ *        (FIS_Builder_AddSystem()) and lays it out with FIS_Builder_Finalize().
+ */
+static void bench_builder(const char* name, const FIS_System* fis)
+{
+    enum { BUILDS = 10000 };
+    static unsigned char scratch_memory[8192];
+    static unsigned char memory[4096];
+    FIS_Arena scratch, arena;
+    FIS_Builder builder;
+    FIS_Arena_Init(&scratch, scratch_memory, sizeof(scratch_memory));
+    FIS_Arena_Init(&arena, memory, sizeof(memory));
+
+    int built = 0;
+    double t0 = bench_wall_seconds();
+    for (int k = 0; k < BUILDS; ++k)
+    {
+        FIS_Arena_Reset(&scratch);
+        FIS_Arena_Reset(&arena);
+        FIS_Builder_Init(&builder, &scratch);
+        FIS_Builder_AddSystem(&builder, fis);
+        built += (FIS_Builder_Finalize(&builder, &arena) != NULL);
+    }
+    const double seconds = bench_wall_seconds() - t0;
+    printf("  %-28s %.2f us/build, %.0f builds/s (%d of %d built, %u bytes)\n", name, 1e6 * seconds / BUILDS,
+           BUILDS / seconds, built, BUILDS, (unsigned)arena.used);
+}
+
+/**
+ * @brief Inverted rule index vs rule-by-rule evaluation on complete grid rule bases.
+ */
+static void bench_index(int num_inputs, int num_mfs)
+{
+    enum { SAMPLES = 20000, SCRATCH = 16 << 20, MEMORY = 16 << 20 };
+    FIS_Arena scratch, arena;
+    void* scratch_memory = malloc(SCRATCH);
+    void* memory = malloc(MEMORY);
+    float* inputs = malloc(sizeof(float) * SAMPLES * num_inputs);
+    FIS_Arena_Init(&scratch, scratch_memory, SCRATCH);
+    FIS_Arena_Init(&arena, memory, MEMORY);
+
+    FIS_System* fis = build_grid_fis(num_inputs, num_mfs, FIS_AND_PRODUCT, 0, &scratch, &arena);
+    const FIS_RuleIndex* index = (fis != NULL) ? FIS_Index_Create(fis, &arena) : NULL;
+    FIS_IndexWorkspace* index_ws = (index != NULL) ? FIS_Index_CreateWorkspace(index, &arena) : NULL;
+    FIS_Workspace* ws = (fis != NULL) ? FIS_Workspace_Create(fis, &arena) : NULL;
+    if (index_ws == NULL || ws == NULL)
+    {
+        printf("  %d inputs x %d MFs: arena exhausted\n", num_inputs, num_mfs);
+        free(scratch_memory);
+        free(memory);
+        free(inputs);
+        return;
+    }
+
+    for (int s = 0; s < SAMPLES * num_inputs; ++s)
+        inputs[s] = 2.0f * rand() / RAND_MAX - 1.0f;
+
+    volatile float sink = 0.0f;
+    double t0 = bench_wall_seconds();
+    for (int s = 0; s < SAMPLES; ++s)
+        sink += FIS_EvaluateReentrant(fis, &inputs[s * num_inputs], ws);
+    const double t_rules = bench_wall_seconds() - t0;
+
+    long evaluated = 0;
+    t0 = bench_wall_seconds();
+    for (int s = 0; s < SAMPLES; ++s)
+    {
+        sink += FIS_Index_Evaluate(index, &inputs[s * num_inputs], index_ws);
+        evaluated += index_ws->num_evaluated;
+    }
+    const double t_index = bench_wall_seconds() - t0;
+    (void)sink;
+
+    printf("  %d inputs x %2d MFs, %6d rules: rule by rule %9.1f ns, index %7.1f ns (%.1f rules evaluated), speedup %.1fx\n",
+           num_inputs, num_mfs, fis->num_rules, 1e9 * t_rules / SAMPLES, 1e9 * t_index / SAMPLES,
+           (double)evaluated / SAMPLES, t_rules / t_index);
+
+    free(scratch_memory);
+    free(memory);
+    free(inputs);
+}
+
+/**
+ * @brief Complete AND_PRODUCT grid: rule by rule vs inverted index vs tensor plan
+ *        (FIS_Plan_Evaluate() contracts the consequent tensor).
+ */
+static void bench_tensor(int num_inputs, int num_mfs)
+{
+    enum { SAMPLES = 20000, SCRATCH = 32 << 20, MEMORY = 32 << 20 };
+    FIS_Arena scratch, arena;
+    void* scratch_memory = malloc(SCRATCH);
+    void* memory = malloc(MEMORY);
+    float* inputs = malloc(sizeof(float) * SAMPLES * num_inputs);
+    FIS_Arena_Init(&scratch, scratch_memory, SCRATCH);
+    FIS_Arena_Init(&arena, memory, MEMORY);
+
+    FIS_System* fis = build_grid_fis(num_inputs, num_mfs, FIS_AND_PRODUCT, 0, &scratch, &arena);
+    const FIS_Plan* plan = (fis != NULL) ? FIS_Compile(fis, &arena) : NULL;
+    FIS_PlanWorkspace* plan_ws = (plan != NULL) ? FIS_Plan_CreateWorkspace(plan, &arena) : NULL;
+    const FIS_RuleIndex* index = (fis != NULL) ? FIS_Index_Create(fis, &arena) : NULL;
+    FIS_IndexWorkspace* index_ws = (index != NULL) ? FIS_Index_CreateWorkspace(index, &arena) : NULL;
+    FIS_Workspace* ws = (fis != NULL) ? FIS_Workspace_Create(fis, &arena) : NULL;
+    if (plan_ws == NULL || index_ws == NULL || ws == NULL)
+    {
+        printf("  %d inputs x %d MFs: arena exhausted\n", num_inputs, num_mfs);
+        free(scratch_memory);
+        free(memory);
+        free(inputs);
+        return;
+    }
+
+    for (int s = 0; s < SAMPLES * num_inputs; ++s)
+        inputs[s] = 2.0f * rand() / RAND_MAX - 1.0f;
+
+    // Rule by rule costs O(rules): fewer samples for the largest grids
+    int rule_samples = (int)(2000000L / fis->num_rules);
+    rule_samples = (rule_samples > SAMPLES) ? SAMPLES : (rule_samples < 100) ? 100 : rule_samples;
+
+    volatile float sink = 0.0f;
+    double t0 = bench_wall_seconds();
+    for (int s = 0; s < rule_samples; ++s)
+        sink += FIS_EvaluateReentrant(fis, &inputs[s * num_inputs], ws);
+    const double t_rules = (bench_wall_seconds() - t0) / rule_samples;
+
+    t0 = bench_wall_seconds();
+    for (int s = 0; s < SAMPLES; ++s)
+        sink += FIS_Index_Evaluate(index, &inputs[s * num_inputs], index_ws);
+    const double t_index = (bench_wall_seconds() - t0) / SAMPLES;
+
+    t0 = bench_wall_seconds();
+    for (int s = 0; s < SAMPLES; ++s)
+        sink += FIS_Plan_Evaluate(plan, &inputs[s * num_inputs], plan_ws);
+    const double t_tensor = (bench_wall_seconds() - t0) / SAMPLES;
+    (void)sink;
+
+    printf("  %d inputs x %d MFs, %6d rules: rule by rule %9.1f ns, index %7.1f ns, tensor plan %6.1f ns (%s), "
+           "speedup %.1fx / %.1fx\n",
+           num_inputs, num_mfs, fis->num_rules, 1e9 * t_rules, 1e9 * t_index, 1e9 * t_tensor,
+           (plan->flags & FIS_PLAN_FLAG_TENSOR) ? "tensor" : "generic", t_rules / t_tensor, t_index / t_tensor);
+
+    free(scratch_memory);
+    free(memory);
+    free(inputs);
+}
+
+/**
+ * @brief Fuzzification by segment search vs evaluation of all MFs: 2 inputs x num_mfs
+ *        AND_PRODUCT grid (tensor plan, so fuzzification dominates), random and
+ *        time-series inputs. The dense plan is a copy with the breakpoints removed.
+ */
+static void bench_segments(int num_mfs)
+{
+    enum { SAMPLES = 20000, REPEAT = 10, SCRATCH = 4 << 20, MEMORY = 4 << 20 };
+    FIS_Arena scratch, arena;
+    void* scratch_memory = malloc(SCRATCH);
+    void* memory = malloc(MEMORY);
+    float* inputs = malloc(sizeof(float) * SAMPLES * 2 * 2);
+    FIS_Arena_Init(&scratch, scratch_memory, SCRATCH);
+    FIS_Arena_Init(&arena, memory, MEMORY);
+
+    FIS_System* fis = build_grid_fis(2, num_mfs, FIS_AND_PRODUCT, 0, &scratch, &arena);
+    const FIS_Plan* plan = (fis != NULL) ? FIS_Compile(fis, &arena) : NULL;
+    FIS_Plan* dense = (plan != NULL) ? FIS_Arena_Alloc(&arena, plan->size, FIS_PLAN_ALIGN) : NULL;
+    FIS_PlanWorkspace* ws = (plan != NULL) ? FIS_Plan_CreateWorkspace(plan, &arena) : NULL;
+    if (dense == NULL || ws == NULL)
+    {
+        printf("  %2d MFs: arena exhausted\n", num_mfs);
+        free(scratch_memory);
+        free(memory);
+        free(inputs);
+        return;
+    }
+
+    memcpy(dense, plan, plan->size);
+    FIS_PlanInput* dense_inputs = (FIS_PlanInput*)FIS_PLAN_INPUTS(dense);
+    dense_inputs[0].num_breakpoints = dense_inputs[1].num_breakpoints = 0;
+
+    // Random samples, then a slowly varying trajectory
+    for (int s = 0; s < SAMPLES * 2; ++s)
+        inputs[s] = 2.0f * rand() / RAND_MAX - 1.0f;
+    for (int s = 0; s < SAMPLES; ++s)
+    {
+        inputs[SAMPLES * 2 + 2 * s] = sinf(0.001f * s);
+        inputs[SAMPLES * 2 + 2 * s + 1] = cosf(0.0013f * s);
+    }
+
+    double t[2][2];
+    volatile float sink = 0.0f;
+    for (int series = 0; series < 2; ++series)
+    {
+        const float* x = &inputs[series * SAMPLES * 2];
+        for (int variant = 0; variant < 2; ++variant)
+        {
+            const FIS_Plan* p = (variant == 0) ? dense : plan;
+            double t0 = bench_wall_seconds();
+            for (int k = 0; k < REPEAT; ++k)
+                for (int s = 0; s < SAMPLES; ++s)
+                    sink += FIS_Plan_Evaluate(p, &x[2 * s], ws);
+            t[series][variant] = (bench_wall_seconds() - t0) / (REPEAT * SAMPLES);
+        }
+    }
+    (void)sink;
+
+    printf("  %2d MFs (%s): random: all MFs %6.1f ns, segment search %6.1f ns (%.2fx); "
+           "time series: all MFs %6.1f ns, segment search %6.1f ns (%.2fx)\n",
+           num_mfs, (FIS_PLAN_INPUTS(plan)[0].num_breakpoints > 0) ? "searched" : "dense",
+           1e9 * t[0][0], 1e9 * t[0][1], t[0][0] / t[0][1], 1e9 * t[1][0], 1e9 * t[1][1], t[1][0] / t[1][1]);
+
+    free(scratch_memory);
+    free(memory);
+    free(inputs);
+}
+
+/**
+ * @brief Partition-of-unity plans: normalized evaluation (flag cleared on a copy of
+ *        the plan) vs the division-free path, on the 2000-sample test vectors.
+ */
+static void bench_partition(const char* name, FIS_System* fis, const float* test_inputs, int num_inputs)
+{
+    enum { SAMPLES = 2000, REPEAT = 1000 };
+    static unsigned char memory[16384];
+    static float outputs[2][SAMPLES];
+    FIS_Arena arena;
+    FIS_Arena_Init(&arena, memory, sizeof(memory));
+
+    const FIS_Plan* plan = FIS_Compile(fis, &arena);
+    FIS_Plan* normalized = (plan != NULL) ? FIS_Arena_Alloc(&arena, plan->size, FIS_PLAN_ALIGN) : NULL;
+    FIS_PlanWorkspace* ws = (plan != NULL) ? FIS_Plan_CreateWorkspace(plan, &arena) : NULL;
+    if (normalized == NULL || ws == NULL || !(plan->flags & FIS_PLAN_FLAG_PARTITION))
+    {
+        printf("  %-28s not a partition of unity\n", name);
+        return;
+    }
+
+    memcpy(normalized, plan, plan->size);
+    normalized->flags &= ~FIS_PLAN_FLAG_PARTITION;
+
+    double t[2];
+    for (int variant = 0; variant < 2; ++variant)
+    {
+        const FIS_Plan* p = (variant == 0) ? normalized : plan;
+        double t0 = bench_wall_seconds();
+        for (int k = 0; k < REPEAT; ++k)
+            for (int s = 0; s < SAMPLES; ++s)
+                outputs[variant][s] = FIS_Plan_Evaluate(p, &test_inputs[s * num_inputs], ws);
+        t[variant] = (bench_wall_seconds() - t0) / ((double)REPEAT * SAMPLES);
+    }
+
+    printf("  %-28s normalized %6.1f ns, division-free %6.1f ns (%.2fx), max deviation %g\n", name,
+           1e9 * t[0], 1e9 * t[1], t[0] / t[1], bench_max_deviation(outputs[0], outputs[1], SAMPLES));
+}
+
+/**
+ * @brief Replays a trace with the antecedent inputs sampled and held for `hold`
+ *        samples (hold 1: trace as recorded) through FIS_Plan_Evaluate() and an
+ *        incremental evaluator; prints the times and hit rates.
+ */
+static void bench_incremental(const char* name, FIS_System* fis, float* test_inputs, int num_inputs, int hold)
+{
+    enum { SAMPLES = 2000, REPEAT = 1000 };
+    static unsigned char memory[65536];
+    static float trace[SAMPLES * 8];
+    static float outputs[2][SAMPLES];
+    FIS_Arena arena;
+    FIS_Arena_Init(&arena, memory, sizeof(memory));
+
+    const FIS_Plan* plan = FIS_Compile(fis, &arena);
+    FIS_PlanWorkspace* ws = (plan != NULL) ? FIS_Plan_CreateWorkspace(plan, &arena) : NULL;
+    FIS_Incremental* inc = (plan != NULL) ? FIS_Incremental_Create(plan, &arena) : NULL;
+    if (ws == NULL || inc == NULL)
+        return;
+
+    for (int s = 0; s < SAMPLES; ++s)
+        for (int i = 0; i < num_inputs; ++i)
+        {
+            const int held = (inc->input_role[i] & FIS_INCREMENTAL_ANTECEDENT) ? s - s % hold : s;
+            trace[s * num_inputs + i] = test_inputs[held * num_inputs + i];
+        }
+
+    double t0 = bench_wall_seconds();
+    for (int k = 0; k < REPEAT; ++k)
+        for (int s = 0; s < SAMPLES; ++s)
+            outputs[0][s] = FIS_Plan_Evaluate(plan, &trace[s * num_inputs], ws);
+    const double t_plan = (bench_wall_seconds() - t0) / ((double)REPEAT * SAMPLES);
+
+    FIS_Incremental_ResetStats(inc);
+    t0 = bench_wall_seconds();
+    for (int k = 0; k < REPEAT; ++k)
+        for (int s = 0; s < SAMPLES; ++s)
+            outputs[1][s] = FIS_Incremental_Evaluate(inc, &trace[s * num_inputs]);
+    const double t_inc = (bench_wall_seconds() - t0) / ((double)REPEAT * SAMPLES);
+
+    const FIS_IncrementalStats* stats = &inc->stats;
+    printf("  %-18s hold %3d: plan %6.1f ns, incremental %6.1f ns (%.2fx), input hits %5.1f%%, weight hits %5.1f%%, max deviation %g\n",
+           name, hold, 1e9 * t_plan, 1e9 * t_inc, t_plan / t_inc, 100.0 * stats->input_hits / stats->input_checks,
+           100.0 * stats->weight_hits / stats->evaluations, bench_max_deviation(outputs[0], outputs[1], SAMPLES));
+}
+
+/**
+ * @brief Replays a trace through FIS_Plan_Evaluate() and an event-triggered evaluator
+ *        (trace range as box, tolerance relative to the output range); prints the
+ *        times, the share of skipped evaluations and the largest error.
+ */
+static void bench_event(const char* name, FIS_System* fis, float* test_inputs, int num_inputs, float relative_tolerance)
+{
+    enum { SAMPLES = 2000, REPEAT = 1000 };
+    static unsigned char memory[65536];
+    static float outputs[2][SAMPLES];
+    float lower[16], upper[16];
+    FIS_Arena arena;
+    FIS_Arena_Init(&arena, memory, sizeof(memory));
+
+    const FIS_Plan* plan = FIS_Compile(fis, &arena);
+    FIS_PlanWorkspace* ws = (plan != NULL) ? FIS_Plan_CreateWorkspace(plan, &arena) : NULL;
+    if (ws == NULL)
+        return;
+
+    for (int i = 0; i < num_inputs; ++i)
+    {
+        lower[i] = upper[i] = test_inputs[i];
+        for (int s = 1; s < SAMPLES; ++s)
+        {
+            lower[i] = fminf(lower[i], test_inputs[s * num_inputs + i]);
+            upper[i] = fmaxf(upper[i], test_inputs[s * num_inputs + i]);
+        }
+    }
+
+    double t0 = bench_wall_seconds();
+    for (int k = 0; k < REPEAT; ++k)
+        for (int s = 0; s < SAMPLES; ++s)
+            outputs[0][s] = FIS_Plan_Evaluate(plan, &test_inputs[s * num_inputs], ws);
+    const double t_plan = (bench_wall_seconds() - t0) / ((double)REPEAT * SAMPLES);
+
+    float output_min = outputs[0][0], output_max = outputs[0][0];
+    for (int s = 1; s < SAMPLES; ++s)
+    {
+        output_min = fminf(output_min, outputs[0][s]);
+        output_max = fmaxf(output_max, outputs[0][s]);
+    }
+
+    FIS_EventTrigger* trigger = FIS_Event_Create(plan, lower, upper, relative_tolerance * (output_max - output_min), &arena);
+    if (trigger == NULL)
+    {
+        printf("  %-18s Lipschitz bounds not available\n", name);
+        return;
+    }
+
+    t0 = bench_wall_seconds();
+    for (int k = 0; k < REPEAT; ++k)
+    {
+        FIS_Event_Invalidate(trigger);
+        for (int s = 0; s < SAMPLES; ++s)
+            outputs[1][s] = FIS_Event_Evaluate(trigger, &test_inputs[s * num_inputs]);
+    }
+    const double t_event = (bench_wall_seconds() - t0) / ((double)REPEAT * SAMPLES);
+
+    printf("  %-18s tolerance %4.1f%%: plan %6.1f ns, event-triggered %6.1f ns (%.2fx), skipped %5.1f%%, max error %g\n",
+           name, 100.0f * relative_tolerance, 1e9 * t_plan, 1e9 * t_event, t_plan / t_event,
+           100.0 * trigger->skipped / trigger->evaluations, bench_max_deviation(outputs[0], outputs[1], SAMPLES));
+}
+
+/**
+ * @brief Cost of K outputs of a trace: K x FIS_Plan_Evaluate() (one plan per output)
+ *        vs one FIS_Mimo_Evaluate() with shared fuzzification and rule weights.
+ */
+static void bench_mimo(const char* name, FIS_System* fis, float* test_inputs, int num_inputs, int num_outputs)
+{
+    enum { SAMPLES = 2000, REPEAT = 200 };
+    static unsigned char memory[1 << 20];
+    static FIS_System storage[16];
+    static float outputs[2][SAMPLES][16];
+    const FIS_System* systems[16];
+    const FIS_Plan* plans[16];
+    FIS_PlanWorkspace* plan_ws[16];
+    FIS_Arena arena;
+    FIS_Arena_Init(&arena, memory, sizeof(memory));
+
+    build_output_variants(fis, num_outputs, systems, storage, &arena);
+    for (int k = 0; k < num_outputs; ++k)
+    {
+        plans[k] = FIS_Compile(systems[k], &arena);
+        plan_ws[k] = (plans[k] != NULL) ? FIS_Plan_CreateWorkspace(plans[k], &arena) : NULL;
+        if (plan_ws[k] == NULL)
+            return;
+    }
+    const FIS_MimoPlan* mimo = FIS_Mimo_Compile(systems, num_outputs, &arena);
+    FIS_MimoWorkspace* ws = (mimo != NULL) ? FIS_Mimo_CreateWorkspace(mimo, &arena) : NULL;
+    if (ws == NULL)
+        return;
+
+    double t0 = bench_wall_seconds();
+    for (int n = 0; n < REPEAT; ++n)
+        for (int s = 0; s < SAMPLES; ++s)
+            for (int k = 0; k < num_outputs; ++k)
+                outputs[0][s][k] = FIS_Plan_Evaluate(plans[k], &test_inputs[s * num_inputs], plan_ws[k]);
+    const double t_plans = (bench_wall_seconds() - t0) / ((double)REPEAT * SAMPLES);
+
+    t0 = bench_wall_seconds();
+    for (int n = 0; n < REPEAT; ++n)
+        for (int s = 0; s < SAMPLES; ++s)
+            FIS_Mimo_Evaluate(mimo, &test_inputs[s * num_inputs], outputs[1][s], ws);
+    const double t_mimo = (bench_wall_seconds() - t0) / ((double)REPEAT * SAMPLES);
+
+    float max_deviation = 0.0f;
+    for (int s = 0; s < SAMPLES; ++s)
+        max_deviation = fmaxf(max_deviation, bench_max_deviation(outputs[0][s], outputs[1][s], num_outputs));
+
+    printf("  %-18s %2d outputs: %2d x plan %7.1f ns, MIMO %7.1f ns (%.2fx, %5.1f ns per output), max deviation %g\n",
+           name, num_outputs, num_outputs, 1e9 * t_plans, 1e9 * t_mimo, t_plans / t_mimo, 1e9 * t_mimo / num_outputs, max_deviation);
+}
+
+/**
+ * @brief Cost of M systems on the same trace: M x FIS_Plan_Evaluate() vs one
+ *        FIS_Group_Evaluate() with the shared MFs fuzzified once, against a single
+ *        member alone.
+ */
+static void bench_group(const char* name, FIS_System* fis, float* test_inputs, int num_inputs, int num_systems)
+{
+    enum { SAMPLES = 2000, REPEAT = 200 };
+    static unsigned char memory[1 << 20];
+    static FIS_System storage[16];
+    static float outputs[2][SAMPLES][16];
+    const FIS_System* systems[16];
+    const FIS_Plan* plans[16];
+    FIS_PlanWorkspace* plan_ws[16];
+    FIS_Arena arena;
+    FIS_Arena_Init(&arena, memory, sizeof(memory));
+
+    build_output_variants(fis, num_systems, systems, storage, &arena);
+    for (int k = 0; k < num_systems; ++k)
+    {
+        plans[k] = FIS_Compile(systems[k], &arena);
+        plan_ws[k] = (plans[k] != NULL) ? FIS_Plan_CreateWorkspace(plans[k], &arena) : NULL;
+        if (plan_ws[k] == NULL)
+            return;
+    }
+    const FIS_Group* group = FIS_Group_Compile(systems, num_systems, &arena);
+    FIS_GroupWorkspace* ws = (group != NULL) ? FIS_Group_CreateWorkspace(group, &arena) : NULL;
+    if (ws == NULL)
+        return;
+
+    double t0 = bench_wall_seconds();
+    for (int n = 0; n < REPEAT; ++n)
+        for (int s = 0; s < SAMPLES; ++s)
+            outputs[0][s][0] = FIS_Plan_Evaluate(plans[0], &test_inputs[s * num_inputs], plan_ws[0]);
+    const double t_single = (bench_wall_seconds() - t0) / ((double)REPEAT * SAMPLES);
+
+    t0 = bench_wall_seconds();
+    for (int n = 0; n < REPEAT; ++n)
+        for (int s = 0; s < SAMPLES; ++s)
+            for (int k = 0; k < num_systems; ++k)
+                outputs[0][s][k] = FIS_Plan_Evaluate(plans[k], &test_inputs[s * num_inputs], plan_ws[k]);
+    const double t_plans = (bench_wall_seconds() - t0) / ((double)REPEAT * SAMPLES);
+
+    t0 = bench_wall_seconds();
+    for (int n = 0; n < REPEAT; ++n)
+        for (int s = 0; s < SAMPLES; ++s)
+            FIS_Group_Evaluate(group, &test_inputs[s * num_inputs], outputs[1][s], ws);
+    const double t_group = (bench_wall_seconds() - t0) / ((double)REPEAT * SAMPLES);
+
+    float max_deviation = 0.0f;
+    for (int s = 0; s < SAMPLES; ++s)
+        max_deviation = fmaxf(max_deviation, bench_max_deviation(outputs[0][s], outputs[1][s], num_systems));
+
+    printf("  %-18s %2d members (%d/%d MFs): single %6.1f ns, %2d x plan %7.1f ns, group %7.1f ns (%.2fx), max deviation %g\n",
+           name, num_systems, (int)group->num_unique, (int)group->num_degrees, 1e9 * t_single, num_systems,
+           1e9 * t_plans, 1e9 * t_group, t_plans / t_group, max_deviation);
+}
+
+/**
+ * @brief Generated rule base: every MF declared twice and the linear consequents of
+ *        the rules copied from a pool of `num_distinct` coefficient vectors. With
+ *        `perturbed`, copies differ in the last bits (nothing can be shared).
+ */
+static void build_repetitive_fis(FIS_System* fis, int num_rules, int num_distinct, int perturbed, FIS_Arena* arena)
+{
+    enum { INPUTS = 4, MFS = 5 };
+    const int num_coefficients = INPUTS + 1;
+
+    fis->num_inputs = INPUTS;
+    fis->num_rules = num_rules;
+    fis->num_mfs_per_input = FIS_Arena_Alloc(arena, sizeof(int) * INPUTS, FIS_ARENA_ALIGN);
+    fis->input_mfs = FIS_Arena_Alloc(arena, sizeof(FIS_MembershipFunction**) * INPUTS, FIS_ARENA_ALIGN);
+    for (int i = 0; i < INPUTS; ++i)
+    {
+        FIS_MembershipFunction** row = FIS_Arena_Alloc(arena, sizeof(FIS_MembershipFunction*) * 2 * MFS, FIS_ARENA_ALIGN);
+        FIS_MembershipFunction* mfs = FIS_Arena_Alloc(arena, sizeof(FIS_MembershipFunction) * 2 * MFS, FIS_ARENA_ALIGN);
+        FIS_MF_TriangularParams* params = FIS_Arena_Alloc(arena, sizeof(FIS_MF_TriangularParams) * 2 * MFS, FIS_ARENA_ALIGN);
+        for (int m = 0; m < 2 * MFS; ++m)
+        {
+            const float b = -1.0f + 0.5f * (m % MFS) + ((perturbed && m >= MFS) ? 1e-6f : 0.0f);
+            params[m] = (FIS_MF_TriangularParams){ .a = b - 0.5f, .b = b, .c = b + 0.5f };
+            mfs[m] = (FIS_MembershipFunction){ .eval = FIS_MF_TriangularEval, .params = &params[m] };
+            row[m] = &mfs[m];
+        }
+        fis->num_mfs_per_input[i] = 2 * MFS;
+        fis->input_mfs[i] = row;
+    }
+
+    srand(25);
+    fis->rules = FIS_Arena_Alloc(arena, sizeof(FIS_Rule) * num_rules, FIS_ARENA_ALIGN);
+    int* indices = FIS_Arena_Alloc(arena, sizeof(int) * num_rules * INPUTS, FIS_ARENA_ALIGN);
+    float* coefficients = FIS_Arena_Alloc(arena, sizeof(float) * num_rules * num_coefficients, FIS_ARENA_ALIGN);
+    for (int r = 0; r < num_rules; ++r)
+    {
+        const int pool = rand() % num_distinct;
+        for (int i = 0; i < INPUTS; ++i)
+            indices[r * INPUTS + i] = (rand() % 4 == 0) ? -1 : rand() % (2 * MFS);
+        for (int j = 0; j < num_coefficients; ++j)
+            coefficients[r * num_coefficients + j] = 0.01f * (float)((pool * 37 + j * 11) % 101) - 0.5f;
+        if (perturbed)
+            coefficients[r * num_coefficients + INPUTS] += 1e-6f * r;
+
+        fis->rules[r] = (FIS_Rule){ .mf_indices = &indices[r * INPUTS], .consequent = NULL,
+                                    .logic_type = FIS_AND_PRODUCT, .coefficients = &coefficients[r * num_coefficients] };
+    }
+}
+
+/**
+ * @brief Cost of a generated rule base with repeated consequents and MFs: plan with
+ *        the repeats shared vs the same rule base perturbed so nothing is shared.
+ */
+static void bench_sharing(int num_rules, int num_distinct)
+{
+    enum { SAMPLES = 1000, REPEAT = 100 };
+    static unsigned char memory[1 << 20];
+    static float inputs[SAMPLES * 4];
+    FIS_System fis[2];
+    const FIS_Plan* plans[2];
+    FIS_PlanWorkspace* ws[2];
+    double t[2];
+    FIS_PlanSharing sharing;
+    FIS_Arena arena;
+    FIS_Arena_Init(&arena, memory, sizeof(memory));
+
+    for (int k = 0; k < 2; ++k)
+    {
+        build_repetitive_fis(&fis[k], num_rules, num_distinct, k, &arena);
+        plans[k] = FIS_Compile(&fis[k], &arena);
+        ws[k] = (plans[k] != NULL) ? FIS_Plan_CreateWorkspace(plans[k], &arena) : NULL;
+        if (ws[k] == NULL)
+            return;
+    }
+    for (int s = 0; s < SAMPLES * 4; ++s)
+        inputs[s] = 2.4f * rand() / RAND_MAX - 1.2f;
+
+    volatile float sink = 0.0f;
+    for (int k = 0; k < 2; ++k)
+    {
+        const double t0 = bench_wall_seconds();
+        for (int n = 0; n < REPEAT; ++n)
+            for (int s = 0; s < SAMPLES; ++s)
+                sink += FIS_Plan_Evaluate(plans[k], &inputs[s * 4], ws[k]);
+        t[k] = (bench_wall_seconds() - t0) / ((double)REPEAT * SAMPLES);
+    }
+    (void)sink;
+
+    FIS_Plan_GetSharing(plans[0], &sharing);
+    printf("  %4d rules, %3d distinct consequents: consequents %d -> %d, MFs %d -> %d, not shared %7.1f ns, shared %7.1f ns (%.2fx)\n",
+           num_rules, num_distinct, (int)sharing.num_rule_consequents, (int)sharing.num_consequents,
+           (int)sharing.num_mfs, (int)sharing.num_distinct_mfs, 1e9 * t[1], 1e9 * t[0], t[1] / t[0]);
+}
+
+/**
+ * @brief Time to a ready-to-evaluate plan: '.fis' file parsed and compiled vs binary
+ *        image mapped and checked in place.
+ */
+static void bench_image(const char* path)
+{
+    enum { LOADS = 1000 };
+    static unsigned char memory[8192];
+    const char* image_path = "sugeno_bench.fisimg";
+    FIS_ImageMapping mapping;
+    FIS_Arena arena;
+    FIS_Arena_Init(&arena, memory, sizeof(memory));
+
+    int ready = 0;
+    double t0 = bench_wall_seconds();
+    for (int k = 0; k < LOADS; ++k)
+    {
+        FIS_Arena_Reset(&arena);
+        FIS_System* fis = FIS_LoadFile(path, &arena, NULL);
+        ready += (fis != NULL && FIS_Compile(fis, &arena) != NULL);
+    }
+    const double t_parse = bench_wall_seconds() - t0;
+
+    const FIS_Plan* plan = (ready == LOADS) ? FIS_Compile(FIS_LoadFile(path, &arena, NULL), &arena) : NULL;
+    if (plan == NULL || !FIS_Image_Save(plan, image_path))
+        return;
+
+    ready = 0;
+    t0 = bench_wall_seconds();
+    for (int k = 0; k < LOADS; ++k)
+    {
+        ready += (FIS_Image_Map(image_path, &mapping) != NULL);
+        FIS_Image_Unmap(&mapping);
+    }
+    const double t_map = bench_wall_seconds() - t0;
+    remove(image_path);
+
+    printf("  %-28s %.2f us (.fis + FIS_Compile), %.2f us (image map, %d of %d)\n", path,
+           1e6 * t_parse / LOADS, 1e6 * t_map / LOADS, ready, LOADS);
+}
+
+static void bench_skipped_consequents(BenchCase* bc)
+{
+    long skipped = 0;
+    long total = 0;
+
+    for (int s = 0; s < BENCH_SAMPLES; ++s)
+    {
+        FIS_EvaluateReentrant(bc->fis, &bc->rows[s * bc->num_inputs], bc->ws);
+        for (int r = 0; r < bc->fis->num_rules; ++r)
+            skipped += (bc->ws->rule_output[r].weight == 0.0f);
+        total += bc->fis->num_rules;
+    }
+    printf("  %-28s %ld / %ld (%.1f%%)\n", "consequents skipped", skipped, total, 100.0 * skipped / total);
+}
+
+static void bench_simd_levels(BenchCase* bc, int scheduling_input)
+{
+    static const char* level_names[] = { "scalar", "SSE2", "AVX2", "AVX-512" };
+    FIS_SIMD_Level best = FIS_SIMD_GetLevel();
+    char name[64];
+
+    for (int level = FIS_SIMD_SCALAR; level <= (int)best; ++level)
+    {
+        FIS_SIMD_SetLevel((FIS_SIMD_Level)level);
+
+        double t0 = bench_seconds();
+        for (int k = 0; k < BENCH_REPEAT; ++k)
+            for (int m = 0; m < bc->fis->num_mfs_per_input[scheduling_input]; ++m)
+                FIS_MF_EvalArray(bc->fis->input_mfs[scheduling_input][m], bc->column_ptrs[scheduling_input], bc->outputs, BENCH_SAMPLES);
+        snprintf(name, sizeof(name), "MF kernels (%s)", level_names[level]);
+        bench_report(name, bench_seconds() - t0);
+
+        t0 = bench_seconds();
+        for (int k = 0; k < BENCH_REPEAT; ++k)
+            FIS_EvaluateBatch(bc->fis, bc->column_ptrs, bc->outputs, BENCH_SAMPLES);
+        snprintf(name, sizeof(name), "FIS_EvaluateBatch (%s)", level_names[level]);
+        bench_report(name, bench_seconds() - t0);
+    }
+    FIS_SIMD_SetLevel(best);
+}
+
+int main(void)
+{
+    FIS_System* inv_pendulum_ctrl_fis;
+    FIS_System* pmsm_speed_ctrl_fis;
+    FIS_InvertedPendulumController_InitLinear(&inv_pendulum_ctrl_fis);
+    FIS_PMSM_SpeedController_InitLinear(&pmsm_speed_ctrl_fis);
+
+    BenchCase cases[2];
+    bench_case_init(&cases[0], "Test #1 - Inverted pendulum controller", inv_pendulum_ctrl_fis, &test1_inputs[0][0], 2000);
+    bench_case_init(&cases[1], "Test #2 - PMSM speed controller", pmsm_speed_ctrl_fis, &test2_inputs[0][0], 2000);
+    cases[0].generated = FIS_InvertedPendulumController_Evaluate;
+    cases[1].generated = FIS_PMSM_SpeedController_Evaluate;
+
+    puts("FIS_Load (MATLAB .fis)");
+    bench_load("inverted_pendulum_controller.fis");
+    bench_load("pmsm_speed_controller.fis");
+    puts("Builder API (FIS_Builder_Finalize)");
+    bench_builder("inverted pendulum", inv_pendulum_ctrl_fis);
+    bench_builder("PMSM speed", pmsm_speed_ctrl_fis);
+    puts("Binary image (FIS_Image_Map)");
+    bench_image("inverted_pendulum_controller.fis");
+    bench_image("pmsm_speed_controller.fis");
+
+    puts("Partition of unity (division-free path)");
+    bench_partition("inverted pendulum", inv_pendulum_ctrl_fis, &test1_inputs[0][0], 6);
+    bench_partition("PMSM speed", pmsm_speed_ctrl_fis, &test2_inputs[0][0], 5);
+    FIS_MF_TriangularParams narrow_static = { .a = -0.2f, .b = 0.0f, .c = 0.2f };
+    FIS_MembershipFunction narrow_static_mf = { FIS_MF_TriangularEval, &narrow_static };
+    FIS_MembershipFunction* ruspini_mfs[] = { pmsm_speed_ctrl_fis->input_mfs[3][0], &narrow_static_mf, pmsm_speed_ctrl_fis->input_mfs[3][2] };
+    FIS_MembershipFunction** ruspini_input_mfs[5];
+    memcpy(ruspini_input_mfs, pmsm_speed_ctrl_fis->input_mfs, sizeof(ruspini_input_mfs));
+    ruspini_input_mfs[3] = ruspini_mfs;
+    FIS_System ruspini_pmsm = *pmsm_speed_ctrl_fis;
+    ruspini_pmsm.input_mfs = ruspini_input_mfs;
+    bench_partition("PMSM speed, Ruspini 'static'", &ruspini_pmsm, &test2_inputs[0][0], 5);
+
+    puts("Incremental evaluation (antecedent inputs sampled and held)");
+    for (int hold = 1; hold <= 100; hold *= 10)
+        bench_incremental("inverted pendulum", inv_pendulum_ctrl_fis, &test1_inputs[0][0], 6, hold);
+    for (int hold = 1; hold <= 100; hold *= 10)
+        bench_incremental("PMSM speed", pmsm_speed_ctrl_fis, &test2_inputs[0][0], 5, hold);
+
+    puts("Event-triggered evaluation (Lipschitz bounds over the trace range)");
+    bench_event("inverted pendulum", inv_pendulum_ctrl_fis, &test1_inputs[0][0], 6, 0.01f);
+    bench_event("inverted pendulum", inv_pendulum_ctrl_fis, &test1_inputs[0][0], 6, 0.05f);
+    bench_event("PMSM speed", pmsm_speed_ctrl_fis, &test2_inputs[0][0], 5, 0.01f);
+    bench_event("PMSM speed", pmsm_speed_ctrl_fis, &test2_inputs[0][0], 5, 0.05f);
+
+    puts("Multi-output systems (shared fuzzification and rule weights)");
+    for (int num_outputs = 1; num_outputs <= 16; num_outputs *= 2)
+        bench_mimo("inverted pendulum", inv_pendulum_ctrl_fis, &test1_inputs[0][0], 6, num_outputs);
+    for (int num_outputs = 1; num_outputs <= 16; num_outputs *= 2)
+        bench_mimo("PMSM speed", pmsm_speed_ctrl_fis, &test2_inputs[0][0], 5, num_outputs);
+
+    puts("FIS groups (members on the same inputs, shared MFs fuzzified once)");
+    for (int num_systems = 1; num_systems <= 16; num_systems *= 2)
+        bench_group("inverted pendulum", inv_pendulum_ctrl_fis, &test1_inputs[0][0], 6, num_systems);
+    for (int num_systems = 1; num_systems <= 16; num_systems *= 2)
+        bench_group("PMSM speed", pmsm_speed_ctrl_fis, &test2_inputs[0][0], 5, num_systems);
+
+    puts("Consequent and MF sharing (generated rule bases, 4 inputs, every MF declared twice)");
+    bench_sharing(100, 8);
+    bench_sharing(400, 16);
+    bench_sharing(400, 64);
+
+    puts("Inverted rule index (complete grids, AND_PRODUCT)");
+    bench_index(3, 10);
+    bench_index(4, 10);
+    bench_index(5, 10);
+    puts("Tensor-product plans (complete grids, AND_PRODUCT)");
+    bench_tensor(4, 5);
+    bench_tensor(4, 7);
+    bench_tensor(5, 5);
+    bench_tensor(5, 7);
+    bench_tensor(6, 5);
+    bench_tensor(6, 7);
+    puts("Segment search fuzzification (2 inputs, complete grid)");
+    bench_segments(3);
+    bench_segments(4);
+    bench_segments(6);
+    bench_segments(8);
+    bench_segments(16);
+    bench_segments(32);
+    bench_segments(64);
+
+    for (int c = 0; c < 2; ++c)
+    {
+        printf("%s (%d samples x %d)\n", cases[c].name, BENCH_SAMPLES, BENCH_REPEAT);
+        bench_evaluate(&cases[c]);
+        bench_evaluate_plan(&cases[c]);
+        bench_gain_blending(&cases[c]);
+        bench_lut(&cases[c]);
+        bench_fixed(&cases[c]);
+        bench_generated(&cases[c]);
+        bench_jit(&cases[c]);
+        bench_skipped_consequents(&cases[c]);
+        bench_evaluate_batch(&cases[c]);
+        bench_simd_levels(&cases[c], (c == 0) ? 5 : 3);
+        bench_case_free(&cases[c]);
+    }
+
+    return 0;
+}
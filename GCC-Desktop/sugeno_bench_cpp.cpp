@@ -0,0 +1,80 @@
+#include "fis_sugeno_config.h"
+#include "fis_sugeno_config.hpp"
+
+#include "test1_input_array.c"
+#include "test2_input_array.c"
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#define BENCH_SAMPLES   200001  // Length of the offline replay traces
+#define BENCH_REPEAT    10      // Passes over the trace per measurement
+
+static double bench_seconds()
+{
+    using clock = std::chrono::steady_clock;
+    return std::chrono::duration<double>(clock::now().time_since_epoch()).count();
+}
+
+static void bench_report(const char* name, double seconds)
+{
+    double rate = (double)BENCH_SAMPLES * BENCH_REPEAT / seconds;
+    std::printf("  %-28s %10.3f Msamples/s  (%.1f ns/sample)\n", name, rate * 1e-6, 1e9 / rate);
+}
+
+/**
+ * @brief FIS_Evaluate() vs the template FIS on a BENCH_SAMPLES long trace
+ *        (test vector set repeated); results are compared bit by bit.
+ */
+template <typename TemplateFIS>
+static void bench_case(const char* name, FIS_System* fis, const TemplateFIS& template_fis, const float* test_inputs, int test_count)
+{
+    const int num_inputs = fis->num_inputs;
+    std::vector<float> rows(BENCH_SAMPLES * num_inputs);
+    std::vector<float> reference(BENCH_SAMPLES);
+    std::vector<float> outputs(BENCH_SAMPLES);
+
+    for (int s = 0; s < BENCH_SAMPLES; ++s)
+        for (int i = 0; i < num_inputs; ++i)
+            rows[s * num_inputs + i] = test_inputs[(s % test_count) * num_inputs + i];
+
+    std::printf("%s (%d samples x %d)\n", name, BENCH_SAMPLES, BENCH_REPEAT);
+
+    double t0 = bench_seconds();
+    for (int k = 0; k < BENCH_REPEAT; ++k)
+        for (int s = 0; s < BENCH_SAMPLES; ++s)
+            reference[s] = FIS_Evaluate(fis, &rows[s * num_inputs]);
+    const double t_c = bench_seconds() - t0;
+    bench_report("FIS_Evaluate", t_c);
+
+    t0 = bench_seconds();
+    for (int k = 0; k < BENCH_REPEAT; ++k)
+        for (int s = 0; s < BENCH_SAMPLES; ++s)
+            outputs[s] = template_fis(&rows[s * num_inputs]);
+    const double t_template = bench_seconds() - t0;
+    bench_report("fis::System", t_template);
+
+    int mismatches = 0;
+    for (int s = 0; s < BENCH_SAMPLES; ++s)
+        mismatches += (std::memcmp(&reference[s], &outputs[s], sizeof(float)) != 0);
+
+    std::printf("  %-28s %.2fx\n", "speedup", t_c / t_template);
+    std::printf("  %-28s %d\n", "bit mismatches", mismatches);
+}
+
+int main()
+{
+    FIS_System* inv_pendulum_ctrl_fis;
+    FIS_System* pmsm_speed_ctrl_fis;
+    FIS_InvertedPendulumController_InitLinear(&inv_pendulum_ctrl_fis);
+    FIS_PMSM_SpeedController_InitLinear(&pmsm_speed_ctrl_fis);
+
+    bench_case("Test #1 - Inverted pendulum controller", inv_pendulum_ctrl_fis,
+               fis::config::inverted_pendulum_controller, &test1_inputs[0][0], 2000);
+    bench_case("Test #2 - PMSM speed controller", pmsm_speed_ctrl_fis,
+               fis::config::pmsm_speed_controller, &test2_inputs[0][0], 2000);
+
+    return 0;
+}
@@ -0,0 +1,68 @@
+#include "fis_sugeno_config.h"
+#include "fis_sugeno_codegen.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+/**
+ * @brief Host-side generator: emits the FIS definitions of 'fis_sugeno_config.c' as
+ *        specialized C functions (declared in 'fis_sugeno_generated.h').
+ *
+ *        Usage: sugeno_codegen [output.c]    (default: standard output)
+ */
+int main(int argc, char** argv)
+{
+    FIS_System* inv_pendulum_ctrl_fis;
+    FIS_System* pmsm_speed_ctrl_fis;
+    FIS_InvertedPendulumController_InitLinear(&inv_pendulum_ctrl_fis);
+    FIS_PMSM_SpeedController_InitLinear(&pmsm_speed_ctrl_fis);
+
+    const struct
+    {
+        FIS_System* fis;
+        const char* function_name;
+    } targets[] = {
+        { inv_pendulum_ctrl_fis, "FIS_InvertedPendulumController_Evaluate" },
+        { pmsm_speed_ctrl_fis, "FIS_PMSM_SpeedController_Evaluate" }
+    };
+
+    FILE* out = (argc > 1) ? fopen(argv[1], "w") : stdout;
+    if (out == NULL)
+    {
+        perror(argv[1]);
+        return 1;
+    }
+
+    fputs("/**\n"
+          "  ******************************************************************************\n"
+          "  * @file\t\t: fis_sugeno_generated.c\n"
+          "  * @brief   \t: Takagi-Sugeno-Kang (Sugeno) Fuzzy Inference System for\n"
+          "  *               embedded control systems\n"
+          "  *               Generated code: specialized FIS evaluation functions\n"
+          "  *               (sugeno_codegen, from 'fis_sugeno_config.c'). Do not edit.\n"
+          "  *\n"
+          "  ******************************************************************************\n"
+          "  */\n\n"
+          "/* Private includes ----------------------------------------------------------*/\n"
+          "#include \"fis_sugeno_generated.h\"\n\n"
+          "/* Public functions ----------------------------------------------------------*/\n", out);
+
+    for (size_t k = 0; k < sizeof(targets) / sizeof(targets[0]); ++k)
+    {
+        size_t length = FIS_Codegen_Emit(targets[k].fis, targets[k].function_name, NULL, 0);
+        char* source = (length > 0) ? malloc(length + 1) : NULL;
+        if (source == NULL)
+        {
+            fprintf(stderr, "%s: FIS not supported by the code generator\n", targets[k].function_name);
+            return 1;
+        }
+
+        FIS_Codegen_Emit(targets[k].fis, targets[k].function_name, source, length + 1);
+        fprintf(out, "%s%s", (k > 0) ? "\n" : "", source);
+        free(source);
+    }
+
+    if (out != stdout)
+        fclose(out);
+    return 0;
+}
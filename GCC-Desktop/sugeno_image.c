@@ -0,0 +1,60 @@
+#include "fis_sugeno_config.h"
+#include "fis_sugeno_loader.h"
+#include "fis_sugeno_plan.h"
+#include "fis_sugeno_image.h"
+
+#include <stdio.h>
+#include <string.h>
+
+/**
+ * @brief Converter: compiles a FIS and writes it as a binary image (FIS_Image_Save()).
+ *
+ *        Usage: sugeno_image <input.fis | pendulum | pmsm> <output image>
+ *               pendulum, pmsm: configurations of 'fis_sugeno_config.c'
+ */
+int main(int argc, char** argv)
+{
+    static unsigned char fis_memory[65536];
+    static unsigned char plan_memory[65536];
+    FIS_Arena fis_arena, plan_arena;
+    FIS_System* fis = NULL;
+    int error_line = 0;
+
+    if (argc != 3)
+    {
+        fprintf(stderr, "usage: %s <input.fis | pendulum | pmsm> <output image>\n", argv[0]);
+        return 2;
+    }
+
+    FIS_Arena_Init(&fis_arena, fis_memory, sizeof(fis_memory));
+    FIS_Arena_Init(&plan_arena, plan_memory, sizeof(plan_memory));
+
+    if (strcmp(argv[1], "pendulum") == 0)
+        FIS_InvertedPendulumController_InitLinear(&fis);
+    else if (strcmp(argv[1], "pmsm") == 0)
+        FIS_PMSM_SpeedController_InitLinear(&fis);
+    else
+        fis = FIS_LoadFile(argv[1], &fis_arena, &error_line);
+
+    if (fis == NULL)
+    {
+        fprintf(stderr, "%s: cannot load (line %d)\n", argv[1], error_line);
+        return 1;
+    }
+
+    const FIS_Plan* plan = FIS_Compile(fis, &plan_arena);
+    if (plan == NULL || !FIS_Image_IsPortable(plan))
+    {
+        fprintf(stderr, "%s: FIS cannot be stored as an image\n", argv[1]);
+        return 1;
+    }
+
+    if (!FIS_Image_Save(plan, argv[2]))
+    {
+        perror(argv[2]);
+        return 1;
+    }
+
+    printf("%s: %d inputs, %d rules, %u bytes\n", argv[2], (int)plan->num_inputs, (int)plan->num_rules, (unsigned)plan->size);
+    return 0;
+}
@@ -0,0 +1,123 @@
+#include "fis_sugeno_config.h"
+
+#include "test1_input_array.c"
+#include "test2_input_array.c"
+
+#include <pthread.h>
+#include <stdio.h>
+#include <string.h>
+
+#define STRESS_THREADS      16
+#define STRESS_ITERATIONS   20
+
+typedef struct
+{
+    int id;
+    FIS_System* fis[2];
+    const float* reference[2];
+    int mismatches;
+} StressThread;
+
+static float reference1[2000];
+static float reference2[2000];
+
+static int check(const float* reference, int s, float out)
+{
+    return memcmp(&reference[s], &out, sizeof(float)) != 0;
+}
+
+/**
+ * @brief Thread body: interleaves both controllers through all three entry points
+ *        (workspace API, legacy wrapper, batch) and compares against single-threaded results.
+ */
+static void* stress_thread(void* arg)
+{
+    StressThread* t = (StressThread*)arg;
+    unsigned char buffer[1024];
+    FIS_Arena arena;
+    FIS_Arena_Init(&arena, buffer, sizeof(buffer));
+
+    FIS_Workspace* ws1 = FIS_Workspace_Create(t->fis[0], &arena);
+    FIS_Workspace* ws2 = FIS_Workspace_Create(t->fis[1], &arena);
+    if (ws1 == NULL || ws2 == NULL)
+    {
+        t->mismatches = -1;
+        return NULL;
+    }
+
+    for (int k = 0; k < STRESS_ITERATIONS; ++k)
+    {
+        for (int s = 0; s < 2000; ++s)
+        {
+            switch ((t->id + k + s) % 3)
+            {
+                case 0:
+                    t->mismatches += check(t->reference[0], s, FIS_EvaluateReentrant(t->fis[0], test1_inputs[s], ws1));
+                    t->mismatches += check(t->reference[1], s, FIS_EvaluateReentrant(t->fis[1], test2_inputs[s], ws2));
+                    break;
+                case 1:
+                    t->mismatches += check(t->reference[0], s, FIS_Evaluate(t->fis[0], test1_inputs[s]));
+                    t->mismatches += check(t->reference[1], s, FIS_Evaluate(t->fis[1], test2_inputs[s]));
+                    break;
+                default:
+                {
+                    float out;
+                    float column[6];
+                    const float* columns[6];
+                    for (int i = 0; i < 6; ++i)
+                    {
+                        column[i] = test1_inputs[s][i];
+                        columns[i] = &column[i];
+                    }
+                    FIS_EvaluateBatch(t->fis[0], columns, &out, 1);
+                    t->mismatches += check(t->reference[0], s, out);
+
+                    for (int i = 0; i < 5; ++i)
+                        column[i] = test2_inputs[s][i];
+                    FIS_EvaluateBatch(t->fis[1], columns, &out, 1);
+                    t->mismatches += check(t->reference[1], s, out);
+                    break;
+                }
+            }
+        }
+    }
+    return NULL;
+}
+
+int main(void)
+{
+    FIS_System* inv_pendulum_ctrl_fis;
+    FIS_System* pmsm_speed_ctrl_fis;
+    FIS_InvertedPendulumController_Init(&inv_pendulum_ctrl_fis);
+    FIS_PMSM_SpeedController_Init(&pmsm_speed_ctrl_fis);
+
+    for (int s = 0; s < 2000; ++s)
+    {
+        reference1[s] = FIS_Evaluate(inv_pendulum_ctrl_fis, test1_inputs[s]);
+        reference2[s] = FIS_Evaluate(pmsm_speed_ctrl_fis, test2_inputs[s]);
+    }
+
+    pthread_t threads[STRESS_THREADS];
+    StressThread args[STRESS_THREADS];
+
+    for (int t = 0; t < STRESS_THREADS; ++t)
+    {
+        args[t] = (StressThread){
+            .id = t,
+            .fis = { inv_pendulum_ctrl_fis, pmsm_speed_ctrl_fis },
+            .reference = { reference1, reference2 },
+            .mismatches = 0
+        };
+        pthread_create(&threads[t], NULL, stress_thread, &args[t]);
+    }
+
+    int mismatches = 0;
+    for (int t = 0; t < STRESS_THREADS; ++t)
+    {
+        pthread_join(threads[t], NULL);
+        mismatches += args[t].mismatches;
+    }
+
+    printf("Threads: %d, evaluations: %d, mismatches: %d\n", STRESS_THREADS, STRESS_THREADS * STRESS_ITERATIONS * 2000 * 2, mismatches);
+    return (mismatches == 0) ? 0 : 1;
+}
@@ -1,4 +1,18 @@
 #include "fis_sugeno_config.h"
+#include "fis_sugeno_simd.h"
+#include "fis_sugeno_plan.h"
+#include "fis_sugeno_lut.h"
+#include "fis_sugeno_fixed.h"
+#include "fis_sugeno_generated.h"
+#include "fis_sugeno_jit.h"
+#include "fis_sugeno_loader.h"
+#include "fis_sugeno_image.h"
+#include "fis_sugeno_builder.h"
+#include "fis_sugeno_index.h"
+#include "fis_sugeno_incremental.h"
+#include "fis_sugeno_event.h"
+#include "fis_sugeno_mimo.h"
+#include "fis_sugeno_group.h"
 
 #include "test1_input_array.c"
 #include "test1_output_array.c"
@@ -6,13 +20,1072 @@
 #include "test2_input_array.c"
 #include "test2_output_array.c"
 
+#include "test_systems.c"
+
 #include <stdio.h>
+#include <stdlib.h>
 #include <math.h>
+#include <string.h>
+
+/**
+ * @brief Evaluates test vectors with FIS_EvaluateBatch() and returns the max
+ *        deviation from per-sample FIS_Evaluate() results.
+ */
+float batch_max_deviation(FIS_System* fis, float* test_inputs, int num_inputs, int count)
+{
+    static float columns[FIS_MAX_INPUTS][2000];
+    static float outputs[2000];
+    const float* column_ptrs[FIS_MAX_INPUTS];
+
+    for (int i = 0; i < num_inputs; ++i)
+    {
+        for (int s = 0; s < count; ++s)
+            columns[i][s] = test_inputs[s * num_inputs + i];
+        column_ptrs[i] = columns[i];
+    }
+
+    FIS_EvaluateBatch(fis, column_ptrs, outputs, count);
+
+    float error = 0.0f;
+    for (int s = 0; s < count; ++s)
+    {
+        float out = FIS_Evaluate(fis, &test_inputs[s * num_inputs]);
+        if (fabs(out - outputs[s]) > error)
+            error = fabs(out - outputs[s]);
+    }
+    return error;
+}
+
+/**
+ * @brief Evaluates test vectors with a compiled plan (per sample and in a batch)
+ *        and returns the max deviation from FIS_Evaluate() results.
+ */
+float plan_max_deviation(FIS_System* fis, float* test_inputs, int num_inputs, int count)
+{
+    static unsigned char memory[16384];
+    static float columns[FIS_MAX_INPUTS][2000];
+    static float outputs[2000];
+    const float* column_ptrs[FIS_MAX_INPUTS];
+    FIS_Arena arena;
+    FIS_Arena_Init(&arena, memory, sizeof(memory));
+
+    const FIS_Plan* plan = FIS_Compile(fis, &arena);
+    FIS_PlanWorkspace* ws = (plan != NULL) ? FIS_Plan_CreateWorkspace(plan, &arena) : NULL;
+    FIS_PlanBatchWorkspace* batch_ws = (plan != NULL) ? FIS_Plan_CreateBatchWorkspace(plan, &arena) : NULL;
+    if (ws == NULL || batch_ws == NULL)
+        return INFINITY;
+
+    for (int i = 0; i < num_inputs; ++i)
+    {
+        for (int s = 0; s < count; ++s)
+            columns[i][s] = test_inputs[s * num_inputs + i];
+        column_ptrs[i] = columns[i];
+    }
+
+    FIS_Plan_EvaluateBatch(plan, column_ptrs, outputs, count, batch_ws);
+
+    float error = 0.0f;
+    for (int s = 0; s < count; ++s)
+    {
+        float out = FIS_Plan_Evaluate(plan, &test_inputs[s * num_inputs], ws);
+        float expected = FIS_Evaluate(fis, &test_inputs[s * num_inputs]);
+        if (fabs(out - expected) > error)
+            error = fabs(out - expected);
+        if (fabs(outputs[s] - expected) > error)
+            error = fabs(outputs[s] - expected);
+    }
+    return error;
+}
+
+/**
+ * @brief Counts array kernel results (for every available SIMD level) that are
+ *        not bit-identical to the scalar membership function evaluation.
+ */
+int simd_kernel_mismatches(const FIS_MembershipFunction* mf, const float* test_inputs, int count)
+{
+    static float outputs[2000];
+    int mismatches = 0;
+    FIS_SIMD_Level best = FIS_SIMD_GetLevel();
+
+    for (int level = FIS_SIMD_SCALAR; level <= (int)best; ++level)
+    {
+        FIS_SIMD_SetLevel((FIS_SIMD_Level)level);
+        FIS_MF_EvalArray(mf, test_inputs, outputs, count);
+        for (int s = 0; s < count; ++s)
+        {
+            float expected = FIS_EvaluateMemberFunction(test_inputs[s], mf);
+            if (memcmp(&expected, &outputs[s], sizeof(float)) != 0)
+                ++mismatches;
+        }
+    }
+    FIS_SIMD_SetLevel(best);
+    return mismatches;
+}
+
+/**
+ * @brief Builds a LUT for the given weight error bound and prints the grid and the
+ *        output deviation from the exact engine on the test vectors (validation mode).
+ */
+void lut_report(FIS_System* fis, float* test_inputs, int count, float max_error)
+{
+    static unsigned char memory[4096];
+    FIS_Arena arena;
+    FIS_Arena_Init(&arena, memory, sizeof(memory));
+
+    const FIS_Plan* plan = FIS_Compile(fis, &arena);
+    FIS_PlanWorkspace* ws = FIS_Plan_CreateWorkspace(plan, &arena);
+
+    FIS_Arena lut_arena;
+    size_t lut_size = FIS_LUT_MaxSize(plan);
+    void* lut_memory = malloc(lut_size);
+    FIS_Arena_Init(&lut_arena, lut_memory, lut_size);
+
+    const FIS_LUT* lut = FIS_LUT_Create(plan, max_error, &lut_arena);
+    if (lut == NULL)
+        printf("LUT (weight error bound %g): not available\n", max_error);
+    else
+        printf("LUT (weight error bound %g): input %d, %d points, weight error %g, max output deviation %g\n",
+               max_error, (int)lut->axes[0].input, (int)lut->axes[0].num_points, lut->max_error,
+               FIS_LUT_Validate(lut, test_inputs, count, ws));
+    free(lut_memory);
+}
+
+/**
+ * @brief Converts a FIS to fixed point (input ranges taken from the test vectors) and
+ *        prints the max deviation from float and the batch / per-sample mismatches.
+ *
+ * @return  Number of mismatches (1 if the conversion is not available).
+ */
+int fixed_report(FIS_System* fis, float* test_inputs, int num_inputs, int count)
+{
+    static unsigned char memory[4096];
+    static FIS_Q31 columns[FIS_MAX_INPUTS][2000];
+    static FIS_Q31 outputs[2000];
+    const FIS_Q31* column_ptrs[FIS_MAX_INPUTS];
+    float ranges[FIS_MAX_INPUTS] = { 0.0f };
+    FIS_Arena arena;
+    FIS_Arena_Init(&arena, memory, sizeof(memory));
+
+    for (int s = 0; s < count; ++s)
+        for (int i = 0; i < num_inputs; ++i)
+            if (fabs(test_inputs[s * num_inputs + i]) > ranges[i])
+                ranges[i] = fabs(test_inputs[s * num_inputs + i]);
+
+    const FIS_FixedSystem* fixed = FIS_Fixed_Convert(fis, ranges, &arena);
+    if (fixed == NULL)
+    {
+        puts("Fixed point (Q15/Q31): not available");
+        return 1;
+    }
+
+    for (int i = 0; i < num_inputs; ++i)
+    {
+        for (int s = 0; s < count; ++s)
+            columns[i][s] = FIS_Fixed_FromFloat(test_inputs[s * num_inputs + i], fixed->input_exponents[i]);
+        column_ptrs[i] = columns[i];
+    }
+    FIS_Fixed_EvaluateBatch(fixed, column_ptrs, outputs, count);
+
+    int mismatches = 0;
+    for (int s = 0; s < count; ++s)
+    {
+        FIS_Q31 row[FIS_MAX_INPUTS];
+        for (int i = 0; i < num_inputs; ++i)
+            row[i] = columns[i][s];
+        mismatches += (FIS_Fixed_Evaluate(fixed, row) != outputs[s]);
+    }
+
+    printf("Fixed point (Q15/Q31): output exponent %d, max deviation from float %g, batch mismatches %d\n",
+           fixed->output_exponent, FIS_Fixed_Validate(fixed, fis, test_inputs, count), mismatches);
+    return mismatches;
+}
+
+/**
+ * @brief Compares a generated FIS function with FIS_Evaluate() bit by bit on the test
+ *        vectors, and on the test vectors with one input replaced by (finite) probe values.
+ */
+int codegen_mismatches(FIS_System* fis, float (*generated)(const float*), float* test_inputs, int num_inputs, int count,
+                       int probe_input, const float* probes, int num_probes)
+{
+    float row[FIS_MAX_INPUTS];
+    int mismatches = 0;
+
+    for (int s = 0; s < count; ++s)
+    {
+        for (int k = 0; k <= num_probes; ++k)
+        {
+            memcpy(row, &test_inputs[s * num_inputs], num_inputs * sizeof(float));
+            if (k < num_probes)
+                row[probe_input] = probes[k];
+
+            float expected = FIS_Evaluate(fis, row);
+            float out = generated(row);
+            mismatches += (memcmp(&expected, &out, sizeof(float)) != 0);
+        }
+    }
+    return mismatches;
+}
+
+/**
+ * @brief Builds a JIT for the FIS and prints the backend in use and the bit mismatches
+ *        against FIS_Evaluate() on the test vectors.
+ *
+ * @return  Number of mismatches.
+ */
+int jit_report(FIS_System* fis, float* test_inputs, int num_inputs, int count)
+{
+    static unsigned char memory[256];
+    FIS_Arena arena;
+    FIS_Arena_Init(&arena, memory, sizeof(memory));
+
+    FIS_JIT* jit = FIS_JIT_Create(fis, NULL, &arena);
+    int mismatches = 0;
+    for (int s = 0; s < count; ++s)
+    {
+        float expected = FIS_Evaluate(fis, &test_inputs[s * num_inputs]);
+        float out = FIS_JIT_Evaluate(jit, &test_inputs[s * num_inputs]);
+        mismatches += (memcmp(&expected, &out, sizeof(float)) != 0);
+    }
+
+    printf("JIT: %s, mismatches %d\n", (jit->function == NULL) ? "interpreter fallback"
+                                      : jit->cache_hit ? "native (cached)" : "native (compiled)", mismatches);
+    FIS_JIT_Release(jit);
+    return mismatches;
+}
+
+/**
+ * @brief Loads a '.fis' file and prints the arena usage and the bit mismatches against
+ *        FIS_Evaluate() of the hand-written configuration on the test vectors.
+ *
+ * @return  Number of mismatches (1 if the file is not loaded).
+ */
+int loader_report(FIS_System* fis, const char* path, float* test_inputs, int num_inputs, int count)
+{
+    static unsigned char memory[4096];
+    FIS_Arena arena;
+    FIS_Arena_Init(&arena, memory, sizeof(memory));
+
+    int error_line;
+    FIS_System* loaded = FIS_LoadFile(path, &arena, &error_line);
+    if (loaded == NULL)
+    {
+        printf("%s: not loaded (line %d)\n", path, error_line);
+        return 1;
+    }
+
+    int mismatches = 0;
+    for (int s = 0; s < count; ++s)
+    {
+        float expected = FIS_Evaluate(fis, &test_inputs[s * num_inputs]);
+        float out = FIS_Evaluate(loaded, &test_inputs[s * num_inputs]);
+        mismatches += (memcmp(&expected, &out, sizeof(float)) != 0);
+    }
+
+    // Arena exhausted part-way through the file: error line 0, not the current line
+    const size_t used = arena.used;
+    FIS_Arena short_arena;
+    FIS_Arena_Init(&short_arena, FIS_Arena_Alloc(&arena, used / 2, FIS_ARENA_ALIGN), used / 2);
+    const int exhausted = (FIS_LoadFile(path, &short_arena, &error_line) == NULL && error_line == 0);
+
+    printf("%s: %u bytes, mismatches %d, exhausted arena reported: %d\n", path, (unsigned)used, mismatches, exhausted);
+    return mismatches;
+}
+
+/**
+ * @brief Saves a compiled plan as a binary image, maps it back and relocates a copy with
+ *        memcpy(); prints the bit mismatches of both against the original plan.
+ *
+ * @return  Number of mismatches (1 if the image is not available).
+ */
+int image_report(FIS_System* fis, float* test_inputs, int num_inputs, int count)
+{
+    static unsigned char memory[8192];
+    const char* path = "sugeno_test.fisimg";
+    FIS_Arena arena;
+    FIS_Arena_Init(&arena, memory, sizeof(memory));
+
+    const FIS_Plan* plan = FIS_Compile(fis, &arena);
+    FIS_PlanWorkspace* ws = FIS_Plan_CreateWorkspace(plan, &arena);
+    unsigned char* copy = FIS_Arena_Alloc(&arena, plan->size, FIS_PLAN_ALIGN);
+    FIS_ImageMapping mapping;
+    const FIS_Plan* mapped = FIS_Image_Save(plan, path) ? FIS_Image_Map(path, &mapping) : NULL;
+    const FIS_Plan* relocated = FIS_Image_Check(memcpy(copy, plan, plan->size), plan->size);
+    remove(path);
+
+    if (mapped == NULL || relocated == NULL)
+    {
+        puts("Binary image: not available");
+        return 1;
+    }
+
+    int mismatches = 0;
+    for (int s = 0; s < count; ++s)
+    {
+        float expected = FIS_Plan_Evaluate(plan, &test_inputs[s * num_inputs], ws);
+        float out_mapped = FIS_Plan_Evaluate(mapped, &test_inputs[s * num_inputs], ws);
+        float out_relocated = FIS_Plan_Evaluate(relocated, &test_inputs[s * num_inputs], ws);
+        mismatches += (memcmp(&expected, &out_mapped, sizeof(float)) != 0);
+        mismatches += (memcmp(&expected, &out_relocated, sizeof(float)) != 0);
+    }
+
+    // Corrupted images must be rejected
+    FIS_Plan* corrupted = (FIS_Plan*)copy;
+    corrupted->matrix_offset += FIS_PLAN_ALIGN * 64;
+    int rejected = (FIS_Image_Check(copy, plan->size) == NULL);
+
+    // Matrix size num_columns * linear_stride wrapping around in 32 bits
+    memcpy(copy, plan, plan->size);
+    corrupted->num_columns = corrupted->num_inputs + 1;
+    corrupted->linear_stride = (int32_t)((((int64_t)1 << 32) / corrupted->num_columns / FIS_SIMD_MAX_LANES + 1) * FIS_SIMD_MAX_LANES);
+    rejected &= (FIS_Image_Check(copy, plan->size) == NULL);
+
+    printf("Binary image: %u bytes, mismatches %d, corrupted image rejected: %d\n", (unsigned)mapped->size, mismatches, rejected);
+    FIS_Image_Unmap(&mapping);
+    return mismatches;
+}
+
+/**
+ * @brief Rebuilds a FIS with the builder API (one arena block) and prints its size and
+ *        the bit mismatches against FIS_Evaluate() of the original on the test vectors.
+ *
+ * @return  Number of mismatches (1 if the FIS is not rebuilt).
+ */
+int builder_report(FIS_System* fis, float* test_inputs, int num_inputs, int count)
+{
+    static unsigned char scratch_memory[8192];
+    static unsigned char memory[4096];
+    FIS_Arena scratch, arena;
+    FIS_Builder builder;
+    FIS_Arena_Init(&scratch, scratch_memory, sizeof(scratch_memory));
+    FIS_Arena_Init(&arena, memory, sizeof(memory));
+
+    FIS_Builder_Init(&builder, &scratch);
+    FIS_Builder_AddSystem(&builder, fis);
+    const size_t size = FIS_Builder_Size(&builder);
+    FIS_System* built = FIS_Builder_Finalize(&builder, &arena);
+    if (built == NULL)
+    {
+        puts("Builder: failed");
+        return 1;
+    }
+
+    int mismatches = 0;
+    for (int s = 0; s < count; ++s)
+    {
+        float expected = FIS_Evaluate(fis, &test_inputs[s * num_inputs]);
+        float out = FIS_Evaluate(built, &test_inputs[s * num_inputs]);
+        mismatches += (memcmp(&expected, &out, sizeof(float)) != 0);
+    }
+
+    // A rule without consequent is rejected and leaves the arena untouched
+    const size_t used = arena.used;
+    FIS_Builder_AddRule(&builder, FIS_AND_MIN, fis->rules[0].mf_indices);
+    const int rejected = (FIS_Builder_Finalize(&builder, &arena) == NULL && arena.used == used);
+
+    printf("Builder: %u bytes in one block (measured %u), scratch %u bytes, mismatches %d, incomplete FIS rejected: %d\n",
+           (unsigned)used, (unsigned)size, (unsigned)scratch.used, mismatches, rejected);
+    return mismatches;
+}
+
+/**
+ * @brief Compiles complete grid rule bases and prints whether the tensor path was
+ *        selected and its max deviation from FIS_Evaluate().
+ */
+void tensor_report(int num_inputs, int num_mfs, int count)
+{
+    static unsigned char scratch_memory[4 << 20], memory[8 << 20];
+    static float inputs[1000 * 8];
+    FIS_Arena scratch, arena;
+
+    for (int logic = FIS_AND_MIN; logic <= FIS_AND_PRODUCT; ++logic)
+    {
+        FIS_Arena_Init(&scratch, scratch_memory, sizeof(scratch_memory));
+        FIS_Arena_Init(&arena, memory, sizeof(memory));
+        FIS_System* fis = build_grid_fis(num_inputs, num_mfs, (FIS_LogicType)logic, 0, &scratch, &arena);
+        const FIS_Plan* plan = (fis != NULL) ? FIS_Compile(fis, &arena) : NULL;
+        FIS_PlanWorkspace* ws = (plan != NULL) ? FIS_Plan_CreateWorkspace(plan, &arena) : NULL;
+        if (ws == NULL)
+        {
+            puts("Tensor plan: arena exhausted");
+            return;
+        }
+
+        for (int s = 0; s < count * num_inputs; ++s)
+            inputs[s] = 2.2f * rand() / RAND_MAX - 1.1f;
+
+        float max_deviation = 0.0f;
+        for (int s = 0; s < count; ++s)
+            max_deviation = fmaxf(max_deviation, fabsf(FIS_Plan_Evaluate(plan, &inputs[s * num_inputs], ws)
+                                                       - FIS_Evaluate(fis, &inputs[s * num_inputs])));
+
+        printf("%d^%d grid, %s: tensor path %d, max deviation %g\n", num_mfs, num_inputs,
+               (logic == FIS_AND_MIN) ? "min" : "product", (plan->flags & FIS_PLAN_FLAG_TENSOR) != 0, max_deviation);
+    }
+}
+
+/**
+ * @brief Evaluates test vectors through the inverted rule index and prints the bit
+ *        mismatches against FIS_EvaluateReentrant() and the mean number of rules evaluated.
+ *
+ * @return  Number of mismatches (1 if the index is not available).
+ */
+int index_report(const char* name, FIS_System* fis, float* test_inputs, int num_inputs, int count)
+{
+    static unsigned char memory[1 << 20];
+    FIS_Arena arena;
+    FIS_Arena_Init(&arena, memory, sizeof(memory));
+
+    const FIS_RuleIndex* index = FIS_Index_Create(fis, &arena);
+    FIS_IndexWorkspace* index_ws = (index != NULL) ? FIS_Index_CreateWorkspace(index, &arena) : NULL;
+    FIS_Workspace* ws = FIS_Workspace_Create(fis, &arena);
+    if (index_ws == NULL || ws == NULL)
+    {
+        printf("Rule index (%s): not available\n", name);
+        return 1;
+    }
+
+    int mismatches = 0;
+    long evaluated = 0;
+    for (int s = 0; s < count; ++s)
+    {
+        float expected = FIS_EvaluateReentrant(fis, &test_inputs[s * num_inputs], ws);
+        float out = FIS_Index_Evaluate(index, &test_inputs[s * num_inputs], index_ws);
+        mismatches += (memcmp(&expected, &out, sizeof(float)) != 0);
+        evaluated += index_ws->num_evaluated;
+    }
+
+    // A workspace that does not fit leaves the arena as it was
+    const size_t half = FIS_Index_WorkspaceSize(index) / 2;
+    FIS_Arena short_arena;
+    FIS_Arena_Init(&short_arena, FIS_Arena_Alloc(&arena, half, FIS_ARENA_ALIGN), half);
+    const int restored = (FIS_Index_CreateWorkspace(index, &short_arena) == NULL && short_arena.used == 0);
+
+    printf("Rule index (%s): %d rules (%d indexed), %.1f evaluated per sample, mismatches %d, short arena restored: %d\n",
+           name, index->num_rules, index->num_indexed, (double)evaluated / count, mismatches, restored);
+    return mismatches;
+}
+
+/**
+ * @brief Compiles a FIS and reports whether the scheduling input was proven a
+ *        partition of unity, the share of samples taking the division-free path and
+ *        the max deviation from FIS_Evaluate(). Every other sample sweeps the
+ *        scheduling input across and beyond the knots (knots included).
+ */
+void partition_report(const char* name, FIS_System* fis, float* test_inputs, int num_inputs, int count)
+{
+    static unsigned char memory[16384];
+    float row[16];
+    FIS_Arena arena;
+    FIS_Arena_Init(&arena, memory, sizeof(memory));
+
+    const FIS_Plan* plan = FIS_Compile(fis, &arena);
+    FIS_PlanWorkspace* ws = (plan != NULL) ? FIS_Plan_CreateWorkspace(plan, &arena) : NULL;
+    if (ws == NULL)
+    {
+        printf("Partition (%s): not available\n", name);
+        return;
+    }
+
+    if (!(plan->flags & FIS_PLAN_FLAG_PARTITION))
+    {
+        printf("Partition (%s): not a partition of unity, evaluated with normalization\n", name);
+        return;
+    }
+
+    const float* knots = FIS_PLAN_KNOTS(plan);
+    const float lo = knots[0], hi = knots[plan->num_knots - 1];
+    const float margin = 0.1f * (hi - lo);
+    int division_free = 0;
+    float max_deviation = 0.0f;
+
+    for (int s = 0; s < count; ++s)
+    {
+        memcpy(row, &test_inputs[s * num_inputs], sizeof(float) * num_inputs);
+        float* x = &row[plan->scheduling_input];
+        if (s % 2 == 1)
+            *x = (s / 2 < plan->num_knots) ? knots[s / 2] : lo - margin + (hi - lo + 2.0f * margin) * s / count;
+
+        int on_knot = 0;
+        for (int j = 0; j < plan->num_knots; ++j)
+            on_knot |= (*x == knots[j]);
+        division_free += (*x > lo && *x < hi && !on_knot);
+
+        max_deviation = fmaxf(max_deviation, fabsf(FIS_Plan_Evaluate(plan, row, ws) - FIS_Evaluate(fis, row)));
+    }
+
+    printf("Partition (%s): %d knots, %d/%d samples division-free, max deviation %g, image check %s\n",
+           name, (int)plan->num_knots, division_free, count, max_deviation,
+           (FIS_Image_Check(plan, plan->size) != NULL) ? "ok" : "failed");
+}
+
+/**
+ * @brief Replays test vectors through an incremental evaluator with antecedent
+ *        inputs sampled and held for `hold` samples, every 8th sample repeated and
+ *        the cache invalidated once. Prints the max deviation from FIS_Evaluate(),
+ *        the bit mismatches against FIS_Plan_Evaluate() (gain blending plans) and
+ *        the hit rates.
+ *
+ * @return  Number of mismatches (1 if the evaluator is not available).
+ */
+int incremental_report(const char* name, FIS_System* fis, float* test_inputs, int num_inputs, int count, int hold)
+{
+    static unsigned char memory[65536];
+    float row[16];
+    FIS_Arena arena;
+    FIS_Arena_Init(&arena, memory, sizeof(memory));
+
+    const FIS_Plan* plan = FIS_Compile(fis, &arena);
+    FIS_PlanWorkspace* ws = (plan != NULL) ? FIS_Plan_CreateWorkspace(plan, &arena) : NULL;
+    FIS_Incremental* inc = (plan != NULL) ? FIS_Incremental_Create(plan, &arena) : NULL;
+    if (ws == NULL || inc == NULL)
+    {
+        printf("Incremental (%s): not available\n", name);
+        return 1;
+    }
+
+    const int bitwise = (plan->flags & FIS_PLAN_FLAG_GAIN_BLENDING) && !(plan->flags & FIS_PLAN_FLAG_TENSOR);
+
+    float max_deviation = 0.0f;
+    int mismatches = 0;
+    for (int s = 0; s < count; ++s)
+    {
+        const int t = (s % 8 == 7) ? s - 1 : s;
+        for (int i = 0; i < num_inputs; ++i)
+        {
+            const int held = (inc->input_role[i] & FIS_INCREMENTAL_ANTECEDENT) ? t - t % hold : t;
+            row[i] = test_inputs[held * num_inputs + i];
+        }
+        if (s == count / 2)
+            FIS_Incremental_Invalidate(inc);
+
+        const float out = FIS_Incremental_Evaluate(inc, row);
+        const float expected = FIS_Plan_Evaluate(plan, row, ws);
+        max_deviation = fmaxf(max_deviation, fabsf(out - FIS_Evaluate(fis, row)));
+        mismatches += bitwise && (memcmp(&out, &expected, sizeof(float)) != 0);
+    }
+
+    const FIS_IncrementalStats* stats = &inc->stats;
+    printf("Incremental (%s, hold %d): max deviation %g, mismatches %d%s, hits: output %.1f%%, weights %.1f%%, inputs %.1f%%, %.1f rules recomputed per sample\n",
+           name, hold, max_deviation, mismatches, bitwise ? "" : " (not checked)",
+           100.0 * stats->output_hits / stats->evaluations, 100.0 * stats->weight_hits / stats->evaluations,
+           100.0 * stats->input_hits / stats->input_checks, (double)stats->rules_recomputed / stats->evaluations);
+    return mismatches;
+}
+
+/**
+ * @brief Replays test vectors through an event-triggered evaluator with the trace
+ *        range as operating box and a tolerance relative to the output range. Prints
+ *        the Lipschitz bounds, the skipped evaluations, the largest error relative to
+ *        the tolerance and the samples exceeding it (beyond float rounding).
+ *
+ * @return  Number of violations (1 if the trigger is not available).
+ */
+int event_report(const char* name, FIS_System* fis, float* test_inputs, int num_inputs, int count, float relative_tolerance)
+{
+    static unsigned char memory[65536];
+    float lower[16], upper[16], bounds[16];
+    FIS_Arena arena;
+    FIS_Arena_Init(&arena, memory, sizeof(memory));
+
+    for (int i = 0; i < num_inputs; ++i)
+    {
+        lower[i] = upper[i] = test_inputs[i];
+        for (int s = 1; s < count; ++s)
+        {
+            lower[i] = fminf(lower[i], test_inputs[s * num_inputs + i]);
+            upper[i] = fmaxf(upper[i], test_inputs[s * num_inputs + i]);
+        }
+    }
+
+    const FIS_Plan* plan = FIS_Compile(fis, &arena);
+    FIS_PlanWorkspace* ws = (plan != NULL) ? FIS_Plan_CreateWorkspace(plan, &arena) : NULL;
+    if (ws == NULL || !FIS_Event_LipschitzBounds(plan, lower, upper, bounds))
+    {
+        printf("Event trigger (%s): Lipschitz bounds not available\n", name);
+        return 1;
+    }
+
+    float output_min = INFINITY, output_max = -INFINITY;
+    for (int s = 0; s < count; ++s)
+    {
+        const float y = FIS_Plan_Evaluate(plan, &test_inputs[s * num_inputs], ws);
+        output_min = fminf(output_min, y);
+        output_max = fmaxf(output_max, y);
+    }
+
+    const float tolerance = relative_tolerance * (output_max - output_min);
+    FIS_EventTrigger* trigger = FIS_Event_Create(plan, lower, upper, tolerance, &arena);
+    if (trigger == NULL)
+    {
+        printf("Event trigger (%s): not available\n", name);
+        return 1;
+    }
+
+    float max_ratio = 0.0f;
+    int violations = 0;
+    for (int s = 0; s < count; ++s)
+    {
+        const float* row = &test_inputs[s * num_inputs];
+        const float expected = FIS_Plan_Evaluate(plan, row, ws);
+        const float error = fabsf(FIS_Event_Evaluate(trigger, row) - expected);
+        max_ratio = fmaxf(max_ratio, error / tolerance);
+        violations += (error > tolerance + 1e-6f * fabsf(expected));
+    }
+
+    printf("Event trigger (%s, tolerance %g): bounds", name, tolerance);
+    for (int i = 0; i < num_inputs; ++i)
+        printf(" %g", bounds[i]);
+    printf(", skipped %u/%u, max error %.3f x tolerance, violations %d\n",
+           trigger->skipped, trigger->evaluations, max_ratio, violations);
+    return violations;
+}
+
+/**
+ * @brief Evaluates K-output variants of a FIS with FIS_Mimo_Evaluate() and prints the
+ *        max deviation from FIS_Evaluate() of each output system, and whether systems
+ *        with different antecedents are rejected.
+ */
+void mimo_report(const char* name, FIS_System* fis, float* test_inputs, int num_inputs, int count, int num_outputs)
+{
+    static unsigned char memory[1 << 20];
+    static FIS_System storage[16];
+    const FIS_System* systems[16];
+    float outputs[16];
+    FIS_Arena arena;
+    FIS_Arena_Init(&arena, memory, sizeof(memory));
+
+    build_output_variants(fis, num_outputs, systems, storage, &arena);
+    const FIS_MimoPlan* mimo = FIS_Mimo_Compile(systems, num_outputs, &arena);
+    FIS_MimoWorkspace* ws = (mimo != NULL) ? FIS_Mimo_CreateWorkspace(mimo, &arena) : NULL;
+    if (ws == NULL)
+    {
+        printf("MIMO (%s): not available\n", name);
+        return;
+    }
+
+    float max_deviation = 0.0f;
+    for (int s = 0; s < count; ++s)
+    {
+        float* row = &test_inputs[s * num_inputs];
+        FIS_Mimo_Evaluate(mimo, row, outputs, ws);
+        for (int k = 0; k < num_outputs; ++k)
+            max_deviation = fmaxf(max_deviation, fabsf(outputs[k] - FIS_Evaluate(&storage[k], row)));
+    }
+
+    // Different connective in the last output: not a multi-output system
+    FIS_Rule* rules = (FIS_Rule*)storage[num_outputs - 1].rules;
+    rules[0].logic_type = (rules[0].logic_type == FIS_AND_MIN) ? FIS_AND_PRODUCT : FIS_AND_MIN;
+    const int rejected = (num_outputs > 1) && (FIS_Mimo_Compile(systems, num_outputs, &arena) == NULL);
+
+    printf("MIMO (%s, %d outputs): %d columns, %d matrix rows, max deviation %g, different antecedents rejected: %d\n",
+           name, num_outputs, (int)mimo->num_columns, (int)mimo->stride, max_deviation, rejected);
+}
+
+/**
+ * @brief Evaluates a group of output variants of a FIS plus a variant with one moved
+ *        MF peak with FIS_Group_Evaluate() and prints the distinct MFs and
+ *        the bit mismatches against FIS_Plan_Evaluate() of each member.
+ *
+ * @return  Number of mismatches (1 if the group is not available).
+ */
+int group_report(const char* name, FIS_System* fis, float* test_inputs, int num_inputs, int count, int num_variants)
+{
+    static unsigned char memory[1 << 20];
+    static FIS_System storage[16];
+    const FIS_System* systems[16];
+    float outputs[16];
+    FIS_Arena arena;
+    FIS_Arena_Init(&arena, memory, sizeof(memory));
+
+    build_output_variants(fis, num_variants, systems, storage, &arena);
+
+    // Last member: first MF of the FIS with its peak (or plateau end) moved
+    int input = 0, index = 0;
+    while (input < fis->num_inputs && (index == fis->num_mfs_per_input[input] || fis->input_mfs[input][index] == NULL))
+    {
+        if (index < fis->num_mfs_per_input[input])
+            ++index;
+        else
+            ++input, index = 0;
+    }
+    if (input == fis->num_inputs)
+        return 0;
+
+    const int num_systems = num_variants + 1;
+    FIS_MembershipFunction*** input_mfs = FIS_Arena_Alloc(&arena, sizeof(FIS_MembershipFunction**) * fis->num_inputs, FIS_ARENA_ALIGN);
+    FIS_MembershipFunction** row = FIS_Arena_Alloc(&arena, sizeof(FIS_MembershipFunction*) * fis->num_mfs_per_input[input], FIS_ARENA_ALIGN);
+    FIS_MembershipFunction* mf = FIS_Arena_Alloc(&arena, sizeof(FIS_MembershipFunction), FIS_ARENA_ALIGN);
+    memcpy(input_mfs, fis->input_mfs, sizeof(FIS_MembershipFunction**) * fis->num_inputs);
+    memcpy(row, fis->input_mfs[input], sizeof(FIS_MembershipFunction*) * fis->num_mfs_per_input[input]);
+    *mf = *row[index];
+    if (mf->eval == FIS_MF_TriangularEval)
+    {
+        FIS_MF_TriangularParams* params = FIS_Arena_Alloc(&arena, sizeof(FIS_MF_TriangularParams), FIS_ARENA_ALIGN);
+        *params = *(const FIS_MF_TriangularParams*)row[index]->params;
+        params->b += 0.25f * (params->c - params->b);
+        mf->params = params;
+    }
+    else if (mf->eval == FIS_MF_TrapezoidalEval)
+    {
+        FIS_MF_TrapezoidalParams* params = FIS_Arena_Alloc(&arena, sizeof(FIS_MF_TrapezoidalParams), FIS_ARENA_ALIGN);
+        *params = *(const FIS_MF_TrapezoidalParams*)row[index]->params;
+        params->c += 0.25f * (params->d - params->c);
+        mf->params = params;
+    }
+    row[index] = mf;
+    input_mfs[input] = row;
+    storage[num_variants] = *fis;
+    storage[num_variants].input_mfs = input_mfs;
+    systems[num_variants] = &storage[num_variants];
+
+    const FIS_Group* group = FIS_Group_Compile(systems, num_systems, &arena);
+    FIS_GroupWorkspace* ws = (group != NULL) ? FIS_Group_CreateWorkspace(group, &arena) : NULL;
+    FIS_PlanWorkspace* plan_ws = (ws != NULL) ? FIS_Plan_CreateWorkspace(group->plans[0], &arena) : NULL;
+    if (plan_ws == NULL)
+    {
+        printf("Group (%s): not available\n", name);
+        return 1;
+    }
+
+    int mismatches = 0;
+    for (int s = 0; s < count; ++s)
+    {
+        const float* sample = &test_inputs[s * num_inputs];
+        FIS_Group_Evaluate(group, sample, outputs, ws);
+        for (int k = 0; k < num_systems; ++k)
+        {
+            const float expected = FIS_Plan_Evaluate(group->plans[k], sample, plan_ws);
+            mismatches += (memcmp(&outputs[k], &expected, sizeof(float)) != 0);
+        }
+    }
+
+    printf("Group (%s, %d members): %d distinct of %d MFs, bit mismatches %d\n",
+           name, num_systems, (int)group->num_unique, (int)group->num_degrees, mismatches);
+    return mismatches;
+}
+
+/**
+ * @brief Prints the consequents and MFs shared by the plan of a FIS and the max
+ *        deviation of FIS_Plan_Evaluate() and FIS_Plan_EvaluateBatch() from FIS_Evaluate().
+ */
+static void sharing_check(const char* name, const FIS_System* fis, const FIS_Plan* plan, FIS_Arena* arena,
+                          float* test_inputs, int num_inputs, int count)
+{
+    static float columns[8][1024], outputs[1024];
+    const float* column_ptrs[8];
+    FIS_PlanSharing sharing;
+    FIS_PlanWorkspace* ws = (plan != NULL) ? FIS_Plan_CreateWorkspace(plan, arena) : NULL;
+    FIS_PlanBatchWorkspace* batch_ws = (ws != NULL) ? FIS_Plan_CreateBatchWorkspace(plan, arena) : NULL;
+    if (batch_ws == NULL || num_inputs > 8 || count > 1024)
+    {
+        printf("Sharing (%s): not available\n", name);
+        return;
+    }
+
+    for (int i = 0; i < num_inputs; ++i)
+    {
+        for (int s = 0; s < count; ++s)
+            columns[i][s] = test_inputs[s * num_inputs + i];
+        column_ptrs[i] = columns[i];
+    }
+    FIS_Plan_EvaluateBatch(plan, column_ptrs, outputs, count, batch_ws);
+
+    float max_deviation = 0.0f, batch_deviation = 0.0f;
+    for (int s = 0; s < count; ++s)
+    {
+        float* row = &test_inputs[s * num_inputs];
+        const float expected = FIS_Evaluate((FIS_System*)fis, row);
+        max_deviation = fmaxf(max_deviation, fabsf(FIS_Plan_Evaluate(plan, row, ws) - expected));
+        batch_deviation = fmaxf(batch_deviation, fabsf(outputs[s] - expected));
+    }
+
+    // Sharing must not depend on arena slack: FIS_Plan_Size() bytes give the same plan,
+    // an arena without room for the scratch table fails and is left untouched
+    const size_t size = FIS_Plan_Size(fis);
+    FIS_Arena exact, short_arena;
+    FIS_Arena_Init(&exact, FIS_Arena_Alloc(arena, size, FIS_PLAN_ALIGN), size);
+    FIS_Arena_Init(&short_arena, FIS_Arena_Alloc(arena, plan->size, FIS_PLAN_ALIGN), plan->size);
+    const FIS_Plan* exact_plan = FIS_Compile(fis, &exact);
+    const int slack_independent = exact_plan != NULL && exact_plan->size == plan->size && memcmp(exact_plan, plan, plan->size) == 0
+                               && FIS_Compile(fis, &short_arena) == NULL && short_arena.used == 0;
+
+    FIS_Plan_GetSharing(plan, &sharing);
+    printf("Sharing (%s): consequents %d -> %d, MFs %d -> %d, max deviation %g (batch %g), image check %s, exact arena %s\n",
+           name, (int)sharing.num_rule_consequents, (int)sharing.num_consequents, (int)sharing.num_mfs,
+           (int)sharing.num_distinct_mfs, max_deviation, batch_deviation,
+           !FIS_Image_IsPortable(plan) ? "n/a" : (FIS_Image_Check(plan, plan->size) != NULL) ? "ok" : "failed",
+           slack_independent ? "ok" : "failed");
+}
+
+/**
+ * @brief Consequent and MF sharing of a FIS, and of a generated rule base: every MF
+ *        declared twice (separate parameter copies) and the linear consequents of the
+ *        rules copied from a pool of `num_distinct` coefficient vectors.
+ */
+void sharing_report(const char* name, FIS_System* fis, float* test_inputs, int num_inputs, int count, int num_distinct)
+{
+    enum { INPUTS = 4, MFS = 3, RULES = 81 };
+    static unsigned char memory[1 << 20];
+    static float generated_inputs[1000 * INPUTS];
+    static FIS_MF_TriangularParams params[INPUTS][2 * MFS];
+    static FIS_MembershipFunction mfs[INPUTS][2 * MFS];
+    static FIS_MembershipFunction* mf_rows[INPUTS][2 * MFS];
+    static FIS_MembershipFunction** input_mfs[INPUTS];
+    static int num_mfs[INPUTS], indices[RULES][INPUTS];
+    static float coefficients[RULES][INPUTS + 1];
+    static FIS_Rule rules[RULES];
+    FIS_Arena arena;
+    FIS_Arena_Init(&arena, memory, sizeof(memory));
+
+    sharing_check(name, fis, FIS_Compile(fis, &arena), &arena, test_inputs, num_inputs, count);
+
+    // Generated rule base: MF m and m + MFS of an input are the same triangle
+    srand(25);
+    for (int i = 0; i < INPUTS; ++i)
+    {
+        for (int m = 0; m < 2 * MFS; ++m)
+        {
+            const float b = -1.0f + (m % MFS);
+            params[i][m] = (FIS_MF_TriangularParams){ .a = b - 1.0f, .b = b, .c = b + 1.0f };
+            mfs[i][m] = (FIS_MembershipFunction){ .eval = FIS_MF_TriangularEval, .params = &params[i][m] };
+            mf_rows[i][m] = &mfs[i][m];
+        }
+        num_mfs[i] = 2 * MFS;
+        input_mfs[i] = mf_rows[i];
+    }
+    for (int r = 0; r < RULES; ++r)
+    {
+        const int pool = rand() % num_distinct;
+        for (int i = 0; i < INPUTS; ++i)
+            indices[r][i] = (rand() % 4 == 0) ? -1 : rand() % (2 * MFS);
+        for (int j = 0; j <= INPUTS; ++j)
+            coefficients[r][j] = 0.25f * (float)((pool * 7 + j * 3) % 11) - 1.0f;
+        rules[r] = (FIS_Rule){ .mf_indices = indices[r], .consequent = NULL,
+                               .logic_type = (r % 2) ? FIS_AND_PRODUCT : FIS_AND_MIN, .coefficients = coefficients[r] };
+    }
+    FIS_System generated = { .num_inputs = INPUTS, .num_mfs_per_input = num_mfs, .input_mfs = input_mfs,
+                             .rules = rules, .num_rules = RULES };
+    for (int s = 0; s < 1000 * INPUTS; ++s)
+        generated_inputs[s] = 2.4f * rand() / RAND_MAX - 1.2f;
+
+    char generated_name[64];
+    snprintf(generated_name, sizeof(generated_name), "generated, %d rules, %d consequents", RULES, num_distinct);
+    sharing_check(generated_name, &generated, FIS_Compile(&generated, &arena), &arena, generated_inputs, INPUTS, 1000);
+}
+
+/**
+ * @brief Builds a random FIS larger than the stack tables of FIS_Evaluate() inside an
+ *        arena and prints the bit mismatches of FIS_Evaluate() (table-free path) and
+ *        FIS_EvaluateBatchReentrant() against FIS_EvaluateReentrant() with an arena workspace,
+ *        and the max deviation of the compiled plan.
+ *
+ * @return  Number of mismatches (1 if the arena is exhausted).
+ */
+int large_system_report(int num_inputs, int num_mfs, int num_rules, int count)
+{
+    static unsigned char memory[4 << 20];
+    static float inputs[8192];
+    static float outputs[1024];
+    const float* column_ptrs[64];
+    FIS_Arena arena;
+    FIS_Arena_Init(&arena, memory, sizeof(memory));
+    srand(15);
+
+    // Uniform triangular partition of [-1, 1] on every input
+    FIS_System* fis = FIS_Arena_Alloc(&arena, sizeof(FIS_System), FIS_ARENA_ALIGN);
+    fis->num_inputs = num_inputs;
+    fis->num_rules = num_rules;
+    fis->num_mfs_per_input = FIS_Arena_Alloc(&arena, sizeof(int) * num_inputs, FIS_ARENA_ALIGN);
+    fis->input_mfs = FIS_Arena_Alloc(&arena, sizeof(FIS_MembershipFunction**) * num_inputs, FIS_ARENA_ALIGN);
+    FIS_MembershipFunction* mfs = FIS_Arena_Alloc(&arena, sizeof(FIS_MembershipFunction) * num_mfs, FIS_ARENA_ALIGN);
+    FIS_MF_TriangularParams* params = FIS_Arena_Alloc(&arena, sizeof(FIS_MF_TriangularParams) * num_mfs, FIS_ARENA_ALIGN);
+    FIS_MembershipFunction** mf_row = FIS_Arena_Alloc(&arena, sizeof(FIS_MembershipFunction*) * num_mfs, FIS_ARENA_ALIGN);
+    const float step = 2.0f / (num_mfs - 1);
+    for (int m = 0; m < num_mfs; ++m)
+    {
+        params[m] = (FIS_MF_TriangularParams){ .a = -1.0f + (m - 1) * step, .b = -1.0f + m * step, .c = -1.0f + (m + 1) * step };
+        mfs[m] = (FIS_MembershipFunction){ .eval = FIS_MF_TriangularEval, .params = &params[m] };
+        mf_row[m] = &mfs[m];
+    }
+    for (int i = 0; i < num_inputs; ++i)
+    {
+        fis->num_mfs_per_input[i] = num_mfs;
+        fis->input_mfs[i] = mf_row;
+    }
+
+    // Random antecedents (about 3 terms per rule) and linear consequents
+    fis->rules = FIS_Arena_Alloc(&arena, sizeof(FIS_Rule) * num_rules, FIS_ARENA_ALIGN);
+    int* indices = FIS_Arena_Alloc(&arena, sizeof(int) * num_rules * num_inputs, FIS_ARENA_ALIGN);
+    float* coefficients = FIS_Arena_Alloc(&arena, sizeof(float) * num_rules * (num_inputs + 1), FIS_ARENA_ALIGN);
+    for (int r = 0; r < num_rules; ++r)
+    {
+        for (int i = 0; i < num_inputs; ++i)
+            indices[r * num_inputs + i] = (rand() % num_inputs < 3) ? rand() % num_mfs : -1;
+        for (int i = 0; i <= num_inputs; ++i)
+            coefficients[r * (num_inputs + 1) + i] = (float)rand() / RAND_MAX - 0.5f;
+
+        fis->rules[r] = (FIS_Rule){ .mf_indices = &indices[r * num_inputs], .consequent = NULL,
+                                    .logic_type = (r % 2) ? FIS_AND_PRODUCT : FIS_AND_MIN,
+                                    .coefficients = &coefficients[r * (num_inputs + 1)] };
+    }
+
+    FIS_Workspace* ws = FIS_Workspace_Create(fis, &arena);
+    const FIS_Plan* plan = FIS_Compile(fis, &arena);
+    FIS_PlanWorkspace* plan_ws = (plan != NULL) ? FIS_Plan_CreateWorkspace(plan, &arena) : NULL;
+    FIS_BatchWorkspace* batch_ws = FIS_BatchWorkspace_Create(fis, &arena);
+    if (ws == NULL || plan_ws == NULL || batch_ws == NULL)
+    {
+        puts("Large system: arena exhausted");
+        return 1;
+    }
+
+    // Test vectors in structure-of-arrays layout
+    for (int i = 0; i < num_inputs; ++i)
+    {
+        for (int s = 0; s < count; ++s)
+            inputs[i * count + s] = 2.2f * rand() / RAND_MAX - 1.1f;
+        column_ptrs[i] = &inputs[i * count];
+    }
+    FIS_EvaluateBatchReentrant(fis, column_ptrs, outputs, count, batch_ws);
+
+    int mismatches = 0;
+    float plan_deviation = 0.0f;
+    for (int s = 0; s < count; ++s)
+    {
+        float row[64];
+        for (int i = 0; i < num_inputs; ++i)
+            row[i] = inputs[i * count + s];
+
+        float expected = FIS_EvaluateReentrant(fis, row, ws);
+        float out = FIS_Evaluate(fis, row);
+        mismatches += (memcmp(&expected, &out, sizeof(float)) != 0);
+        mismatches += (memcmp(&expected, &outputs[s], sizeof(float)) != 0);
+        plan_deviation = fmaxf(plan_deviation, fabsf(FIS_Plan_Evaluate(plan, row, plan_ws) - expected));
+    }
+
+    printf("Large system (%d inputs x %d MFs, %d rules): %u bytes, mismatches %d, plan max deviation %g\n",
+           num_inputs, num_mfs, num_rules, (unsigned)arena.used, mismatches, plan_deviation);
+    return mismatches;
+}
+
+/**
+ * @brief Two inputs with `num_mfs` MFs declared in shuffled order: input 0 a partition
+ *        of [-1, 1] (trapezoidal shoulders, triangles), input 1 irregular overlapping
+ *        triangles. Compares the plan degrees (segment search) bit by bit with the MF
+ *        functions on random, breakpoint, time-series and non-finite inputs.
+ *
+ * @return  Number of mismatches (1 if the arena is exhausted).
+ */
+int segment_report(int num_mfs, int count)
+{
+    static unsigned char scratch_memory[1 << 20], memory[1 << 20];
+    FIS_Arena scratch, arena;
+    FIS_Builder builder;
+    float breakpoints[2 * 64];
+    int order[64];
+    float coefficients[3] = { 0.5f, -0.25f, 0.1f };
+    const float step = 2.0f / (num_mfs - 1);
+    srand(19);
+
+    FIS_Arena_Init(&scratch, scratch_memory, sizeof(scratch_memory));
+    FIS_Arena_Init(&arena, memory, sizeof(memory));
+    FIS_Builder_Init(&builder, &scratch);
+    FIS_Builder_AddInput(&builder);
+    FIS_Builder_AddInput(&builder);
+
+    for (int m = 0; m < num_mfs; ++m)
+        order[m] = m;
+    for (int m = num_mfs - 1; m > 0; --m)
+    {
+        const int k = rand() % (m + 1), swap = order[m];
+        order[m] = order[k];
+        order[k] = swap;
+    }
+
+    for (int k = 0; k < num_mfs; ++k)
+    {
+        const int m = order[k];
+        const float b = -1.0f + m * step;
+        if (m == 0 || m == num_mfs - 1)
+        {
+            FIS_MF_TrapezoidalParams p = { .a = (m == 0) ? -2.0f : b - step, .b = (m == 0) ? -2.0f : b,
+                                           .c = (m == 0) ? b : 2.0f, .d = (m == 0) ? b + step : 2.0f };
+            FIS_Builder_AddMF(&builder, 0, FIS_MF_TrapezoidalEval, &p);
+        }
+        else
+        {
+            FIS_MF_TriangularParams p = { .a = b - step, .b = b, .c = b + step };
+            FIS_Builder_AddMF(&builder, 0, FIS_MF_TriangularEval, &p);
+        }
+        breakpoints[2 * k] = b;
+
+        const float center = 2.0f * rand() / RAND_MAX - 1.0f;
+        const float width = 0.5f * step + 2.0f * step * rand() / RAND_MAX;
+        FIS_MF_TriangularParams q = { .a = center - width, .b = center, .c = center + 0.5f * width };
+        FIS_Builder_AddMF(&builder, 1, FIS_MF_TriangularEval, &q);
+        breakpoints[2 * k + 1] = q.a;
+    }
+
+    for (int m = 0; m < num_mfs; ++m)
+    {
+        const int mf_indices[2] = { m, (m * 7) % num_mfs };
+        FIS_Builder_SetConsequentLinear(&builder, FIS_Builder_AddRule(&builder, (m % 2) ? FIS_OR_MAX : FIS_AND_MIN, mf_indices),
+                                        coefficients);
+    }
+
+    FIS_System* fis = FIS_Builder_Finalize(&builder, &arena);
+    const FIS_Plan* plan = (fis != NULL) ? FIS_Compile(fis, &arena) : NULL;
+    FIS_PlanWorkspace* ws = (plan != NULL) ? FIS_Plan_CreateWorkspace(plan, &arena) : NULL;
+    if (ws == NULL)
+    {
+        puts("Segment search: arena exhausted");
+        return 1;
+    }
+
+    const FIS_PlanInput* plan_inputs = FIS_PLAN_INPUTS(plan);
+    int mismatches = 0;
+    float max_deviation = 0.0f;
+    for (int s = 0; s < count; ++s)
+    {
+        float x[2];
+        if (s < 2 * num_mfs)
+            x[0] = x[1] = breakpoints[s];                           // breakpoints
+        else if (s < count / 2)
+            x[0] = x[1] = 2.4f * rand() / RAND_MAX - 1.2f;          // random
+        else
+            x[0] = x[1] = 1.1f * sinf(0.01f * s);                   // time series (segment hints)
+        if (s % 97 == 0)
+            x[s % 2] = (s % 3 == 0) ? NAN : (s % 3 == 1) ? INFINITY : -INFINITY;
+
+        const float out = FIS_Plan_Evaluate(plan, x, ws);
+        const float expected = FIS_Evaluate(fis, x);
+        for (int i = 0; i < 2; ++i)
+        {
+            for (int m = 0; m < num_mfs; ++m)
+            {
+                const FIS_MembershipFunction* mf = fis->input_mfs[i][m];
+                const float degree = mf->eval(x[i], mf->params);
+                mismatches += (memcmp(&degree, &ws->degrees[plan_inputs[i].first_mf + m], sizeof(float)) != 0);
+            }
+        }
+        if (isfinite(x[0]) && isfinite(x[1]))
+            max_deviation = fmaxf(max_deviation, fabsf(out - expected));
+    }
+
+    printf("Segment search (%2d MFs): %d/2 inputs searched, %d segment MF entries, degree mismatches %d, "
+           "max deviation %g, image check %s\n",
+           num_mfs, (plan_inputs[0].num_breakpoints > 0) + (plan_inputs[1].num_breakpoints > 0), (int)plan->num_segment_mfs,
+           mismatches, max_deviation, (FIS_Image_Check(plan, plan->size) != NULL) ? "ok" : "failed");
+    return mismatches;
+}
 
 int main(void)
 {
     puts("Sugeno example in C: Test #1 - Inverted pendulum controller");
 
+    // Bit mismatches of the backends and event-triggered tolerance violations
+    int failures = 0;
+
     // FIS definition: pointer variable + dedicated initialization function
     FIS_System* inv_pendulum_ctrl_fis;
     FIS_InvertedPendulumController_Init(&inv_pendulum_ctrl_fis); // in 'fis_sugeno_config.c'
@@ -28,6 +1101,10 @@ int main(void)
         printf("Output C: %f\t Output MATLAB: %f\tError: %f\n", out, test1_outputs[i], fabs(out - test1_outputs[i]));
     }
     printf("Max error: %f\n", error);
+    float batch_deviation = batch_max_deviation(inv_pendulum_ctrl_fis, &test1_inputs[0][0], 6, 2000);
+    failures += (batch_deviation != 0.0f);
+    printf("Batch evaluation max deviation: %g\n", batch_deviation);
+    printf("Compiled plan max deviation: %g\n", plan_max_deviation(inv_pendulum_ctrl_fis, &test1_inputs[0][0], 6, 2000));
 
     puts("\nSugeno example in C: Test #2 - PMSM speed controller");
 
@@ -46,6 +1123,150 @@ int main(void)
         printf("Output C: %f\t Output MATLAB: %f\tError: %f\n", out, test2_outputs[i], fabs(out - test2_outputs[i]));
     }
     printf("Max error: %.15f\n", error);
+    batch_deviation = batch_max_deviation(pmsm_speed_ctrl_fis, &test2_inputs[0][0], 5, 2000);
+    failures += (batch_deviation != 0.0f);
+    printf("Batch evaluation max deviation: %g\n", batch_deviation);
+    printf("Compiled plan max deviation: %g\n", plan_max_deviation(pmsm_speed_ctrl_fis, &test2_inputs[0][0], 5, 2000));
+
+    // Coefficient-array variants (same MFs and rules, float linear consequents) for the
+    // plans, code generator, images and Lipschitz bounds
+    FIS_System* inv_pendulum_linear_fis;
+    FIS_System* pmsm_speed_linear_fis;
+    FIS_InvertedPendulumController_InitLinear(&inv_pendulum_linear_fis);
+    FIS_PMSM_SpeedController_InitLinear(&pmsm_speed_linear_fis);
+
+    puts("\nSIMD membership function kernels");
+
+    // Test values: input columns of both test sets, MF breakpoints and their neighbours,
+    // non-finite values; odd count exercises the scalar tails
+    static float mf_inputs[2000];
+    for (int i = 0; i < 1000; ++i)
+    {
+        mf_inputs[i] = test1_inputs[i * 2][5];
+        mf_inputs[1000 + i] = test2_inputs[i * 2][3];
+    }
+    const float breakpoints[] = { 0.1f, 3.1f, 8.1f, -5.0f, -0.5f, -0.2f, 0.0f, 0.2f, 0.5f, 5.0f };
+    for (int k = 0; k < 10; ++k)
+    {
+        mf_inputs[k * 4 + 0] = breakpoints[k];
+        mf_inputs[k * 4 + 1] = nextafterf(breakpoints[k], -INFINITY);
+        mf_inputs[k * 4 + 2] = nextafterf(breakpoints[k], INFINITY);
+        mf_inputs[k * 4 + 3] = -breakpoints[k];
+    }
+    mf_inputs[40] = NAN;
+    mf_inputs[41] = INFINITY;
+    mf_inputs[42] = -INFINITY;
+
+    int mismatches = 0;
+    for (int m = 0; m < 3; ++m)
+    {
+        mismatches += simd_kernel_mismatches(inv_pendulum_linear_fis->input_mfs[5][m], mf_inputs, 1999);
+        mismatches += simd_kernel_mismatches(pmsm_speed_linear_fis->input_mfs[3][m], mf_inputs, 1999);
+    }
+    printf("SIMD level: %d, kernel mismatches: %d\n", (int)FIS_SIMD_GetLevel(), mismatches);
+    failures += mismatches;
+
+    puts("\nLook-up table backend");
+    lut_report(inv_pendulum_linear_fis, &test1_inputs[0][0], 2000, 1e-3f);
+    lut_report(pmsm_speed_linear_fis, &test2_inputs[0][0], 2000, 1e-3f);
+
+    puts("\nGenerated code (sugeno_codegen)");
+    mismatches = codegen_mismatches(inv_pendulum_linear_fis, FIS_InvertedPendulumController_Evaluate,
+                                    &test1_inputs[0][0], 6, 2000, 5, mf_inputs, 40);
+    printf("Test #1 mismatches: %d\n", mismatches);
+    failures += mismatches;
+    mismatches = codegen_mismatches(pmsm_speed_linear_fis, FIS_PMSM_SpeedController_Evaluate,
+                                    &test2_inputs[0][0], 5, 2000, 3, mf_inputs, 40);
+    printf("Test #2 mismatches: %d\n", mismatches);
+    failures += mismatches;
+
+    failures += jit_report(inv_pendulum_linear_fis, &test1_inputs[0][0], 6, 2000);
+    failures += jit_report(pmsm_speed_linear_fis, &test2_inputs[0][0], 5, 2000);
+
+    puts("\nMATLAB .fis loader");
+    failures += loader_report(inv_pendulum_linear_fis, "inverted_pendulum_controller.fis", &test1_inputs[0][0], 6, 2000);
+    failures += loader_report(pmsm_speed_linear_fis, "pmsm_speed_controller.fis", &test2_inputs[0][0], 5, 2000);
+
+    failures += image_report(inv_pendulum_linear_fis, &test1_inputs[0][0], 6, 2000);
+    failures += image_report(pmsm_speed_linear_fis, &test2_inputs[0][0], 5, 2000);
+
+    puts("\nBuilder API");
+    failures += builder_report(inv_pendulum_linear_fis, &test1_inputs[0][0], 6, 2000);
+    failures += builder_report(pmsm_speed_linear_fis, &test2_inputs[0][0], 5, 2000);
+
+    puts("\nFixed-point engine");
+    failures += fixed_report(inv_pendulum_linear_fis, &test1_inputs[0][0], 6, 2000);
+    failures += fixed_report(pmsm_speed_linear_fis, &test2_inputs[0][0], 5, 2000);
+
+    puts("\nLarge rule bases");
+    failures += large_system_report(8, 5, 20000, 1000);
+
+    puts("\nTensor-product plans");
+    tensor_report(4, 5, 1000);
+    tensor_report(6, 5, 1000);
+    tensor_report(3, 9, 1000);
+
+    puts("\nPartition-of-unity scheduling inputs");
+    partition_report("inverted pendulum", inv_pendulum_linear_fis, &test1_inputs[0][0], 6, 2000);
+    partition_report("PMSM speed", pmsm_speed_linear_fis, &test2_inputs[0][0], 5, 2000);
+
+    // PMSM with the 'static' triangle narrowed to the shoulder edges: a partition
+    FIS_MF_TriangularParams narrow_static = { .a = -0.2f, .b = 0.0f, .c = 0.2f };
+    FIS_MembershipFunction narrow_static_mf = { FIS_MF_TriangularEval, &narrow_static };
+    FIS_MembershipFunction* ruspini_mfs[] = { pmsm_speed_linear_fis->input_mfs[3][0], &narrow_static_mf, pmsm_speed_linear_fis->input_mfs[3][2] };
+    FIS_MembershipFunction** ruspini_input_mfs[5];
+    memcpy(ruspini_input_mfs, pmsm_speed_linear_fis->input_mfs, sizeof(ruspini_input_mfs));
+    ruspini_input_mfs[3] = ruspini_mfs;
+    FIS_System ruspini_pmsm = *pmsm_speed_linear_fis;
+    ruspini_pmsm.input_mfs = ruspini_input_mfs;
+    partition_report("PMSM speed, Ruspini 'static'", &ruspini_pmsm, &test2_inputs[0][0], 5, 2000);
+
+    puts("\nIncremental evaluation");
+    failures += incremental_report("inverted pendulum", inv_pendulum_linear_fis, &test1_inputs[0][0], 6, 2000, 1);
+    failures += incremental_report("inverted pendulum", inv_pendulum_linear_fis, &test1_inputs[0][0], 6, 2000, 10);
+    failures += incremental_report("PMSM speed", pmsm_speed_linear_fis, &test2_inputs[0][0], 5, 2000, 1);
+    failures += incremental_report("PMSM speed", pmsm_speed_linear_fis, &test2_inputs[0][0], 5, 2000, 10);
+
+    puts("\nEvent-triggered evaluation");
+    failures += event_report("inverted pendulum", inv_pendulum_linear_fis, &test1_inputs[0][0], 6, 2000, 0.01f);
+    failures += event_report("inverted pendulum", inv_pendulum_linear_fis, &test1_inputs[0][0], 6, 2000, 0.05f);
+    failures += event_report("PMSM speed", pmsm_speed_linear_fis, &test2_inputs[0][0], 5, 2000, 0.01f);
+    failures += event_report("PMSM speed", pmsm_speed_linear_fis, &test2_inputs[0][0], 5, 2000, 0.05f);
+
+    puts("\nMulti-output systems");
+    mimo_report("inverted pendulum", inv_pendulum_linear_fis, &test1_inputs[0][0], 6, 2000, 4);
+    mimo_report("PMSM speed", pmsm_speed_linear_fis, &test2_inputs[0][0], 5, 2000, 4);
+
+    puts("\nFIS groups");
+    failures += group_report("inverted pendulum", inv_pendulum_linear_fis, &test1_inputs[0][0], 6, 2000, 3);
+    failures += group_report("PMSM speed", pmsm_speed_linear_fis, &test2_inputs[0][0], 5, 2000, 3);
+
+    puts("\nConsequent and MF sharing");
+    sharing_report("inverted pendulum", inv_pendulum_linear_fis, &test1_inputs[0][0], 6, 1000, 4);
+    sharing_report("PMSM speed", pmsm_speed_linear_fis, &test2_inputs[0][0], 5, 1000, 8);
+
+    puts("\nSegment search fuzzification");
+    failures += segment_report(3, 2000);
+    failures += segment_report(8, 2000);
+    failures += segment_report(64, 2000);
+
+    puts("\nInverted rule index");
+    failures += index_report("inverted pendulum", inv_pendulum_linear_fis, &test1_inputs[0][0], 6, 2000);
+    failures += index_report("PMSM speed", pmsm_speed_linear_fis, &test2_inputs[0][0], 5, 2000);
+
+    static unsigned char scratch_memory[4 << 20], grid_memory[2 << 20];
+    static float grid_inputs[1000 * 4];
+    FIS_Arena scratch, grid_arena;
+    for (int s = 0; s < 1000 * 4; ++s)
+        grid_inputs[s] = 2.2f * rand() / RAND_MAX - 1.1f;
+    for (int logic = FIS_AND_MIN; logic <= FIS_AND_PRODUCT; ++logic)
+    {
+        FIS_Arena_Init(&scratch, scratch_memory, sizeof(scratch_memory));
+        FIS_Arena_Init(&grid_arena, grid_memory, sizeof(grid_memory));
+        failures += index_report((logic == FIS_AND_MIN) ? "7^4 grid, min" : "7^4 grid, product",
+                                 build_grid_fis(4, 7, (FIS_LogicType)logic, 1, &scratch, &grid_arena), grid_inputs, 4, 1000);
+    }
 
-    return 0;
-}
\ No newline at end of file
+    // Bit-identical backends and event-triggered evaluation within its tolerance
+    return (failures > 0) ? 1 : 0;
+}
@@ -0,0 +1,82 @@
+#include "fis_sugeno_builder.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+// Generated systems shared by sugeno_test.c and sugeno_bench.c
+
+/**
+ * @brief Builds a complete grid rule base (every MF combination in mixed-radix order,
+ *        uniform triangular partitions of [-1, 1], random linear consequents); with
+ *        `extra_rules`, plus one OR rule and one rule constraining only the first input.
+ *        Built with the builder API into `arena` (scratch reset after).
+ */
+FIS_System* build_grid_fis(int num_inputs, int num_mfs, FIS_LogicType logic_type, int extra_rules, FIS_Arena* scratch, FIS_Arena* arena)
+{
+    FIS_Builder builder;
+    int mf_indices[16];
+    float coefficients[17];
+    const float step = 2.0f / (num_mfs - 1);
+    srand(17);
+
+    FIS_Builder_Init(&builder, scratch);
+    for (int i = 0; i < num_inputs; ++i)
+    {
+        FIS_Builder_AddInput(&builder);
+        for (int m = 0; m < num_mfs; ++m)
+        {
+            FIS_MF_TriangularParams p = { .a = -1.0f + (m - 1) * step, .b = -1.0f + m * step, .c = -1.0f + (m + 1) * step };
+            FIS_Builder_AddMF(&builder, i, FIS_MF_TriangularEval, &p);
+        }
+    }
+
+    int num_rules = 1;
+    for (int i = 0; i < num_inputs; ++i)
+        num_rules *= num_mfs;
+
+    for (int r = 0; r < num_rules + (extra_rules ? 2 : 0); ++r)
+    {
+        for (int i = 0, code = r; i < num_inputs; ++i, code /= num_mfs)
+            mf_indices[num_inputs - 1 - i] = (r < num_rules) ? code % num_mfs : (i == num_inputs - 1) ? 0 : -1;
+        for (int i = 0; i <= num_inputs; ++i)
+            coefficients[i] = (float)rand() / RAND_MAX - 0.5f;
+
+        const int rule = FIS_Builder_AddRule(&builder, (r == num_rules) ? FIS_OR_MAX : logic_type, mf_indices);
+        FIS_Builder_SetConsequentLinear(&builder, rule, coefficients);
+    }
+
+    FIS_System* fis = FIS_Builder_Finalize(&builder, arena);
+    FIS_Arena_Reset(scratch);
+    return fis;
+}
+
+/**
+ * @brief Builds num_outputs copies of a FIS with the same antecedents and linear
+ *        consequents of output k scaled by (k + 1) and offset by 0.1 * k (a second
+ *        output of a set-point controller, feed-forward terms, ...).
+ */
+void build_output_variants(FIS_System* fis, int num_outputs, const FIS_System** systems, FIS_System* storage, FIS_Arena* arena)
+{
+    const int num_coefficients = fis->num_inputs + 1;
+
+    for (int k = 0; k < num_outputs; ++k)
+    {
+        FIS_Rule* rules = FIS_Arena_Alloc(arena, sizeof(FIS_Rule) * fis->num_rules, FIS_ARENA_ALIGN);
+        memcpy(rules, fis->rules, sizeof(FIS_Rule) * fis->num_rules);
+        for (int r = 0; r < fis->num_rules; ++r)
+        {
+            if (rules[r].coefficients == NULL)
+                continue;
+
+            float* coefficients = FIS_Arena_Alloc(arena, sizeof(float) * num_coefficients, FIS_ARENA_ALIGN);
+            for (int j = 0; j < num_coefficients; ++j)
+                coefficients[j] = (k + 1) * fis->rules[r].coefficients[j];
+            coefficients[fis->num_inputs] += 0.1f * k;
+            rules[r].coefficients = coefficients;
+        }
+
+        storage[k] = *fis;
+        storage[k].rules = rules;
+        systems[k] = &storage[k];
+    }
+}